@@ -0,0 +1,62 @@
+#include <cmath>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/boolean.hpp>
+
+namespace stf::alg
+{
+
+// a grid of wavy star-shaped polygons where each polygon overlaps its neighbors (similar to adjacent map features)
+template <typename T>
+static std::vector<geom::holygon<T>> build_grid(size_t const count, T const offset)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> noise(T(-0.05), T(0.05));
+    std::vector<geom::holygon<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < count; ++j)
+        {
+            math::vec2<T> const center(static_cast<T>(i) + offset, static_cast<T>(j) + offset);
+            geom::polygon<T> polygon;
+            for (size_t k = 0; k < 32; ++k)
+            {
+                T const theta = math::constants<T>::two_pi * static_cast<T>(k) / T(32);
+                T const radius = T(0.6) + T(0.1) * std::sin(T(5) * theta) + noise(gen);
+                polygon.push_back(center + radius * math::vec2<T>(std::cos(theta), std::sin(theta)));
+            }
+            result.push_back(geom::holygon<T>(polygon));
+        }
+    }
+    return result;
+}
+
+template <typename T, boolean_types type>
+static void boolean_grid(benchmark::State& state)
+{
+    size_t const count = static_cast<size_t>(state.range(0));
+    std::vector<geom::holygon<T>> const lhs = build_grid<T>(count, T(0));
+    std::vector<geom::holygon<T>> const rhs = build_grid<T>(count, T(0.5));
+    for (auto _ : state)
+    {
+        std::vector<geom::holygon<T>> result =
+            boolean(std::span<geom::holygon<T> const>(lhs), std::span<geom::holygon<T> const>(rhs), type);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * static_cast<int64_t>(count * count));
+}
+
+BENCHMARK(boolean_grid<float, boolean_types::unite>)->Arg(4)->Arg(16);
+BENCHMARK(boolean_grid<float, boolean_types::intersect>)->Arg(4)->Arg(16);
+BENCHMARK(boolean_grid<double, boolean_types::unite>)->Arg(4)->Arg(16);
+BENCHMARK(boolean_grid<double, boolean_types::intersect>)->Arg(4)->Arg(16);
+BENCHMARK(boolean_grid<double, boolean_types::subtract>)->Arg(4)->Arg(16);
+BENCHMARK(boolean_grid<double, boolean_types::exclusive_or>)->Arg(4)->Arg(16);
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <cmath>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/clipping.hpp>
+
+namespace stf::alg
+{
+
+// star-shaped polygons with wavy boundaries scattered over [-8, 8]^2
+template <typename T>
+static std::vector<geom::polygon<T>> build_polygons(size_t const count, size_t const vertices)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(-8), T(8));
+    std::vector<geom::polygon<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        math::vec2<T> const center(position(gen), position(gen));
+        geom::polygon<T> polygon;
+        for (size_t k = 0; k < vertices; ++k)
+        {
+            T const theta = math::constants<T>::two_pi * static_cast<T>(k) / static_cast<T>(vertices);
+            T const radius = T(1.5) + T(0.3) * std::sin(T(7) * theta);
+            polygon.push_back(center + radius * math::vec2<T>(std::cos(theta), std::sin(theta)));
+        }
+        result.push_back(polygon);
+    }
+    return result;
+}
+
+// clip every polygon to each tile of a 4x4 grid, reusing a single buffer
+template <typename T>
+static void clip_polygons(benchmark::State& state)
+{
+    std::vector<geom::polygon<T>> const polygons = build_polygons<T>(100, static_cast<size_t>(state.range(0)));
+    clip_buffer<T> buffer;
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (size_t x = 0; x < 4; ++x)
+        {
+            for (size_t y = 0; y < 4; ++y)
+            {
+                math::vec2<T> const min = math::vec2<T>(T(-8)) + T(4) * math::vec2<T>(T(x), T(y));
+                clip(geom::aabb2<T>(min, min + math::vec2<T>(T(4))), std::span<geom::polygon<T> const>(polygons),
+                     buffer);
+                count += buffer.vertices.size();
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * 16 * static_cast<int64_t>(polygons.size()));
+}
+
+BENCHMARK(clip_polygons<float>)->Arg(16)->Arg(1000);
+BENCHMARK(clip_polygons<double>)->Arg(16)->Arg(1000);
+
+// clip the boundary of every polygon to each tile of a 4x4 grid, either into new vectors or into a single reused buffer
+template <typename T>
+static void clip_polylines(benchmark::State& state)
+{
+    std::vector<geom::polyline2<T>> polylines;
+    for (geom::polygon<T> const& polygon : build_polygons<T>(100, static_cast<size_t>(state.range(0))))
+    {
+        std::vector<math::vec2<T>> boundary = polygon.vertices();
+        boundary.push_back(boundary.front());
+        polylines.push_back(geom::polyline2<T>(boundary));
+    }
+    bool const buffered = state.range(1) != 0;
+    clip_buffer<T> buffer;
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (size_t x = 0; x < 4; ++x)
+        {
+            for (size_t y = 0; y < 4; ++y)
+            {
+                math::vec2<T> const min = math::vec2<T>(T(-8)) + T(4) * math::vec2<T>(T(x), T(y));
+                geom::aabb2<T> const box(min, min + math::vec2<T>(T(4)));
+                if (buffered)
+                {
+                    clip(box, std::span<geom::polyline2<T> const>(polylines), buffer);
+                    count += buffer.vertices.size();
+                }
+                else
+                {
+                    for (geom::polyline2<T> const& polyline : polylines)
+                    {
+                        count += clip(box, polyline).size();
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * 16 * static_cast<int64_t>(polylines.size()));
+}
+
+BENCHMARK(clip_polylines<float>)->Args({1000, 0})->Args({1000, 1});
+BENCHMARK(clip_polylines<double>)->Args({1000, 0})->Args({1000, 1});
+
+// clip random walks to the view volume of a perspective camera, either with a view-projection matrix or a frustum
+template <typename T>
+static void clip_view_volume(benchmark::State& state)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(-60), T(60));
+    std::uniform_real_distribution<T> step(T(-2), T(2));
+    std::vector<geom::polyline3<T>> polylines;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::vector<math::vec3<T>> line = {math::vec3<T>(position(gen), position(gen), position(gen))};
+        for (size_t k = 1; k < 64; ++k)
+        {
+            line.push_back(line.back() + math::vec3<T>(step(gen), step(gen), step(gen)));
+        }
+        polylines.push_back(geom::polyline3<T>(line));
+    }
+
+    cam::scamera<T> const camera(math::vec3<T>(0), math::constants<T>::pi_halves, math::constants<T>::pi_halves, T(1),
+                                 T(100), T(1), math::constants<T>::pi_halves);
+    math::mtx4<T> const view_proj = camera.perspective() * camera.view();
+    cam::frustum<T> const frustum(view_proj);
+    bool const planes = state.range(0) != 0;
+    clip_buffer<T, 3> buffer;
+    for (auto _ : state)
+    {
+        if (planes)
+        {
+            clip(frustum, std::span<geom::polyline3<T> const>(polylines), buffer);
+        }
+        else
+        {
+            clip(view_proj, std::span<geom::polyline3<T> const>(polylines), buffer);
+        }
+        benchmark::DoNotOptimize(buffer.vertices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(polylines.size()));
+}
+
+BENCHMARK(clip_view_volume<float>)->Arg(0)->Arg(1);
+BENCHMARK(clip_view_volume<double>)->Arg(0)->Arg(1);
+
+} // namespace stf::alg
\ No newline at end of file
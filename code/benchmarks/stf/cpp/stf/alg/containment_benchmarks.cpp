@@ -0,0 +1,79 @@
+#include <cmath>
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/containment.hpp>
+
+namespace stf::alg
+{
+
+// a star-shaped polygon with a wavy boundary (similar to a coastline)
+template <typename T>
+static geom::polygon<T> build_star(size_t const count)
+{
+    geom::polygon<T> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        T const theta = math::constants<T>::two_pi * static_cast<T>(i) / static_cast<T>(count);
+        T const radius = T(1.5) + T(0.3) * std::sin(T(17) * theta);
+        result.push_back(radius * math::vec2<T>(std::cos(theta), std::sin(theta)));
+    }
+    return result;
+}
+
+template <typename T>
+static std::vector<math::vec2<T>> build_queries(size_t const count)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<T> position(T(-2), T(2));
+    std::vector<math::vec2<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.push_back(math::vec2<T>(position(gen), position(gen)));
+    }
+    return result;
+}
+
+template <typename T>
+static void polygon_contains(benchmark::State& state)
+{
+    geom::polygon<T> const star = build_star<T>(static_cast<size_t>(state.range(0)));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(100000);
+    std::vector<containment_types> classes(queries.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            bool const inside = star.contains(queries[i], boundary_types::closed);
+            classes[i] = inside ? containment_types::inside : containment_types::outside;
+        }
+        benchmark::DoNotOptimize(classes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+template <typename T>
+static void classify_batch(benchmark::State& state)
+{
+    geom::polygon<T> const star = build_star<T>(static_cast<size_t>(state.range(0)));
+    size_t const threads = static_cast<size_t>(state.range(1));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(100000);
+    std::vector<containment_types> classes(queries.size());
+    for (auto _ : state)
+    {
+        classify<T>(star, queries, classes, threads);
+        benchmark::DoNotOptimize(classes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+BENCHMARK(polygon_contains<float>)->Arg(1000);
+BENCHMARK(classify_batch<float>)->Args({1000, 1})->Args({1000, 4})->Args({50000, 1})->Args({50000, 4});
+BENCHMARK(polygon_contains<double>)->Arg(1000);
+BENCHMARK(classify_batch<double>)->Args({1000, 1})->Args({1000, 4})->Args({50000, 1})->Args({50000, 4});
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/gjk.hpp>
+#include <stf/alg/intersects.hpp>
+
+namespace stf::alg
+{
+
+template <typename T>
+struct scene final
+{
+    std::vector<geom::obb3<T>> lhs;
+    std::vector<geom::obb3<T>> rhs;
+    std::vector<math::vec3<T>> velocities;
+
+    // translate each lhs box by a small amount so that consecutive frames are coherent but not identical
+    void step(size_t const frame)
+    {
+        T const sign = (frame % 64 < 32) ? T(1) : T(-1);
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            lhs[i] = geom::obb3<T>(lhs[i].center() + sign * velocities[i], lhs[i].basis(), lhs[i].half_extents());
+        }
+    }
+};
+
+template <typename T>
+static scene<T> build_scene(size_t const count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(-3), T(3));
+    std::uniform_real_distribution<T> extent(T(0.5), T(2));
+    std::uniform_real_distribution<T> angle(T(0), math::constants<T>::two_pi);
+    std::uniform_real_distribution<T> velocity(T(-0.01), T(0.01));
+    auto random_obb = [&]()
+    {
+        math::vec3<T> const axis = math::normalized(math::vec3<T>(position(gen), position(gen), position(gen)));
+        math::mtx<T, 3> const rotation = math::rotate(axis, angle(gen)).prefix();
+        math::vec3<T> const center(position(gen), position(gen), position(gen));
+        return geom::obb3<T>(center, rotation, math::vec3<T>(extent(gen), extent(gen), extent(gen)));
+    };
+
+    scene<T> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.lhs.push_back(random_obb());
+        result.rhs.push_back(random_obb());
+        result.velocities.push_back(math::vec3<T>(velocity(gen), velocity(gen), velocity(gen)));
+    }
+    return result;
+}
+
+template <typename T>
+static void obb_sat(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    size_t frame = 0;
+    for (auto _ : state)
+    {
+        input.step(frame++);
+        size_t count = 0;
+        for (size_t i = 0; i < input.lhs.size(); ++i)
+        {
+            count += alg::intersects(input.lhs[i], input.rhs[i]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void obb_gjk_cold(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    size_t frame = 0;
+    for (auto _ : state)
+    {
+        input.step(frame++);
+        size_t count = 0;
+        for (size_t i = 0; i < input.lhs.size(); ++i)
+        {
+            count += gjk_intersects<T>(input.lhs[i], input.rhs[i]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void obb_gjk_warm(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    std::vector<gjk_simplex<T>> simplices(input.lhs.size());
+    size_t frame = 0;
+    for (auto _ : state)
+    {
+        input.step(frame++);
+        size_t count = 0;
+        for (size_t i = 0; i < input.lhs.size(); ++i)
+        {
+            count += gjk_intersects(input.lhs[i], input.rhs[i], simplices[i]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void obb_epa(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    std::vector<gjk_simplex<T>> simplices(input.lhs.size());
+    size_t frame = 0;
+    for (auto _ : state)
+    {
+        input.step(frame++);
+        T depth = T(0);
+        for (size_t i = 0; i < input.lhs.size(); ++i)
+        {
+            depth += epa(input.lhs[i], input.rhs[i], simplices[i]).depth;
+        }
+        benchmark::DoNotOptimize(depth);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(obb_sat<float>)->Arg(10000);
+BENCHMARK(obb_gjk_cold<float>)->Arg(10000);
+BENCHMARK(obb_gjk_warm<float>)->Arg(10000);
+BENCHMARK(obb_epa<float>)->Arg(10000);
+BENCHMARK(obb_sat<double>)->Arg(10000);
+BENCHMARK(obb_gjk_cold<double>)->Arg(10000);
+BENCHMARK(obb_gjk_warm<double>)->Arg(10000);
+BENCHMARK(obb_epa<double>)->Arg(10000);
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include <cmath>
+
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/intersect.hpp>
+#include <stf/alg/ray_packet.hpp>
+#include <stf/alg/raycast.hpp>
+
+namespace stf::alg
+{
+
+template <typename T>
+struct terrain final
+{
+    std::vector<math::vec3<T>> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<geom::aabb3<T>> boxes;
+};
+
+template <typename T>
+static terrain<T> build_terrain(size_t const n)
+{
+    // an n x n grid of quads (split into triangles) displaced by a smooth height field
+    terrain<T> result;
+    for (size_t j = 0; j <= n; ++j)
+    {
+        for (size_t i = 0; i <= n; ++i)
+        {
+            T const x = static_cast<T>(i);
+            T const y = static_cast<T>(j);
+            result.vertices.push_back(math::vec3<T>(x, y, T(4) * std::sin(x / T(16)) * std::cos(y / T(16))));
+        }
+    }
+    for (size_t j = 0; j < n; ++j)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t const v = j * (n + 1) + i;
+            for (size_t index : {v, v + 1, v + n + 2, v, v + n + 2, v + n + 1})
+            {
+                result.indices.push_back(static_cast<uint32_t>(index));
+            }
+        }
+    }
+    for (size_t t = 0; t < result.indices.size(); t += 3)
+    {
+        geom::aabb3<T> box = geom::aabb3<T>::nothing();
+        for (size_t k = 0; k < 3; ++k)
+        {
+            box.fit(result.vertices[result.indices[t + k]]);
+        }
+        result.boxes.push_back(box);
+    }
+    return result;
+}
+
+template <typename T>
+static std::vector<prepared_ray<T>> build_rays(size_t const n)
+{
+    // rays cast down onto the terrain from a grid of points above it
+    std::vector<prepared_ray<T>> rays;
+    for (size_t j = 0; j < 32; ++j)
+    {
+        for (size_t i = 0; i < 32; ++i)
+        {
+            math::vec3<T> origin(static_cast<T>(n * i) / T(32), static_cast<T>(n * j) / T(32), T(50));
+            rays.push_back(prepared_ray<T>(geom::ray3<T>(origin, math::vec3<T>(T(0.3), T(0.2), T(-1)))));
+        }
+    }
+    return rays;
+}
+
+template <typename T>
+static std::vector<geom::ray3<T>> build_camera_rays(size_t const n)
+{
+    // coherent rays through a 256x256 grid of pixels of a camera looking down at the terrain (in row-major order)
+    cam::scamera<T> const camera(math::vec3<T>(static_cast<T>(n) / T(2), T(-20), T(60)), math::constants<T>::pi_halves,
+                                 T(2.3), T(1), T(1000), T(1), math::constants<T>::pi_fourths);
+    std::vector<geom::ray3<T>> rays;
+    for (size_t j = 0; j < 256; ++j)
+    {
+        for (size_t i = 0; i < 256; ++i)
+        {
+            rays.push_back(camera.ray(math::vec2<T>((static_cast<T>(i) + T(0.5)) / T(256),
+                                                    (static_cast<T>(j) + T(0.5)) / T(256))));
+        }
+    }
+    return rays;
+}
+
+template <typename T>
+static void bvh_build(benchmark::State& state)
+{
+    terrain<T> const input = build_terrain<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        spatial::bvh<T, 3> tree(input.boxes);
+        benchmark::DoNotOptimize(tree);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.boxes.size()));
+}
+
+template <typename T>
+static void raycast_nearest_hit(benchmark::State& state)
+{
+    size_t const n = static_cast<size_t>(state.range(0));
+    terrain<T> const input = build_terrain<T>(n);
+    spatial::bvh<T, 3> const tree(input.boxes);
+    std::vector<prepared_ray<T>> const rays = build_rays<T>(n);
+    for (auto _ : state)
+    {
+        for (prepared_ray<T> const& ray : rays)
+        {
+            benchmark::DoNotOptimize(nearest_hit<T>(tree, input.vertices, input.indices, ray));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T>
+static void raycast_any_hit(benchmark::State& state)
+{
+    size_t const n = static_cast<size_t>(state.range(0));
+    terrain<T> const input = build_terrain<T>(n);
+    spatial::bvh<T, 3> const tree(input.boxes);
+    std::vector<prepared_ray<T>> const rays = build_rays<T>(n);
+    for (auto _ : state)
+    {
+        for (prepared_ray<T> const& ray : rays)
+        {
+            benchmark::DoNotOptimize(any_hit<T>(tree, input.vertices, input.indices, ray));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T>
+static void raycast_camera_single(benchmark::State& state)
+{
+    size_t const n = static_cast<size_t>(state.range(0));
+    terrain<T> const input = build_terrain<T>(n);
+    spatial::bvh<T, 3> const tree(input.boxes);
+    std::vector<geom::ray3<T>> const rays = build_camera_rays<T>(n);
+    for (auto _ : state)
+    {
+        for (geom::ray3<T> const& ray : rays)
+        {
+            benchmark::DoNotOptimize(nearest_hit<T>(tree, input.vertices, input.indices, prepared_ray<T>(ray)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T, size_t W>
+static void raycast_camera_packet(benchmark::State& state)
+{
+    size_t const n = static_cast<size_t>(state.range(0));
+    terrain<T> const input = build_terrain<T>(n);
+    spatial::bvh<T, 3> const tree(input.boxes);
+    std::vector<geom::ray3<T>> const rays = build_camera_rays<T>(n);
+    std::vector<ray_packet<T, W>> packets;
+    for (size_t i = 0; i < rays.size(); i += W)
+    {
+        packets.push_back(ray_packet<T, W>(std::span<geom::ray3<T> const>(rays).subspan(i, W)));
+    }
+    for (auto _ : state)
+    {
+        for (ray_packet<T, W> const& packet : packets)
+        {
+            benchmark::DoNotOptimize(nearest_hit<T, W>(tree, input.vertices, input.indices, packet));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T>
+static void project_onto_ground_single(benchmark::State& state)
+{
+    std::vector<geom::ray3<T>> const rays = build_camera_rays<T>(256);
+    geom::plane<T> const ground(math::vec3<T>(T(0)), math::vec3<T>(T(0), T(0), T(1)));
+    for (auto _ : state)
+    {
+        for (geom::ray3<T> const& ray : rays)
+        {
+            benchmark::DoNotOptimize(intersect(ray, ground));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T>
+static void project_onto_ground_batch(benchmark::State& state)
+{
+    std::vector<geom::ray3<T>> const rays = build_camera_rays<T>(256);
+    geom::plane<T> const ground(math::vec3<T>(T(0)), math::vec3<T>(T(0), T(0), T(1)));
+    std::vector<T> t(rays.size());
+    for (auto _ : state)
+    {
+        raycast<T>(rays, ground, t);
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T, typename geometry_t>
+static geometry_t build_primitive()
+{
+    if constexpr (std::is_same_v<geometry_t, geom::sphere<T>>)
+    {
+        return geometry_t(math::vec3<T>(T(128), T(60), T(10)), T(40));
+    }
+    else
+    {
+        return geometry_t(math::vec3<T>(T(88), T(20), T(0)), math::vec3<T>(T(168), T(100), T(30)));
+    }
+}
+
+template <typename T, typename geometry_t>
+static void raycast_primitive_single(benchmark::State& state)
+{
+    std::vector<geom::ray3<T>> const rays = build_camera_rays<T>(256);
+    geometry_t const primitive = build_primitive<T, geometry_t>();
+    for (auto _ : state)
+    {
+        for (geom::ray3<T> const& ray : rays)
+        {
+            benchmark::DoNotOptimize(raycast(ray, primitive));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+template <typename T, typename geometry_t>
+static void raycast_primitive_batch(benchmark::State& state)
+{
+    std::vector<geom::ray3<T>> const rays = build_camera_rays<T>(256);
+    geometry_t const primitive = build_primitive<T, geometry_t>();
+    std::vector<T> t(rays.size());
+    for (auto _ : state)
+    {
+        raycast<T>(rays, primitive, t);
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+BENCHMARK(bvh_build<float>)->Arg(256);
+BENCHMARK(raycast_nearest_hit<float>)->Arg(256)->Arg(708);
+BENCHMARK(raycast_nearest_hit<double>)->Arg(256);
+BENCHMARK(raycast_any_hit<float>)->Arg(256)->Arg(708);
+BENCHMARK(raycast_camera_single<float>)->Arg(256);
+BENCHMARK(raycast_camera_packet<float, 4>)->Arg(256);
+BENCHMARK(raycast_camera_packet<float, 8>)->Arg(256);
+BENCHMARK(project_onto_ground_single<float>);
+BENCHMARK(project_onto_ground_batch<float>);
+BENCHMARK(raycast_primitive_single<float, geom::sphere<float>>);
+BENCHMARK(raycast_primitive_batch<float, geom::sphere<float>>);
+BENCHMARK(raycast_primitive_single<float, geom::aabb3<float>>);
+BENCHMARK(raycast_primitive_batch<float, geom::aabb3<float>>);
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/sweep.hpp>
+#include <stf/spatial/sweep_and_prune.hpp>
+
+namespace stf::alg
+{
+
+template <typename T>
+struct scene final
+{
+    std::vector<geom::sphere<T>> spheres;
+    std::vector<math::vec3<T>> displacements;
+    std::vector<spatial::index_pair> pairs;
+};
+
+template <typename T>
+static scene<T> build_scene(size_t const count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(-100), T(100));
+    std::uniform_real_distribution<T> radius(T(0.2), T(1));
+    std::uniform_real_distribution<T> displacement(T(-4), T(4));
+
+    scene<T> result;
+    std::vector<geom::aabb3<T>> swept;
+    for (size_t i = 0; i < count; ++i)
+    {
+        geom::sphere<T> const sphere(math::vec3<T>(position(gen), position(gen), position(gen)), radius(gen));
+        math::vec3<T> const delta(displacement(gen), displacement(gen), displacement(gen));
+        math::vec3<T> const r(sphere.radius);
+        geom::aabb3<T> const start(sphere.center - r, sphere.center + r);
+        result.spheres.push_back(sphere);
+        result.displacements.push_back(delta);
+        swept.push_back(start.fitted(start.translated(delta)));
+    }
+
+    // candidate pairs come from a broadphase over the bounds of each sphere over the frame
+    spatial::overlapping_pairs<T, 3>(swept, result.pairs);
+    return result;
+}
+
+template <typename T>
+static void spheres_substepped(benchmark::State& state)
+{
+    // discrete overlap checks at a fixed number of substeps (which can still miss thin contacts)
+    size_t const substeps = 8;
+    scene<T> const input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (auto const& [lhs, rhs] : input.pairs)
+        {
+            math::vec3<T> const relative = input.displacements[lhs] - input.displacements[rhs];
+            T const sum = input.spheres[lhs].radius + input.spheres[rhs].radius;
+            for (size_t s = 0; s <= substeps; ++s)
+            {
+                T const t = static_cast<T>(s) / static_cast<T>(substeps);
+                math::vec3<T> const delta = input.spheres[lhs].center + t * relative - input.spheres[rhs].center;
+                if (math::dot(delta, delta) <= sum * sum)
+                {
+                    ++count;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.pairs.size()));
+}
+
+template <typename T>
+static void spheres_swept(benchmark::State& state)
+{
+    scene<T> const input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    std::vector<T> times(input.pairs.size());
+    for (auto _ : state)
+    {
+        time_of_impact<T>(input.spheres, input.displacements, input.pairs, times);
+        benchmark::DoNotOptimize(times.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.pairs.size()));
+}
+
+BENCHMARK(spheres_substepped<float>)->Arg(20000);
+BENCHMARK(spheres_swept<float>)->Arg(20000);
+BENCHMARK(spheres_substepped<double>)->Arg(20000);
+BENCHMARK(spheres_swept<double>)->Arg(20000);
+
+} // namespace stf::alg
\ No newline at end of file
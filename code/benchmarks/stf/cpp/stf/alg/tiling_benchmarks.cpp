@@ -0,0 +1,86 @@
+#include <cmath>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/clipping.hpp>
+#include <stf/alg/tiling.hpp>
+
+namespace stf::alg
+{
+
+// star-shaped polygons with wavy boundaries scattered over [-8, 8]^2
+template <typename T>
+static std::vector<geom::polygon<T>> build_polygons(size_t const count, size_t const vertices)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(-8), T(8));
+    std::vector<geom::polygon<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        math::vec2<T> const center(position(gen), position(gen));
+        geom::polygon<T> polygon;
+        for (size_t k = 0; k < vertices; ++k)
+        {
+            T const theta = math::constants<T>::two_pi * static_cast<T>(k) / static_cast<T>(vertices);
+            T const radius = T(1.5) + T(0.3) * std::sin(T(7) * theta);
+            polygon.push_back(center + radius * math::vec2<T>(std::cos(theta), std::sin(theta)));
+        }
+        result.push_back(polygon);
+    }
+    return result;
+}
+
+template <typename T>
+static tile_grid<T> build_grid(size_t const tiles)
+{
+    T const size = T(16) / static_cast<T>(tiles);
+    return tile_grid<T>{math::vec2<T>(T(-8)), math::vec2<T>(size), T(0.05) * size, tiles, tiles};
+}
+
+// clip every polygon to each tile of the grid separately (the baseline for tiling)
+template <typename T>
+static void clip_per_tile(benchmark::State& state)
+{
+    std::vector<geom::polygon<T>> const polygons = build_polygons<T>(1000, 256);
+    tile_grid<T> const grid = build_grid<T>(static_cast<size_t>(state.range(0)));
+    std::vector<clip_buffer<T>> buffers(grid.count());
+    for (auto _ : state)
+    {
+        for (size_t r = 0; r < grid.rows; ++r)
+        {
+            for (size_t c = 0; c < grid.columns; ++c)
+            {
+                clip(grid.bounds(c, r), std::span<geom::polygon<T> const>(polygons), buffers[grid.index(c, r)]);
+            }
+        }
+        benchmark::DoNotOptimize(buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(polygons.size()));
+}
+
+// distribute every polygon to the tiles it overlaps in a single pass
+template <typename T>
+static void tile_polygons(benchmark::State& state)
+{
+    std::vector<geom::polygon<T>> const polygons = build_polygons<T>(1000, 256);
+    tiler<T> tiles(build_grid<T>(static_cast<size_t>(state.range(0))));
+    size_t const threads = static_cast<size_t>(state.range(1));
+    for (auto _ : state)
+    {
+        tiles.tile(std::span<geom::polygon<T> const>(polygons), threads);
+        benchmark::DoNotOptimize(tiles.at(0, 0).clipped.vertices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(polygons.size()));
+}
+
+BENCHMARK(clip_per_tile<float>)->Arg(4)->Arg(16);
+BENCHMARK(clip_per_tile<double>)->Arg(4)->Arg(16);
+BENCHMARK(tile_polygons<float>)->Args({4, 1})->Args({16, 1})->Args({16, 4});
+BENCHMARK(tile_polygons<double>)->Args({4, 1})->Args({16, 1})->Args({16, 4});
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+
+namespace stf::cam
+{
+
+template <typename T>
+static scamera<T> camera()
+{
+    return scamera<T>(math::vec3<T>(10, -20, 5), math::constants<T>::pi_halves, math::constants<T>::pi_halves, T(1),
+                      T(100), T(1.5), math::constants<T>::pi_fourths);
+}
+
+template <typename T>
+static std::vector<geom::sphere<T>> spheres()
+{
+    // a grid of spheres around the camera, some of which intersect the frustum
+    std::vector<geom::sphere<T>> result;
+    for (int i = -10; i <= 10; ++i)
+    {
+        for (int j = -5; j <= 20; ++j)
+        {
+            for (int k = -10; k <= 10; ++k)
+            {
+                math::vec3<T> center(T(8 * i), T(6 * j), T(8 * k));
+                result.push_back(geom::sphere<T>(center, T(1 + ((i + j + k) & 3))));
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T>
+static void frustum_from_scamera(benchmark::State& state)
+{
+    scamera<T> const cam = camera<T>();
+    for (auto _ : state)
+    {
+        frustum<T> f(cam);
+        benchmark::DoNotOptimize(f);
+    }
+}
+
+template <typename T>
+static void frustum_from_matrix(benchmark::State& state)
+{
+    math::mtx4<T> const view_proj = camera<T>().perspective() * camera<T>().view();
+    for (auto _ : state)
+    {
+        frustum<T> f(view_proj);
+        benchmark::DoNotOptimize(f);
+    }
+}
+
+template <typename T>
+static void prepared_frustum_from_matrix(benchmark::State& state)
+{
+    math::mtx4<T> const view_proj = camera<T>().perspective() * camera<T>().view();
+    for (auto _ : state)
+    {
+        prepared_frustum<T> f{frustum<T>(view_proj)};
+        benchmark::DoNotOptimize(f);
+    }
+}
+
+template <typename T>
+static void cull_spheres(benchmark::State& state)
+{
+    frustum<T> const f(camera<T>());
+    std::vector<geom::sphere<T>> const input = spheres<T>();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (geom::sphere<T> const& sphere : input)
+        {
+            count += f.intersects_fast(sphere) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+
+template <typename T>
+static void cull_spheres_as_aabbs(benchmark::State& state)
+{
+    frustum<T> const f(camera<T>());
+    std::vector<geom::sphere<T>> const input = spheres<T>();
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (geom::sphere<T> const& sphere : input)
+        {
+            math::vec3<T> const radius(sphere.radius);
+            count += f.intersects_fast(geom::aabb3<T>(sphere.center - radius, sphere.center + radius)) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+
+template <typename T>
+static void cull_spheres_batch(benchmark::State& state)
+{
+    prepared_frustum<T> const f{frustum<T>(camera<T>())};
+    std::vector<geom::sphere<T>> const input = spheres<T>();
+    std::vector<T> x, y, z, radius;
+    for (geom::sphere<T> const& sphere : input)
+    {
+        x.push_back(sphere.center.x);
+        y.push_back(sphere.center.y);
+        z.push_back(sphere.center.z);
+        radius.push_back(sphere.radius);
+    }
+    std::vector<size_t> visible(input.size());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(f.cull(x, y, z, radius, visible));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.size()));
+}
+
+BENCHMARK(frustum_from_scamera<float>);
+BENCHMARK(frustum_from_scamera<double>);
+BENCHMARK(frustum_from_matrix<float>);
+BENCHMARK(frustum_from_matrix<double>);
+BENCHMARK(prepared_frustum_from_matrix<float>);
+BENCHMARK(prepared_frustum_from_matrix<double>);
+BENCHMARK(cull_spheres<float>);
+BENCHMARK(cull_spheres<double>);
+BENCHMARK(cull_spheres_as_aabbs<float>);
+BENCHMARK(cull_spheres_as_aabbs<double>);
+BENCHMARK(cull_spheres_batch<float>);
+BENCHMARK(cull_spheres_batch<double>);
+
+} // namespace stf::cam
\ No newline at end of file
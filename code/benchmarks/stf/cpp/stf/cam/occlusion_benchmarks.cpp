@@ -0,0 +1,89 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+
+namespace stf::cam
+{
+
+template <typename T>
+struct city final
+{
+    std::vector<math::vec3<T>> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<geom::aabb3<T>> boxes;
+};
+
+template <typename T>
+static scamera<T> street_camera()
+{
+    return scamera<T>(math::vec3<T>(0, -5, 2), math::constants<T>::pi_halves, math::constants<T>::pi_halves, T(1),
+                      T(500), T(16) / T(9), math::constants<T>::pi_halves);
+}
+
+template <typename T>
+static city<T> build_city()
+{
+    // a grid of buildings whose facades are the occluders and whose bounding boxes are the queries
+    city<T> result;
+    for (int i = -10; i <= 10; ++i)
+    {
+        for (int j = 1; j <= 30; ++j)
+        {
+            math::vec3<T> const min(T(12 * i) - T(4), T(12 * j), T(0));
+            math::vec3<T> const size(T(8), T(8), T(10 + 5 * ((i + j) & 3)));
+            result.boxes.push_back(geom::aabb3<T>(min, min + size));
+
+            size_t const base = result.vertices.size();
+            result.vertices.push_back(min);
+            result.vertices.push_back(min + math::vec3<T>(size.x, 0, 0));
+            result.vertices.push_back(min + math::vec3<T>(size.x, 0, size.z));
+            result.vertices.push_back(min + math::vec3<T>(0, 0, size.z));
+            for (size_t index : {0, 1, 2, 0, 2, 3})
+            {
+                result.indices.push_back(static_cast<uint32_t>(base + index));
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T>
+static void occlusion_rasterize(benchmark::State& state)
+{
+    city<T> const input = build_city<T>();
+    scamera<T> const camera = street_camera<T>();
+    occlusion_buffer<T> buffer(256, 144);
+    size_t const threads = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        buffer.clear();
+        buffer.rasterize(input.vertices, input.indices, camera, threads);
+        benchmark::DoNotOptimize(buffer.depth(0, 0, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.indices.size() / 3));
+}
+
+template <typename T>
+static void occlusion_cull(benchmark::State& state)
+{
+    city<T> const input = build_city<T>();
+    scamera<T> const camera = street_camera<T>();
+    occlusion_buffer<T> buffer(256, 144);
+    buffer.rasterize(input.vertices, input.indices, camera);
+    math::mtx4<T> const view_proj = camera.perspective() * camera.view();
+    std::vector<size_t> visible(input.boxes.size());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(buffer.cull(input.boxes, view_proj, visible));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(input.boxes.size()));
+}
+
+BENCHMARK(occlusion_rasterize<float>)->Arg(1)->Arg(4);
+BENCHMARK(occlusion_rasterize<double>)->Arg(1)->Arg(4);
+BENCHMARK(occlusion_cull<float>);
+BENCHMARK(occlusion_cull<double>);
+
+} // namespace stf::cam
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <cmath>
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/geom/convex_polygon.hpp>
+
+namespace stf::geom
+{
+
+// a regular polygon with the given number of vertices centered at the given point
+template <typename T>
+static polygon<T> build_circle(size_t const count, math::vec2<T> const& center)
+{
+    polygon<T> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        T const theta = math::constants<T>::two_pi * static_cast<T>(i) / static_cast<T>(count);
+        result.push_back(center + math::vec2<T>(std::cos(theta), std::sin(theta)));
+    }
+    return result;
+}
+
+template <typename T>
+static std::vector<math::vec2<T>> build_queries(size_t const count)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<T> position(T(-1.5), T(1.5));
+    std::vector<math::vec2<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.push_back(math::vec2<T>(position(gen), position(gen)));
+    }
+    return result;
+}
+
+template <typename T>
+static void polygon_contains(benchmark::State& state)
+{
+    polygon<T> const circle = build_circle<T>(static_cast<size_t>(state.range(0)), math::vec2<T>(0));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(1000);
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (math::vec2<T> const& query : queries)
+        {
+            count += circle.contains(query, boundary_types::closed) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+template <typename T>
+static void convex_polygon_contains(benchmark::State& state)
+{
+    convex_polygon<T> const circle(build_circle<T>(static_cast<size_t>(state.range(0)), math::vec2<T>(0)));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(1000);
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (math::vec2<T> const& query : queries)
+        {
+            count += circle.contains(query, boundary_types::closed) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+template <typename T>
+static void convex_polygon_intersects(benchmark::State& state)
+{
+    size_t const count = static_cast<size_t>(state.range(0));
+    convex_polygon<T> const lhs(build_circle<T>(count, math::vec2<T>(0)));
+    convex_polygon<T> const rhs(build_circle<T>(count, math::vec2<T>(T(1.5), T(0.5))));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lhs.intersects(rhs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void convex_polygon_dist(benchmark::State& state)
+{
+    size_t const count = static_cast<size_t>(state.range(0));
+    convex_polygon<T> const lhs(build_circle<T>(count, math::vec2<T>(0)));
+    convex_polygon<T> const rhs(build_circle<T>(count, math::vec2<T>(T(3), T(1))));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lhs.dist_squared(rhs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(polygon_contains<float>)->Arg(16)->Arg(1000);
+BENCHMARK(convex_polygon_contains<float>)->Arg(16)->Arg(1000);
+BENCHMARK(convex_polygon_intersects<float>)->Arg(16)->Arg(1000);
+BENCHMARK(convex_polygon_dist<float>)->Arg(16)->Arg(1000);
+BENCHMARK(polygon_contains<double>)->Arg(16)->Arg(1000);
+BENCHMARK(convex_polygon_contains<double>)->Arg(16)->Arg(1000);
+BENCHMARK(convex_polygon_intersects<double>)->Arg(16)->Arg(1000);
+BENCHMARK(convex_polygon_dist<double>)->Arg(16)->Arg(1000);
+
+} // namespace stf::geom
\ No newline at end of file
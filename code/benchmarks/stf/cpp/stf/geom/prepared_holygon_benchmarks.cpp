@@ -0,0 +1,72 @@
+#include <cmath>
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/geom/prepared_holygon.hpp>
+
+namespace stf::geom
+{
+
+// a square with a grid of small diamond-shaped holes (similar to a land polygon with many lakes)
+template <typename T>
+static holygon<T> build_lakes(size_t const grid)
+{
+    polygon<T> hull({math::vec2<T>(-1, -1), math::vec2<T>(1, -1), math::vec2<T>(1, 1), math::vec2<T>(-1, 1)});
+    std::vector<polygon<T>> holes;
+    T const cell = T(2) / static_cast<T>(grid);
+    for (size_t x = 0; x < grid; ++x)
+    {
+        for (size_t y = 0; y < grid; ++y)
+        {
+            math::vec2<T> const center(-T(1) + cell * (T(x) + T(0.5)), -T(1) + cell * (T(y) + T(0.5)));
+            T const r = T(0.3) * cell;
+            holes.push_back(polygon<T>({center + math::vec2<T>(r, 0), center + math::vec2<T>(0, r),
+                                        center + math::vec2<T>(-r, 0), center + math::vec2<T>(0, -r)}));
+        }
+    }
+    return holygon<T>(hull, holes);
+}
+
+template <typename T>
+static std::vector<math::vec2<T>> build_queries(size_t const count)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<T> position(T(-1.2), T(1.2));
+    std::vector<math::vec2<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.push_back(math::vec2<T>(position(gen), position(gen)));
+    }
+    return result;
+}
+
+template <typename T, typename shape_t>
+static void holygon_queries(benchmark::State& state)
+{
+    shape_t const shape(build_lakes<T>(static_cast<size_t>(state.range(0))));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(1000);
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        T sum = T(0);
+        for (math::vec2<T> const& query : queries)
+        {
+            count += shape.contains(query, boundary_types::closed) ? 1 : 0;
+            sum += shape.dist_squared(query);
+        }
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+BENCHMARK(holygon_queries<float, holygon<float>>)->Arg(10)->Arg(50);
+BENCHMARK(holygon_queries<float, prepared_holygon<float>>)->Arg(10)->Arg(50);
+BENCHMARK(holygon_queries<double, holygon<double>>)->Arg(10)->Arg(50);
+BENCHMARK(holygon_queries<double, prepared_holygon<double>>)->Arg(10)->Arg(50);
+
+} // namespace stf::geom
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <cmath>
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/geom/prepared_polygon.hpp>
+
+namespace stf::geom
+{
+
+// a star-shaped polygon with a wavy, slightly noisy boundary (similar to a coastline)
+template <typename T>
+static polygon<T> build_star(size_t const count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> noise(T(-0.001), T(0.001));
+    polygon<T> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        T const theta = math::constants<T>::two_pi * static_cast<T>(i) / static_cast<T>(count);
+        T const radius = T(1.5) + T(0.3) * std::sin(T(17) * theta) + noise(gen);
+        result.push_back(radius * math::vec2<T>(std::cos(theta), std::sin(theta)));
+    }
+    return result;
+}
+
+template <typename T>
+static std::vector<math::vec2<T>> build_queries(size_t const count)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<T> position(T(-2), T(2));
+    std::vector<math::vec2<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.push_back(math::vec2<T>(position(gen), position(gen)));
+    }
+    return result;
+}
+
+template <typename T>
+static void polygon_contains(benchmark::State& state)
+{
+    polygon<T> const star = build_star<T>(static_cast<size_t>(state.range(0)));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(1000);
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (math::vec2<T> const& query : queries)
+        {
+            count += star.contains(query, boundary_types::closed) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+template <typename T>
+static void prepared_polygon_contains(benchmark::State& state)
+{
+    prepared_polygon<T> const star(build_star<T>(static_cast<size_t>(state.range(0))));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(1000);
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (math::vec2<T> const& query : queries)
+        {
+            count += star.contains(query, boundary_types::closed) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+template <typename T>
+static void prepared_polygon_build(benchmark::State& state)
+{
+    polygon<T> const star = build_star<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        prepared_polygon<T> prepared(star);
+        benchmark::DoNotOptimize(prepared.edge_count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(polygon_contains<float>)->Arg(1000)->Arg(50000);
+BENCHMARK(prepared_polygon_contains<float>)->Arg(1000)->Arg(50000);
+BENCHMARK(prepared_polygon_build<float>)->Arg(1000)->Arg(50000);
+BENCHMARK(polygon_contains<double>)->Arg(1000)->Arg(50000);
+BENCHMARK(prepared_polygon_contains<double>)->Arg(1000)->Arg(50000);
+BENCHMARK(prepared_polygon_build<double>)->Arg(1000)->Arg(50000);
+
+} // namespace stf::geom
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/edge_bvh.hpp>
+
+namespace stf::spatial
+{
+
+// a random walk (similar to a gps trace)
+template <typename T>
+static geom::polyline2<T> build_walk(size_t const count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> step(T(-1), T(1));
+    geom::polyline2<T> result;
+    math::vec2<T> position(T(0));
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.push_back(position);
+        position += math::vec2<T>(step(gen), step(gen));
+    }
+    return result;
+}
+
+template <typename T>
+static std::vector<math::vec2<T>> build_queries(geom::polyline2<T> const& walk, size_t const count)
+{
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<size_t> vertex(0, walk.size() - 1);
+    std::uniform_real_distribution<T> offset(T(-2), T(2));
+    std::vector<math::vec2<T>> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result.push_back(walk.vertices()[vertex(gen)] + math::vec2<T>(offset(gen), offset(gen)));
+    }
+    return result;
+}
+
+template <typename T>
+static void polyline_dist_squared(benchmark::State& state)
+{
+    geom::polyline2<T> const walk = build_walk<T>(static_cast<size_t>(state.range(0)));
+    std::vector<math::vec2<T>> const queries = build_queries<T>(walk, 100);
+    for (auto _ : state)
+    {
+        T sum = T(0);
+        for (math::vec2<T> const& query : queries)
+        {
+            sum += walk.dist_squared(query);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+template <typename T>
+static void edge_bvh_nearest(benchmark::State& state)
+{
+    geom::polyline2<T> const walk = build_walk<T>(static_cast<size_t>(state.range(0)));
+    edge_bvh<T, 2> const tree(walk);
+    std::vector<math::vec2<T>> const queries = build_queries<T>(walk, 100);
+    for (auto _ : state)
+    {
+        T sum = T(0);
+        for (math::vec2<T> const& query : queries)
+        {
+            sum += tree.nearest(query)->dist_squared;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+BENCHMARK(polyline_dist_squared<float>)->Arg(1000)->Arg(100000);
+BENCHMARK(edge_bvh_nearest<float>)->Arg(1000)->Arg(100000);
+BENCHMARK(polyline_dist_squared<double>)->Arg(1000)->Arg(100000);
+BENCHMARK(edge_bvh_nearest<double>)->Arg(1000)->Arg(100000);
+
+} // namespace stf::spatial
\ No newline at end of file
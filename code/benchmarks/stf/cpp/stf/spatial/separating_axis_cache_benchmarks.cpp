@@ -0,0 +1,103 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/separating_axis_cache.hpp>
+#include <stf/spatial/sweep_and_prune.hpp>
+
+namespace stf::spatial
+{
+
+template <typename T>
+struct scene final
+{
+    std::vector<geom::obb3<T>> boxes;
+    std::vector<math::vec3<T>> velocities;
+    std::vector<index_pair> candidates;
+
+    // translate each box by a small amount so that consecutive frames are coherent but not identical
+    void step(size_t const frame)
+    {
+        T const sign = (frame % 64 < 32) ? T(1) : T(-1);
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            geom::obb3<T> const& box = boxes[i];
+            boxes[i] = geom::obb3<T>(box.center() + sign * velocities[i], box.basis(), box.half_extents());
+        }
+    }
+};
+
+template <typename T>
+static scene<T> build_scene(size_t const count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(0), T(100));
+    std::uniform_real_distribution<T> extent(T(0.5), T(2));
+    std::uniform_real_distribution<T> angle(T(0), math::constants<T>::two_pi);
+    std::uniform_real_distribution<T> velocity(T(-0.01), T(0.01));
+    scene<T> result;
+    std::vector<geom::aabb3<T>> bounds;
+    for (size_t i = 0; i < count; ++i)
+    {
+        math::vec3<T> const axis = math::normalized(math::vec3<T>(angle(gen), angle(gen), angle(gen)));
+        math::mtx<T, 3> const rotation = math::rotate(axis, angle(gen)).prefix();
+        math::vec3<T> const center(position(gen), position(gen), position(gen));
+        geom::obb3<T> const box(center, rotation, math::vec3<T>(extent(gen), extent(gen), extent(gen)));
+        result.boxes.push_back(box);
+        result.velocities.push_back(math::vec3<T>(velocity(gen), velocity(gen), velocity(gen)));
+
+        // pad the bounds so that the candidates remain valid as the boxes move
+        geom::aabb3<T> bound = geom::aabb3<T>::nothing();
+        for (size_t v = 0; v < geom::obb3<T>::vertex_count(); ++v)
+        {
+            bound.fit(box.vertex(v));
+        }
+        bounds.push_back(geom::aabb3<T>(bound.min - math::vec3<T>(T(0.1)), bound.max + math::vec3<T>(T(0.1))));
+    }
+    overlapping_pairs<T, 3>(bounds, result.candidates);
+    return result;
+}
+
+template <typename T>
+static void obb_pairs_uncached(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    size_t frame = 0;
+    for (auto _ : state)
+    {
+        input.step(frame++);
+        size_t count = 0;
+        for (index_pair const& pair : input.candidates)
+        {
+            count += geom::intersects(input.boxes[pair.first], input.boxes[pair.second]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * input.candidates.size());
+}
+
+template <typename T>
+static void obb_pairs_cached(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    separating_axis_cache<T> cache;
+    std::vector<index_pair> intersecting;
+    size_t frame = 0;
+    for (auto _ : state)
+    {
+        input.step(frame++);
+        cache.intersecting_pairs(input.boxes, input.candidates, intersecting);
+        benchmark::DoNotOptimize(intersecting.size());
+    }
+    state.SetItemsProcessed(state.iterations() * input.candidates.size());
+    state.counters["hit_rate"] = static_cast<double>(cache.hits()) / static_cast<double>(cache.hits() + cache.misses());
+}
+
+BENCHMARK(obb_pairs_uncached<float>)->Arg(20000);
+BENCHMARK(obb_pairs_cached<float>)->Arg(20000);
+BENCHMARK(obb_pairs_uncached<double>)->Arg(20000);
+BENCHMARK(obb_pairs_cached<double>)->Arg(20000);
+
+} // namespace stf::spatial
\ No newline at end of file
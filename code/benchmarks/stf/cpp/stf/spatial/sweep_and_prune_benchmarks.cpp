@@ -0,0 +1,92 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/sweep_and_prune.hpp>
+
+namespace stf::spatial
+{
+
+template <typename T>
+struct scene final
+{
+    std::vector<geom::aabb3<T>> boxes;
+    std::vector<math::vec3<T>> velocities;
+
+    // advance the boxes by one frame (bouncing off the walls of the scene)
+    void step()
+    {
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            for (size_t d = 0; d < 3; ++d)
+            {
+                if (boxes[i].min[d] + velocities[i][d] < T(0) || boxes[i].max[d] + velocities[i][d] > T(200))
+                {
+                    velocities[i][d] = -velocities[i][d];
+                }
+            }
+            boxes[i].min += velocities[i];
+            boxes[i].max += velocities[i];
+        }
+    }
+};
+
+template <typename T>
+static scene<T> build_scene(size_t const count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> position(T(0), T(198));
+    std::uniform_real_distribution<T> size(T(0.5), T(2));
+    std::uniform_real_distribution<T> velocity(T(-0.05), T(0.05));
+    scene<T> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        math::vec3<T> const min(position(gen), position(gen), position(gen));
+        result.boxes.push_back(geom::aabb3<T>(min, min + math::vec3<T>(size(gen), size(gen), size(gen))));
+        result.velocities.push_back(math::vec3<T>(velocity(gen), velocity(gen), velocity(gen)));
+    }
+    return result;
+}
+
+template <typename T>
+static void sweep_and_prune_incremental(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    size_t const threads = static_cast<size_t>(state.range(1));
+    sweep_and_prune<T, 3> sap(input.boxes, threads);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        input.step();
+        state.ResumeTiming();
+        sap.update(input.boxes, threads);
+        benchmark::DoNotOptimize(sap.pairs().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void sweep_and_prune_full(benchmark::State& state)
+{
+    scene<T> input = build_scene<T>(static_cast<size_t>(state.range(0)));
+    size_t const threads = static_cast<size_t>(state.range(1));
+    std::vector<index_pair> pairs;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        input.step();
+        state.ResumeTiming();
+        overlapping_pairs<T, 3>(input.boxes, pairs, threads);
+        benchmark::DoNotOptimize(pairs.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sweep_and_prune_incremental<float>)->Args({50000, 1})->Args({50000, 3});
+BENCHMARK(sweep_and_prune_incremental<double>)->Args({50000, 1})->Args({50000, 3});
+BENCHMARK(sweep_and_prune_full<float>)->Args({50000, 1})->Args({50000, 4});
+BENCHMARK(sweep_and_prune_full<double>)->Args({50000, 1})->Args({50000, 4});
+
+} // namespace stf::spatial
\ No newline at end of file
@@ -0,0 +1,810 @@
+#ifndef STF_ALG_BOOLEAN_HPP_HEADER_GUARD
+#define STF_ALG_BOOLEAN_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "stf/enums.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/geom/prepared_polygon.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/bvh.hpp"
+
+/**
+ * @file boolean.hpp
+ * @brief A file containing boolean operations (eg union and intersection) on sets of polygons
+ */
+
+namespace stf::alg
+{
+
+/// @cond DELETED
+namespace guts
+{
+
+// a directed edge along with the change in the winding number of each operand when crossing it from right to left
+template <typename T>
+struct boolean_edge final
+{
+    math::vec2<T> a;
+    math::vec2<T> b;
+    std::array<int32_t, 2> winding;
+};
+
+// an edge between two (sorted, unique) vertices
+struct boolean_link final
+{
+    size_t from;
+    size_t to;
+    std::array<int32_t, 2> winding;
+};
+
+// exact equality of vertices (math::vec::operator== uses a tolerance, which would merge distinct vertices)
+template <typename T>
+inline bool identical(math::vec2<T> const& lhs, math::vec2<T> const& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+// appends the edges of a ring oriented so that hulls are counterclockwise and holes are clockwise
+template <typename T>
+void append_ring(geom::polygon<T> const& ring, bool const hole, size_t const operand,
+                 std::vector<boolean_edge<T>>& edges)
+{
+    size_t const size = ring.size();
+    if (size < 3)
+    {
+        return;
+    }
+
+    bool const reverse = (ring.signed_area() < math::constants<T>::zero) != hole;
+    for (size_t i = 0; i < size; ++i)
+    {
+        math::vec2<T> a = ring[i];
+        math::vec2<T> b = ring[(i + 1) % size];
+        if (!identical(a, b))
+        {
+            boolean_edge<T> edge = {reverse ? b : a, reverse ? a : b, {0, 0}};
+            edge.winding[operand] = 1;
+            edges.push_back(edge);
+        }
+    }
+}
+
+template <typename T>
+void append_rings(std::span<geom::polygon<T> const> const polygons, size_t const operand,
+                  std::vector<boolean_edge<T>>& edges)
+{
+    for (geom::polygon<T> const& polygon : polygons)
+    {
+        append_ring(polygon, false, operand, edges);
+    }
+}
+
+template <typename T>
+void append_rings(std::span<geom::holygon<T> const> const holygons, size_t const operand,
+                  std::vector<boolean_edge<T>>& edges)
+{
+    for (geom::holygon<T> const& holygon : holygons)
+    {
+        if (!holygon.hull().is_empty())
+        {
+            append_ring(holygon.hull(), false, operand, edges);
+            for (geom::polygon<T> const& hole : holygon.holes())
+            {
+                append_ring(hole, true, operand, edges);
+            }
+        }
+    }
+}
+
+// splits the edges so that they only meet at shared endpoints. an edge is split where an endpoint of another edge
+// touches it (which also handles collinear overlaps) and where it properly crosses another edge. candidate pairs are
+// the edges whose bounds overlap, which are found with a bvh so edges that are far apart are never tested against each
+// other. a rounded crossing point can be slightly off the edges it was computed from, so the new pieces are tested
+// again (for a fixed number of rounds) to catch crossings that were introduced by rounding
+template <typename T>
+std::vector<boolean_edge<T>> split(std::vector<boolean_edge<T>> const& edges)
+{
+    size_t constexpr c_max_rounds = 4;
+
+    // the pieces of edge e are pieces[first[e], first[e + 1]) and each piece lies in the bounds of its edge
+    std::vector<boolean_edge<T>> pieces = edges;
+    std::vector<size_t> first(edges.size() + 1);
+    for (size_t e = 0; e < first.size(); ++e)
+    {
+        first[e] = e;
+    }
+    std::vector<bool> fresh(pieces.size(), true); // pieces that have not been tested against each other
+
+    std::vector<geom::aabb2<T>> boxes;
+    boxes.reserve(edges.size());
+    for (boolean_edge<T> const& edge : edges)
+    {
+        boxes.push_back(geom::aabb2<T>::nothing().fit(edge.a).fit(edge.b));
+    }
+    spatial::bvh<T, 2> const tree(boxes);
+
+    // records a split when a point that is collinear with a piece lies strictly between its endpoints
+    std::vector<std::pair<size_t, math::vec2<T>>> splits;
+    auto split_at = [&](size_t const target, math::vec2<T> const& point)
+    {
+        math::vec2<T> const delta = pieces[target].b - pieces[target].a;
+        T const t = math::dot(point - pieces[target].a, delta);
+        if (math::constants<T>::zero < t && t < math::dot(delta, delta))
+        {
+            splits.push_back({target, point});
+        }
+    };
+
+    auto test = [&](size_t const i, size_t const j)
+    {
+        boolean_edge<T> const& e = pieces[i];
+        boolean_edge<T> const& f = pieces[j];
+        T const o1 = math::orientation(e.a, e.b, f.a);
+        T const o2 = math::orientation(e.a, e.b, f.b);
+        T const o3 = math::orientation(f.a, f.b, e.a);
+        T const o4 = math::orientation(f.a, f.b, e.b);
+
+        // endpoints that touch the other piece (this also handles collinear overlaps)
+        T const zero = math::constants<T>::zero;
+        if (o1 == zero)
+        {
+            split_at(i, f.a);
+        }
+        if (o2 == zero)
+        {
+            split_at(i, f.b);
+        }
+        if (o3 == zero)
+        {
+            split_at(j, e.a);
+        }
+        if (o4 == zero)
+        {
+            split_at(j, e.b);
+        }
+
+        // proper crossings are split at the same point on both pieces so the pieces share a vertex. the point is
+        // clamped to the bounds of both pieces (which contain the exact crossing) so pieces stay in the bounds of their
+        // edges
+        bool const straddles_e = (o1 < zero && zero < o2) || (o2 < zero && zero < o1);
+        bool const straddles_f = (o3 < zero && zero < o4) || (o4 < zero && zero < o3);
+        if (straddles_e && straddles_f)
+        {
+            math::vec2<T> point = e.a + (o3 / (o3 - o4)) * (e.b - e.a);
+            for (size_t d = 0; d < 2; ++d)
+            {
+                T const lo = std::max(std::min(e.a[d], e.b[d]), std::min(f.a[d], f.b[d]));
+                T const hi = std::min(std::max(e.a[d], e.b[d]), std::max(f.a[d], f.b[d]));
+                point[d] = std::clamp(point[d], lo, hi);
+            }
+            split_at(i, point);
+            split_at(j, point);
+        }
+    };
+
+    for (size_t round = 0; round < c_max_rounds; ++round)
+    {
+        // test each fresh piece against the pieces of the edges whose bounds overlap it (pairs of fresh pieces are
+        // only tested once and pairs of old pieces were tested in a previous round)
+        splits.clear();
+        for (size_t i = 0; i < pieces.size(); ++i)
+        {
+            if (fresh[i])
+            {
+                geom::aabb2<T> const box = geom::aabb2<T>::nothing().fit(pieces[i].a).fit(pieces[i].b);
+                tree.find(box,
+                          [&](size_t const e)
+                          {
+                              for (size_t j = first[e]; j < first[e + 1]; ++j)
+                              {
+                                  if (j != i && (!fresh[j] || i < j))
+                                  {
+                                      test(i, j);
+                                  }
+                              }
+                          });
+            }
+        }
+        if (splits.empty())
+        {
+            break;
+        }
+
+        auto param = [&](std::pair<size_t, math::vec2<T>> const& point)
+        { return math::dot(point.second - pieces[point.first].a, pieces[point.first].b - pieces[point.first].a); };
+        std::sort(splits.begin(), splits.end(), [&](auto const& lhs, auto const& rhs)
+                  { return lhs.first < rhs.first || (lhs.first == rhs.first && param(lhs) < param(rhs)); });
+
+        // replace each piece that has splits with its sub-pieces (which are fresh)
+        std::vector<boolean_edge<T>> next;
+        std::vector<bool> next_fresh;
+        next.reserve(pieces.size() + splits.size());
+        next_fresh.reserve(pieces.size() + splits.size());
+        auto append = [&](math::vec2<T> const& a, math::vec2<T> const& b, std::array<int32_t, 2> const& winding)
+        {
+            if (!identical(a, b))
+            {
+                next.push_back(boolean_edge<T>{a, b, winding});
+                next_fresh.push_back(true);
+            }
+        };
+        size_t cursor = 0;
+        for (size_t e = 0; e < edges.size(); ++e)
+        {
+            size_t const begin = next.size();
+            for (size_t i = first[e]; i < first[e + 1]; ++i)
+            {
+                if (cursor < splits.size() && splits[cursor].first == i)
+                {
+                    math::vec2<T> a = pieces[i].a;
+                    for (; cursor < splits.size() && splits[cursor].first == i; ++cursor)
+                    {
+                        append(a, splits[cursor].second, pieces[i].winding);
+                        a = splits[cursor].second;
+                    }
+                    append(a, pieces[i].b, pieces[i].winding);
+                }
+                else
+                {
+                    next.push_back(pieces[i]);
+                    next_fresh.push_back(false);
+                }
+            }
+            first[e] = begin;
+        }
+        first[edges.size()] = next.size();
+        pieces = std::move(next);
+        fresh = std::move(next_fresh);
+    }
+    return pieces;
+}
+
+// finds the link that is directly below a vertex: the highest link below the vertex that crosses the vertical line an
+// infinitesimal distance to the right of the vertex. the links must be non-vertical, be directed in +x, and only meet
+// at endpoints. returns links.size() if there is no such link
+template <typename T>
+size_t below(std::vector<math::vec2<T>> const& vertices, std::vector<boolean_link> const& links,
+             spatial::bvh<T, 2> const& tree, math::vec2<T> const& point)
+{
+    size_t best = links.size();
+    T best_y = math::constants<T>::neg_inf;
+    T best_slope = math::constants<T>::neg_inf;
+    if (tree.empty())
+    {
+        return best;
+    }
+
+    spatial::traversal_stack<size_t> stack(tree.root());
+    while (!stack.empty())
+    {
+        size_t const index = stack.pop();
+
+        geom::aabb2<T> const& bounds = tree.bounds(index);
+        if (point.x < bounds.min.x || bounds.max.x <= point.x || point.y <= bounds.min.y ||
+            (best < links.size() && bounds.max.y < best_y))
+        {
+            continue;
+        }
+
+        auto const& n = tree.node(index);
+        if (n.is_leaf())
+        {
+            for (size_t i = n.first; i < n.first + n.count; ++i)
+            {
+                size_t const l = tree.primitive(i);
+                math::vec2<T> const& a = vertices[links[l].from];
+                math::vec2<T> const& b = vertices[links[l].to];
+                if (a.x <= point.x && point.x < b.x)
+                {
+                    T const slope = (b.y - a.y) / (b.x - a.x);
+                    T const y = (a.x == point.x) ? a.y : a.y + (point.x - a.x) * slope;
+                    if (y < point.y && (best == links.size() || best_y < y || (best_y == y && best_slope < slope)))
+                    {
+                        best = l;
+                        best_y = y;
+                        best_slope = slope;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // visit the higher child first since it is more likely to contain the link directly below the point
+            size_t const lower = index + 1;
+            size_t const upper = n.first;
+            bool const swap = tree.bounds(lower).max.y > tree.bounds(upper).max.y;
+            stack.push(swap ? upper : lower);
+            stack.push(swap ? lower : upper);
+        }
+    }
+    return best;
+}
+
+// computes the winding numbers on the left of each link (from -> to) by walking the faces of the planar graph formed by
+// the links. crossing a link changes the winding numbers by the winding of the link so the winding numbers of all the
+// faces in a connected component follow from the winding numbers of a single face. that face is the one to the left
+// of the leftmost vertex of the component, and its winding numbers are found from the link directly below the vertex
+template <typename T>
+std::vector<std::array<int32_t, 2>> left_windings(std::vector<math::vec2<T>> const& vertices,
+                                                  std::vector<boolean_link> const& links)
+{
+    // half-edge 2i runs from -> to along link i and half-edge 2i + 1 runs to -> from
+    size_t const count = 2 * links.size();
+    auto origin = [&](size_t const h) { return (h % 2 == 0) ? links[h / 2].from : links[h / 2].to; };
+    auto target = [&](size_t const h) { return (h % 2 == 0) ? links[h / 2].to : links[h / 2].from; };
+    auto angle = [&](size_t const h)
+    {
+        math::vec2<T> const delta = vertices[target(h)] - vertices[origin(h)];
+        return std::atan2(delta.y, delta.x);
+    };
+
+    // sort the outgoing half-edges of each vertex counterclockwise
+    std::vector<size_t> outgoing(count);
+    for (size_t h = 0; h < count; ++h)
+    {
+        outgoing[h] = h;
+    }
+    std::vector<std::pair<size_t, T>> keys(count);
+    for (size_t h = 0; h < count; ++h)
+    {
+        keys[h] = std::make_pair(origin(h), angle(h));
+    }
+    std::sort(outgoing.begin(), outgoing.end(),
+              [&](size_t const lhs, size_t const rhs) { return keys[lhs] < keys[rhs]; });
+    std::vector<size_t> starts(vertices.size() + 1, 0);
+    std::vector<size_t> position(count);
+    for (size_t k = 0; k < count; ++k)
+    {
+        ++starts[origin(outgoing[k]) + 1];
+        position[outgoing[k]] = k;
+    }
+    for (size_t v = 0; v < vertices.size(); ++v)
+    {
+        starts[v + 1] += starts[v];
+    }
+
+    // the face on the left of a half-edge continues along the first outgoing half-edge clockwise from its twin
+    auto next = [&](size_t const h)
+    {
+        size_t const twin = h ^ 1;
+        size_t const v = origin(twin);
+        size_t const k = position[twin];
+        return outgoing[(k == starts[v]) ? starts[v + 1] - 1 : k - 1];
+    };
+
+    std::vector<size_t> faces(count, count);
+    std::vector<size_t> members;     // half-edges grouped by face
+    std::vector<size_t> face_starts; // face f has the half-edges in [face_starts[f], face_starts[f + 1])
+    for (size_t h = 0; h < count; ++h)
+    {
+        if (faces[h] == count)
+        {
+            face_starts.push_back(members.size());
+            for (size_t current = h; faces[current] == count; current = next(current))
+            {
+                faces[current] = face_starts.size() - 1;
+                members.push_back(current);
+            }
+        }
+    }
+    face_starts.push_back(members.size());
+
+    // the bounds of the non-vertical links for finding the link directly below a vertex
+    std::vector<geom::aabb2<T>> boxes;
+    std::vector<size_t> sloped;
+    for (size_t i = 0; i < links.size(); ++i)
+    {
+        if (vertices[links[i].from].x < vertices[links[i].to].x)
+        {
+            boxes.push_back(geom::aabb2<T>::nothing().fit(vertices[links[i].from]).fit(vertices[links[i].to]));
+            sloped.push_back(i);
+        }
+    }
+    spatial::bvh<T, 2> const tree(boxes);
+    std::vector<boolean_link> sloped_links;
+    sloped_links.reserve(sloped.size());
+    for (size_t const i : sloped)
+    {
+        sloped_links.push_back(links[i]);
+    }
+
+    // vertices are sorted by (x, y) so the first vertex reached in each component is its leftmost (then lowest) vertex.
+    // the face to its left is the face on the left of its outgoing half-edge with the largest angle. that face also
+    // contains the points just below the vertex, so its winding numbers are those above the link directly below the
+    // vertex (or zero if there is none). that link belongs to a component with a vertex that precedes the seed, so the
+    // winding numbers of its faces are already known
+    std::vector<std::array<int32_t, 2>> face_windings(face_starts.size() - 1, {0, 0});
+    std::vector<bool> reached(vertices.size(), false);
+    std::vector<bool> visited(face_starts.size() - 1, false);
+    std::vector<size_t> stack;
+    for (size_t v = 0; v < vertices.size(); ++v)
+    {
+        if (reached[v] || starts[v] == starts[v + 1])
+        {
+            continue;
+        }
+
+        // mark the component of the seed as reached
+        reached[v] = true;
+        stack.push_back(v);
+        while (!stack.empty())
+        {
+            size_t const u = stack.back();
+            stack.pop_back();
+            for (size_t k = starts[u]; k < starts[u + 1]; ++k)
+            {
+                size_t const w = target(outgoing[k]);
+                if (!reached[w])
+                {
+                    reached[w] = true;
+                    stack.push_back(w);
+                }
+            }
+        }
+
+        // links are directed in +x so the points above a link are on its left
+        size_t const seed = faces[outgoing[starts[v + 1] - 1]];
+        size_t const l = below(vertices, sloped_links, tree, vertices[v]);
+        face_windings[seed] = (l < sloped.size()) ? face_windings[faces[2 * sloped[l]]] : std::array<int32_t, 2>{0, 0};
+
+        // propagate the winding numbers from the seed face across the links
+        visited[seed] = true;
+        stack.push_back(seed);
+        while (!stack.empty())
+        {
+            size_t const f = stack.back();
+            stack.pop_back();
+            for (size_t m = face_starts[f]; m < face_starts[f + 1]; ++m)
+            {
+                size_t const h = members[m];
+                size_t const g = faces[h ^ 1];
+                if (!visited[g])
+                {
+                    // the twin's left is the right of h: left(h) - winding for h along the link (and + otherwise)
+                    int32_t const sign = (h % 2 == 0) ? -1 : 1;
+                    std::array<int32_t, 2> const& winding = links[h / 2].winding;
+                    face_windings[g][0] = face_windings[f][0] + sign * winding[0];
+                    face_windings[g][1] = face_windings[f][1] + sign * winding[1];
+                    visited[g] = true;
+                    stack.push_back(g);
+                }
+            }
+        }
+    }
+
+    std::vector<std::array<int32_t, 2>> windings(links.size());
+    for (size_t i = 0; i < links.size(); ++i)
+    {
+        windings[i] = face_windings[faces[2 * i]];
+    }
+    return windings;
+}
+
+inline bool inside(boolean_types const type, std::array<int32_t, 2> const& winding)
+{
+    bool const lhs = winding[0] != 0;
+    bool const rhs = winding[1] != 0;
+    switch (type)
+    {
+        case boolean_types::unite: return lhs || rhs;
+        case boolean_types::intersect: return lhs && rhs;
+        case boolean_types::subtract: return lhs && !rhs;
+        case boolean_types::exclusive_or: return lhs != rhs;
+    }
+    return false;
+}
+
+// traces the directed result edges (interior on the left) into rings. at a vertex with several outgoing edges, the next
+// edge is the first one clockwise from the incoming edge which keeps rings that touch at a vertex separate
+template <typename T>
+std::vector<geom::polygon<T>> trace(std::vector<math::vec2<T>> const& vertices,
+                                    std::vector<std::pair<size_t, size_t>> edges)
+{
+    std::sort(edges.begin(), edges.end());
+    std::vector<size_t> starts(vertices.size() + 1, 0);
+    for (std::pair<size_t, size_t> const& edge : edges)
+    {
+        ++starts[edge.first + 1];
+    }
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        starts[i + 1] += starts[i];
+    }
+
+    std::vector<geom::polygon<T>> rings;
+    std::vector<bool> used(edges.size(), false);
+    std::vector<math::vec2<T>> ring;
+    for (size_t start = 0; start < edges.size(); ++start)
+    {
+        if (used[start])
+        {
+            continue;
+        }
+
+        ring.clear();
+        size_t current = start;
+        while (true)
+        {
+            used[current] = true;
+            ring.push_back(vertices[edges[current].first]);
+
+            size_t const from = edges[current].first;
+            size_t const to = edges[current].second;
+            math::vec2<T> const back = vertices[from] - vertices[to];
+            size_t best = edges.size();
+            T best_angle = math::constants<T>::pos_inf;
+            for (size_t k = starts[to]; k < starts[to + 1]; ++k)
+            {
+                math::vec2<T> const out = vertices[edges[k].second] - vertices[to];
+                T angle = std::atan2(-math::cross(back, out), math::dot(back, out));
+                angle += (angle <= math::constants<T>::zero) ? math::constants<T>::two_pi : math::constants<T>::zero;
+                if (angle < best_angle)
+                {
+                    best = k;
+                    best_angle = angle;
+                }
+            }
+
+            if (best == start || best == edges.size() || used[best])
+            {
+                break;
+            }
+            current = best;
+        }
+
+        // remove vertices in the middle of straight runs (left over from splitting edges)
+        std::vector<math::vec2<T>> simplified;
+        for (size_t i = 0; i < ring.size(); ++i)
+        {
+            math::vec2<T> const& prev = simplified.empty() ? ring.back() : simplified.back();
+            if (math::orientation(prev, ring[i], ring[(i + 1) % ring.size()]) != math::constants<T>::zero)
+            {
+                simplified.push_back(ring[i]);
+            }
+        }
+        if (simplified.size() >= 3)
+        {
+            rings.push_back(geom::polygon<T>(simplified));
+        }
+    }
+    return rings;
+}
+
+// groups counterclockwise hulls and clockwise holes into holygons by assigning each hole to the smallest hull that
+// contains it. hulls are only indexed for containment queries (which are then logarithmic) once a hole is tested
+// against them, so a large hull with many holes does not cost a linear scan of the hull per hole
+template <typename T>
+std::vector<geom::holygon<T>> assemble(std::vector<geom::polygon<T>> const& rings)
+{
+    std::vector<geom::polygon<T>> hulls;
+    std::vector<geom::polygon<T> const*> holes;
+    for (geom::polygon<T> const& ring : rings)
+    {
+        T const area = ring.signed_area();
+        if (area > math::constants<T>::zero)
+        {
+            hulls.push_back(ring);
+        }
+        else if (area < math::constants<T>::zero)
+        {
+            holes.push_back(&ring);
+        }
+    }
+
+    std::vector<geom::aabb2<T>> boxes;
+    std::vector<T> areas;
+    for (geom::polygon<T> const& hull : hulls)
+    {
+        boxes.push_back(hull.aabb());
+        areas.push_back(hull.area());
+    }
+    spatial::bvh<T, 2> const tree(boxes);
+    std::vector<std::optional<geom::prepared_polygon<T>>> prepared(hulls.size());
+
+    std::vector<std::vector<geom::polygon<T>>> assigned(hulls.size());
+    for (geom::polygon<T> const* hole : holes)
+    {
+        // hulls and holes never share an edge so the midpoint of an edge of the hole is not on the boundary of a hull
+        math::vec2<T> const point = math::constants<T>::half * ((*hole)[0] + (*hole)[1]);
+        size_t best = hulls.size();
+        tree.find(geom::aabb2<T>(point, point),
+                  [&](size_t const i)
+                  {
+                      if (best == hulls.size() || areas[i] < areas[best])
+                      {
+                          if (!prepared[i])
+                          {
+                              prepared[i].emplace(hulls[i]);
+                          }
+                          if (prepared[i]->contains(point, boundary_types::closed))
+                          {
+                              best = i;
+                          }
+                      }
+                  });
+        if (best < hulls.size())
+        {
+            assigned[best].push_back(*hole);
+        }
+    }
+
+    std::vector<geom::holygon<T>> result;
+    result.reserve(hulls.size());
+    for (size_t i = 0; i < hulls.size(); ++i)
+    {
+        result.push_back(geom::holygon<T>(hulls[i], assigned[i]));
+    }
+    return result;
+}
+
+template <typename T>
+std::vector<geom::holygon<T>> boolean(std::vector<boolean_edge<T>> const& edges, boolean_types const type)
+{
+    // split the edges so that they only meet at endpoints
+    std::vector<boolean_edge<T>> const pieces = split(edges);
+
+    // identify vertices by their coordinates (endpoint 2i is the start of piece i and endpoint 2i + 1 is its end)
+    auto endpoint = [&](size_t const e) -> math::vec2<T> const&
+    { return (e % 2 == 0) ? pieces[e / 2].a : pieces[e / 2].b; };
+    std::vector<size_t> endpoints(2 * pieces.size());
+    for (size_t e = 0; e < endpoints.size(); ++e)
+    {
+        endpoints[e] = e;
+    }
+    std::sort(endpoints.begin(), endpoints.end(),
+              [&](size_t const lhs, size_t const rhs)
+              {
+                  math::vec2<T> const& l = endpoint(lhs);
+                  math::vec2<T> const& r = endpoint(rhs);
+                  return l.x < r.x || (l.x == r.x && l.y < r.y);
+              });
+    std::vector<math::vec2<T>> vertices;
+    std::vector<size_t> ids(endpoints.size());
+    for (size_t const e : endpoints)
+    {
+        if (vertices.empty() || !identical(vertices.back(), endpoint(e)))
+        {
+            vertices.push_back(endpoint(e));
+        }
+        ids[e] = vertices.size() - 1;
+    }
+
+    // merge coincident pieces (from shared or overlapping edges) and drop those that do not change either winding
+    std::vector<boolean_link> links;
+    links.reserve(pieces.size());
+    for (size_t i = 0; i < pieces.size(); ++i)
+    {
+        size_t const from = ids[2 * i];
+        size_t const to = ids[2 * i + 1];
+        int32_t const sign = (from < to) ? 1 : -1;
+        links.push_back(boolean_link{std::min(from, to), std::max(from, to),
+                                     {sign * pieces[i].winding[0], sign * pieces[i].winding[1]}});
+    }
+    std::sort(links.begin(), links.end(), [](boolean_link const& lhs, boolean_link const& rhs)
+              { return lhs.from < rhs.from || (lhs.from == rhs.from && lhs.to < rhs.to); });
+    size_t count = 0;
+    for (size_t i = 0; i < links.size();)
+    {
+        boolean_link merged = links[i];
+        for (++i; i < links.size() && links[i].from == merged.from && links[i].to == merged.to; ++i)
+        {
+            merged.winding[0] += links[i].winding[0];
+            merged.winding[1] += links[i].winding[1];
+        }
+        if (merged.winding[0] != 0 || merged.winding[1] != 0)
+        {
+            links[count++] = merged;
+        }
+    }
+    links.resize(count);
+
+    // links that separate the inside of the result from the outside are directed so that the inside is on the left
+    std::vector<std::array<int32_t, 2>> const windings = left_windings(vertices, links);
+    std::vector<std::pair<size_t, size_t>> boundary;
+    for (size_t i = 0; i < links.size(); ++i)
+    {
+        boolean_link const& link = links[i];
+        std::array<int32_t, 2> const& left = windings[i];
+        std::array<int32_t, 2> const right = {left[0] - link.winding[0], left[1] - link.winding[1]};
+        bool const inside_left = inside(type, left);
+        if (inside_left != inside(type, right))
+        {
+            boundary.push_back(inside_left ? std::make_pair(link.from, link.to) : std::make_pair(link.to, link.from));
+        }
+    }
+
+    return assemble(trace(vertices, boundary));
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Compute a boolean operation (eg union or intersection) of two sets of holygons
+ *
+ * A point is inside an operand if it is inside any of the holygons in the operand, so overlapping holygons in a single
+ * operand are merged (eg the union of a set with an empty set dissolves the boundaries between its members). Every edge
+ * is split where it touches or crosses another edge and coincident pieces are merged, so shared edges, T-junctions,
+ * and vertices that touch are handled. The winding number of each operand in each face of the resulting planar graph
+ * is found by walking across the pieces from a single face per connected component (whose winding numbers come from
+ * the link directly below the component), and the pieces that separate the inside of the result from the outside are
+ * traced into rings.
+ *
+ * Only edges whose bounds overlap are tested against each other (the candidates are found with a bvh), so sets of
+ * features that are side by side cost O(n log n) rather than O(n^2). The remaining steps are O((n + k) log n) in
+ * practice where k is the number of splits: the link directly below each component is found with a branch and bound
+ * search of a bvh and the hull that contains each hole is found with prepared polygons.
+ *
+ * Crossings are computed in floating point. A rounded crossing point can land slightly off the edges it was computed
+ * from and create new crossings, so the new pieces are checked again (against the candidates from the same bvh) for
+ * up to four rounds. Crossings that are still
+ * created by rounding after that (which requires pathological, nearly parallel edges) are not resolved and may produce
+ * slivers or incorrectly classified faces near them.
+ * @tparam T Number type (eg float)
+ * @param [in] lhs
+ * @param [in] rhs
+ * @param [in] type The boolean operation to apply
+ * @return The result as a set of disjoint holygons (hulls are counterclockwise and holes are clockwise)
+ */
+template <typename T>
+std::vector<geom::holygon<T>> boolean(std::span<geom::holygon<T> const> const lhs,
+                                      std::span<geom::holygon<T> const> const rhs, boolean_types const type)
+{
+    std::vector<guts::boolean_edge<T>> edges;
+    guts::append_rings(lhs, 0, edges);
+    guts::append_rings(rhs, 1, edges);
+    return guts::boolean(edges, type);
+}
+
+/**
+ * @brief Compute a boolean operation (eg union or intersection) of two sets of polygons
+ *
+ * See @ref boolean for sets of holygons.
+ * @tparam T Number type (eg float)
+ * @param [in] lhs
+ * @param [in] rhs
+ * @param [in] type The boolean operation to apply
+ * @return The result as a set of disjoint holygons (hulls are counterclockwise and holes are clockwise)
+ */
+template <typename T>
+std::vector<geom::holygon<T>> boolean(std::span<geom::polygon<T> const> const lhs,
+                                      std::span<geom::polygon<T> const> const rhs, boolean_types const type)
+{
+    std::vector<guts::boolean_edge<T>> edges;
+    guts::append_rings(lhs, 0, edges);
+    guts::append_rings(rhs, 1, edges);
+    return guts::boolean(edges, type);
+}
+
+/**
+ * @brief Compute a boolean operation (eg union or intersection) of two holygons
+ *
+ * See @ref boolean for sets of holygons.
+ * @tparam T Number type (eg float)
+ * @param [in] lhs
+ * @param [in] rhs
+ * @param [in] type The boolean operation to apply
+ * @return The result as a set of disjoint holygons (hulls are counterclockwise and holes are clockwise)
+ */
+template <typename T>
+std::vector<geom::holygon<T>> boolean(geom::holygon<T> const& lhs, geom::holygon<T> const& rhs,
+                                      boolean_types const type)
+{
+    return boolean(std::span<geom::holygon<T> const>(&lhs, 1), std::span<geom::holygon<T> const>(&rhs, 1), type);
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
@@ -1,8 +1,20 @@
 #ifndef STF_ALG_CLIPPING_HPP_HEADER_GUARD
 #define STF_ALG_CLIPPING_HPP_HEADER_GUARD
 
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
+#include "stf/cam/frustum.hpp"
+#include "stf/enums.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
 #include "stf/geom/segment.hpp"
 #include "stf/geom/polyline.hpp"
+#include "stf/math/matrix.hpp"
+#include "stf/math/vector.hpp"
 
 /**
  * @file clipping.hpp
@@ -48,12 +60,238 @@ region_code code(geom::aabb2<T> const& box, math::vec2<T> const& point)
     return static_cast<region_code>(x | y);
 }
 
+// appends a vertex unless it repeats the previous vertex (which happens when a vertex lies on a clipping line)
+template <typename T>
+inline void append(std::vector<math::vec2<T>>& output, math::vec2<T> const& vertex)
+{
+    if (output.empty() || output.back() != vertex)
+    {
+        output.push_back(vertex);
+    }
+}
+
+// clips a ring against the half-plane of points whose coordinate on axis is on the inside of bound, appending to output
+template <typename T, bool is_min>
+void clip_ring(std::span<math::vec2<T> const> const input, size_t const axis, T const bound,
+               std::vector<math::vec2<T>>& output)
+{
+    auto inside = [=](math::vec2<T> const& point) { return is_min ? bound <= point[axis] : point[axis] <= bound; };
+
+    size_t const begin = output.size();
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        math::vec2<T> const& a = input[(i + input.size() - 1) % input.size()];
+        math::vec2<T> const& b = input[i];
+        bool const a_inside = inside(a);
+        bool const b_inside = inside(b);
+        if (a_inside != b_inside)
+        {
+            // snap the crossing onto the clipping line so later planes see it exactly on the boundary
+            math::vec2<T> crossing = a + ((bound - a[axis]) / (b[axis] - a[axis])) * (b - a);
+            crossing[axis] = bound;
+            append(output, crossing);
+        }
+        if (b_inside)
+        {
+            append(output, b);
+        }
+    }
+
+    // the ring is closed so the last vertex may repeat the first
+    while (output.size() > begin + 1 && output.back() == output[begin])
+    {
+        output.pop_back();
+    }
+}
+
+// clips a ring to a box by clipping against each side of the box in turn (Sutherland-Hodgman), appending the clipped
+// ring to output. returns whether or not a ring with at least 3 vertices was appended
+template <typename T>
+bool clip_ring(geom::aabb2<T> const& box, geom::polygon<T> const& ring, std::vector<math::vec2<T>>& output,
+               std::array<std::vector<math::vec2<T>>, 2>& scratch)
+{
+    if (ring.is_empty() || !box.intersects(ring.aabb()))
+    {
+        return false;
+    }
+
+    size_t const begin = output.size();
+    if (box.contains(ring.aabb()))
+    {
+        output.insert(output.end(), ring.vertices().begin(), ring.vertices().end());
+        return true;
+    }
+
+    scratch[0].clear();
+    scratch[1].clear();
+    clip_ring<T, true>(std::span<math::vec2<T> const>(ring.vertices()), 0, box.min.x, scratch[0]);
+    clip_ring<T, false>(std::span<math::vec2<T> const>(scratch[0]), 0, box.max.x, scratch[1]);
+    scratch[0].clear();
+    clip_ring<T, true>(std::span<math::vec2<T> const>(scratch[1]), 1, box.min.y, scratch[0]);
+    clip_ring<T, false>(std::span<math::vec2<T> const>(scratch[0]), 1, box.max.y, output);
+
+    if (output.size() < begin + 3)
+    {
+        output.resize(begin);
+        return false;
+    }
+    return true;
+}
+
+// computes the values of the six clip space boundaries at a point (a value is nonnegative when the point is on the
+// inside of the boundary)
+template <typename T>
+inline std::array<T, 6> boundaries(math::vec4<T> const& c, depth_range_types const depth)
+{
+    T const near = (depth == depth_range_types::zero_to_one) ? c.z : c.w + c.z;
+    return {c.w + c.x, c.w - c.x, c.w + c.y, c.w - c.y, near, c.w - c.z};
+}
+
+// narrows [0, 1] to the interval [t0, t1] of a segment where every boundary value is nonnegative (Liang-Barsky). the
+// boundary values are affine in the segment parameter so this works in any space that is an affine image of clip space
+template <typename T, size_t K>
+bool clip_interval(std::array<T, K> const& a, std::array<T, K> const& b, T& t0, T& t1)
+{
+    t0 = math::constants<T>::zero;
+    t1 = math::constants<T>::one;
+    for (size_t k = 0; k < K; ++k)
+    {
+        if (a[k] < math::constants<T>::zero && b[k] < math::constants<T>::zero)
+        {
+            return false;
+        }
+        else if (a[k] < math::constants<T>::zero) // entering the boundary
+        {
+            t0 = std::max(t0, a[k] / (a[k] - b[k]));
+        }
+        else if (b[k] < math::constants<T>::zero) // leaving the boundary
+        {
+            t1 = std::min(t1, a[k] / (a[k] - b[k]));
+        }
+    }
+    return t0 <= t1;
+}
+
+// clips a line strip against a set of boundaries, appending the vertices of each piece to output and the end offset
+// of each piece to offsets. the boundary values of each vertex are only computed once
+template <typename T, size_t N, typename boundaries_t>
+void clip_strip(std::span<math::vec<T, N> const> const vertices, boundaries_t&& boundaries,
+                std::vector<math::vec<T, N>>& output, std::vector<size_t>& offsets)
+{
+    if (vertices.size() < 2)
+    {
+        return;
+    }
+
+    bool open = false; // whether or not the previous edge ended inside (so a piece is in progress)
+    auto a = boundaries(vertices[0]);
+    for (size_t i = 0; i + 1 < vertices.size(); ++i)
+    {
+        auto const b = boundaries(vertices[i + 1]);
+        math::vec<T, N> const& p = vertices[i];
+        math::vec<T, N> const& q = vertices[i + 1];
+        T t0;
+        T t1;
+        if (clip_interval(a, b, t0, t1))
+        {
+            if (!open) // start a new piece (when a piece is open, p is inside so t0 is 0)
+            {
+                output.push_back((t0 == math::constants<T>::zero) ? p : p + t0 * (q - p));
+                open = true;
+            }
+            output.push_back((t1 == math::constants<T>::one) ? q : p + t1 * (q - p));
+            if (t1 < math::constants<T>::one) // the edge leaves the volume => close the piece
+            {
+                offsets.push_back(output.size());
+                open = false;
+            }
+        }
+        else if (open)
+        {
+            offsets.push_back(output.size());
+            open = false;
+        }
+        a = b;
+    }
+
+    if (open)
+    {
+        offsets.push_back(output.size());
+    }
+}
+
 } // namespace stf::alg::guts
 /// @endcond
 
 namespace stf::alg
 {
 
+/**
+ * @brief A reusable buffer that stores the output of clipping many features to a box
+ *
+ * All the clipped vertices are stored in a single flat array. Each clipped feature is made up of some number of parts
+ * (eg the hull and holes of a holygon or the pieces of a polyline) and each part is a contiguous range of vertices.
+ * Clearing a buffer retains the capacity of the arrays, so clipping into a buffer that is reused does not allocate once
+ * the buffer has grown to fit the output.
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension of the clipped vertices
+ */
+template <typename T, size_t N = 2>
+struct clip_buffer final
+{
+    /**
+     * @brief The vertices of all the parts
+     */
+    std::vector<math::vec<T, N>> vertices;
+
+    /**
+     * @brief Part i is made up of the vertices in [offsets[i], offsets[i + 1])
+     */
+    std::vector<size_t> offsets = {0};
+
+    /**
+     * @brief Feature i is made up of the parts in [features[i], features[i + 1])
+     */
+    std::vector<size_t> features = {0};
+
+    /**
+     * @brief Scratch space used while clipping
+     */
+    std::array<std::vector<math::vec<T, N>>, 2> scratch;
+
+    /**
+     * @brief Clear the output of a @ref clip_buffer (retaining the allocated capacity)
+     */
+    void clear()
+    {
+        vertices.clear();
+        offsets.assign(1, 0);
+        features.assign(1, 0);
+    }
+
+    /**
+     * @brief Compute the number of parts in a @ref clip_buffer
+     * @return The number of parts
+     */
+    inline size_t part_count() const { return offsets.size() - 1; }
+
+    /**
+     * @brief Compute the number of features in a @ref clip_buffer
+     * @return The number of features
+     */
+    inline size_t feature_count() const { return features.size() - 1; }
+
+    /**
+     * @brief Access the vertices of a part
+     * @param [in] i
+     * @return A view of the vertices of the @p ith part
+     */
+    inline std::span<math::vec<T, N> const> part(size_t const i) const
+    {
+        return std::span<math::vec<T, N> const>(vertices.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+};
+
 /**
  * @brief Clip a line segment to a bounding box
  * @tparam T Number type (float)
@@ -126,58 +364,379 @@ bool clip(geom::aabb2<T> const& box, geom::segment2<T>& seg)
 }
 
 /**
- * @brief Clip a polyline to a bounding box
- * @tparam T Number type (float)
+ * @brief Clip a polyline to a bounding box, appending the result to a buffer
+ *
+ * The result is appended to @p buffer as a single feature with one part for each piece of the polyline that is inside
+ * the box (or no parts if the polyline does not overlap the box). The vertices are written directly to the buffer so
+ * clipping into a reused buffer does not allocate once the buffer has grown to fit the output.
+ * @tparam T Number type (eg float)
  * @param [in] box
  * @param [in] polyline
- * @return A (possibly empty) std::vector of polylines clipped to @p box
+ * @param [in,out] buffer The buffer that the clipped polyline is appended to
  */
 template <typename T>
-std::vector<geom::polyline2<T>> clip(geom::aabb2<T> const& box, geom::polyline2<T> const& polyline)
+void clip(geom::aabb2<T> const& box, geom::polyline2<T> const& polyline, clip_buffer<T>& buffer)
 {
-    std::vector<geom::polyline2<T>> clipped;
-
-    geom::polyline2<T> sub_polyline;
+    bool open = false; // whether or not the previous edge was (at least partially) inside the box
     for (size_t i = 0; i + 1 < polyline.size(); ++i)
     {
         geom::segment2<T> edge = polyline.edge(i);
         if (clip(box, edge)) // segment intersects the box => test how to add the segment to the clipped result
         {
-            if (sub_polyline.is_empty()) // this is the a fresh polyline => add both points
-            {
-                sub_polyline.push_back(edge.a);
-                sub_polyline.push_back(edge.b);
-            }
-            else if (sub_polyline.back() == edge.a) // add to existing polyline => only add the second point
+            if (open && buffer.vertices.back() == edge.a) // add to existing part => only add the second point
             {
-                sub_polyline.push_back(edge.b);
+                buffer.vertices.push_back(edge.b);
             }
-            else // part of a new polyline => store the old polyline and start a new one
+            else // start a new part (closing the current part if there is one)
             {
-                clipped.push_back(sub_polyline);
-
-                sub_polyline.clear();
-                sub_polyline.push_back(edge.a);
-                sub_polyline.push_back(edge.b);
+                if (open)
+                {
+                    buffer.offsets.push_back(buffer.vertices.size());
+                }
+                buffer.vertices.push_back(edge.a);
+                buffer.vertices.push_back(edge.b);
+                open = true;
             }
         }
-        else if (!sub_polyline.is_empty()) // segment does not intersect the box => immediately add the current
-                                           // sub_polyline to the result
+        else if (open) // segment does not intersect the box => immediately close the current part
         {
-            clipped.push_back(sub_polyline);
-            sub_polyline.clear();
+            buffer.offsets.push_back(buffer.vertices.size());
+            open = false;
         }
     }
 
-    // edge case to check if the final sub_polyline was not added to the result
-    if (!sub_polyline.is_empty())
+    // edge case to check if the final part was not closed
+    if (open)
     {
-        clipped.push_back(sub_polyline);
+        buffer.offsets.push_back(buffer.vertices.size());
     }
+    buffer.features.push_back(buffer.part_count());
+}
+
+/**
+ * @brief Clip a polyline to a bounding box
+ * @tparam T Number type (float)
+ * @param [in] box
+ * @param [in] polyline
+ * @return A (possibly empty) std::vector of polylines clipped to @p box
+ */
+template <typename T>
+std::vector<geom::polyline2<T>> clip(geom::aabb2<T> const& box, geom::polyline2<T> const& polyline)
+{
+    clip_buffer<T> buffer;
+    clip(box, polyline, buffer);
 
+    std::vector<geom::polyline2<T>> clipped;
+    clipped.reserve(buffer.part_count());
+    for (size_t i = 0; i < buffer.part_count(); ++i)
+    {
+        std::span<math::vec2<T> const> const part = buffer.part(i);
+        clipped.push_back(geom::polyline2<T>(std::vector<math::vec2<T>>(part.begin(), part.end())));
+    }
     return clipped;
 }
 
+/**
+ * @brief Clip a polygon to a bounding box, appending the result to a buffer
+ *
+ * The polygon is clipped against each side of the box in turn (Sutherland-Hodgman). The result is appended to
+ * @p buffer as a single feature that has one part (or no parts if the polygon does not overlap the box). When a
+ * non-convex polygon leaves and re-enters the box, the part runs along the boundary of the box between the crossings
+ * so the clipped part covers the correct area but may have edges that overlap.
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] polygon
+ * @param [in,out] buffer The buffer that the clipped polygon is appended to
+ */
+template <typename T>
+void clip(geom::aabb2<T> const& box, geom::polygon<T> const& polygon, clip_buffer<T>& buffer)
+{
+    if (guts::clip_ring(box, polygon, buffer.vertices, buffer.scratch))
+    {
+        buffer.offsets.push_back(buffer.vertices.size());
+    }
+    buffer.features.push_back(buffer.part_count());
+}
+
+/**
+ * @brief Clip a holygon to a bounding box, appending the result to a buffer
+ *
+ * The hull and each hole are clipped separately (see @ref clip for a polygon). The result is appended to @p buffer as a
+ * single feature whose first part is the clipped hull and whose remaining parts are the clipped holes that overlap the
+ * box. The feature has no parts if the hull does not overlap the box.
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] holygon
+ * @param [in,out] buffer The buffer that the clipped holygon is appended to
+ */
+template <typename T>
+void clip(geom::aabb2<T> const& box, geom::holygon<T> const& holygon, clip_buffer<T>& buffer)
+{
+    if (guts::clip_ring(box, holygon.hull(), buffer.vertices, buffer.scratch))
+    {
+        buffer.offsets.push_back(buffer.vertices.size());
+        for (geom::polygon<T> const& hole : holygon.holes())
+        {
+            if (guts::clip_ring(box, hole, buffer.vertices, buffer.scratch))
+            {
+                buffer.offsets.push_back(buffer.vertices.size());
+            }
+        }
+    }
+    buffer.features.push_back(buffer.part_count());
+}
+
+/**
+ * @brief Clip a batch of polylines to a bounding box
+ *
+ * @p buffer is cleared and then feature i of @p buffer is the result of clipping the @p ith polyline.
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] polylines
+ * @param [out] buffer
+ */
+template <typename T>
+void clip(geom::aabb2<T> const& box, std::span<geom::polyline2<T> const> const polylines, clip_buffer<T>& buffer)
+{
+    buffer.clear();
+    for (geom::polyline2<T> const& polyline : polylines)
+    {
+        clip(box, polyline, buffer);
+    }
+}
+
+/**
+ * @brief Clip a batch of polygons to a bounding box
+ *
+ * @p buffer is cleared and then feature i of @p buffer is the result of clipping the @p ith polygon.
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] polygons
+ * @param [out] buffer
+ */
+template <typename T>
+void clip(geom::aabb2<T> const& box, std::span<geom::polygon<T> const> const polygons, clip_buffer<T>& buffer)
+{
+    buffer.clear();
+    for (geom::polygon<T> const& polygon : polygons)
+    {
+        clip(box, polygon, buffer);
+    }
+}
+
+/**
+ * @brief Clip a batch of holygons to a bounding box
+ *
+ * @p buffer is cleared and then feature i of @p buffer is the result of clipping the @p ith holygon.
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] holygons
+ * @param [out] buffer
+ */
+template <typename T>
+void clip(geom::aabb2<T> const& box, std::span<geom::holygon<T> const> const holygons, clip_buffer<T>& buffer)
+{
+    buffer.clear();
+    for (geom::holygon<T> const& holygon : holygons)
+    {
+        clip(box, holygon, buffer);
+    }
+}
+
+/**
+ * @brief Clip a clip space line segment to the view volume (homogeneous Liang-Barsky)
+ *
+ * The segment is clipped before the perspective divide, so segments that cross the plane w = 0 are handled correctly.
+ * A point c is inside the view volume when -c.w <= c.x <= c.w, -c.w <= c.y <= c.w, and c.z satisfies the depth range.
+ * @tparam T Number type (eg float)
+ * @param [in,out] a The first endpoint (in clip space)
+ * @param [in,out] b The second endpoint (in clip space)
+ * @param [in] depth The clip space depth range
+ * @return Whether or not the segment should be accepted
+ */
+template <typename T>
+bool clip(math::vec4<T>& a, math::vec4<T>& b, depth_range_types const depth = depth_range_types::zero_to_one)
+{
+    T t0;
+    T t1;
+    if (!guts::clip_interval(guts::boundaries(a, depth), guts::boundaries(b, depth), t0, t1))
+    {
+        return false;
+    }
+
+    math::vec4<T> const delta = b - a;
+    b = (t1 == math::constants<T>::one) ? b : a + t1 * delta;
+    a = (t0 == math::constants<T>::zero) ? a : a + t0 * delta;
+    return true;
+}
+
+/**
+ * @brief Clip a line segment to the view volume of a view-projection matrix
+ *
+ * The endpoints are transformed to clip space and clipped there (homogeneous Liang-Barsky). Clip coordinates are an
+ * affine function of the input, so the clipped segment is returned in the space of the input.
+ * @tparam T Number type (eg float)
+ * @param [in] view_proj The view-projection matrix (eg projection * view)
+ * @param [in,out] seg
+ * @param [in] depth The clip space depth range of @p view_proj
+ * @return Whether or not the segment should be accepted
+ */
+template <typename T>
+bool clip(math::mtx4<T> const& view_proj, geom::segment3<T>& seg,
+          depth_range_types const depth = depth_range_types::zero_to_one)
+{
+    T t0;
+    T t1;
+    std::array<T, 6> const a = guts::boundaries(view_proj * math::vec4<T>(seg.a, math::constants<T>::one), depth);
+    std::array<T, 6> const b = guts::boundaries(view_proj * math::vec4<T>(seg.b, math::constants<T>::one), depth);
+    if (!guts::clip_interval(a, b, t0, t1))
+    {
+        return false;
+    }
+
+    math::vec3<T> const delta = seg.b - seg.a;
+    seg.b = (t1 == math::constants<T>::one) ? seg.b : seg.a + t1 * delta;
+    seg.a = (t0 == math::constants<T>::zero) ? seg.a : seg.a + t0 * delta;
+    return true;
+}
+
+/**
+ * @brief Clip a line segment to a frustum (Liang-Barsky against the six planes of the frustum)
+ * @tparam T Number type (eg float)
+ * @param [in] frustum
+ * @param [in,out] seg
+ * @return Whether or not the segment should be accepted
+ */
+template <typename T>
+bool clip(cam::frustum<T> const& frustum, geom::segment3<T>& seg)
+{
+    T t0;
+    T t1;
+    auto const& planes = frustum.planes();
+    std::array<T, 6> const a = {planes[0].side(seg.a), planes[1].side(seg.a), planes[2].side(seg.a),
+                                planes[3].side(seg.a), planes[4].side(seg.a), planes[5].side(seg.a)};
+    std::array<T, 6> const b = {planes[0].side(seg.b), planes[1].side(seg.b), planes[2].side(seg.b),
+                                planes[3].side(seg.b), planes[4].side(seg.b), planes[5].side(seg.b)};
+    if (!guts::clip_interval(a, b, t0, t1))
+    {
+        return false;
+    }
+
+    math::vec3<T> const delta = seg.b - seg.a;
+    seg.b = (t1 == math::constants<T>::one) ? seg.b : seg.a + t1 * delta;
+    seg.a = (t0 == math::constants<T>::zero) ? seg.a : seg.a + t0 * delta;
+    return true;
+}
+
+/**
+ * @brief Clip a clip space line strip to the view volume, appending the result to a buffer
+ *
+ * The result is appended to @p buffer as a single feature with one part for each piece of the strip that is inside the
+ * view volume. The clipped vertices are still in clip space (ready for the perspective divide).
+ * @tparam T Number type (eg float)
+ * @param [in] vertices The vertices of the line strip (in clip space)
+ * @param [in,out] buffer The buffer that the clipped strip is appended to
+ * @param [in] depth The clip space depth range
+ */
+template <typename T>
+void clip(std::span<math::vec4<T> const> const vertices, clip_buffer<T, 4>& buffer,
+          depth_range_types const depth = depth_range_types::zero_to_one)
+{
+    guts::clip_strip(
+        vertices, [depth](math::vec4<T> const& c) { return guts::boundaries(c, depth); }, buffer.vertices,
+        buffer.offsets);
+    buffer.features.push_back(buffer.part_count());
+}
+
+/**
+ * @brief Clip a polyline to the view volume of a view-projection matrix, appending the result to a buffer
+ *
+ * The result is appended to @p buffer as a single feature with one part for each piece of the polyline that is inside
+ * the view volume. The clipped vertices are in the space of the input.
+ * @tparam T Number type (eg float)
+ * @param [in] view_proj The view-projection matrix (eg projection * view)
+ * @param [in] polyline
+ * @param [in,out] buffer The buffer that the clipped polyline is appended to
+ * @param [in] depth The clip space depth range of @p view_proj
+ */
+template <typename T>
+void clip(math::mtx4<T> const& view_proj, geom::polyline3<T> const& polyline, clip_buffer<T, 3>& buffer,
+          depth_range_types const depth = depth_range_types::zero_to_one)
+{
+    guts::clip_strip(
+        std::span<math::vec3<T> const>(polyline.vertices()),
+        [&](math::vec3<T> const& p)
+        { return guts::boundaries(view_proj * math::vec4<T>(p, math::constants<T>::one), depth); },
+        buffer.vertices, buffer.offsets);
+    buffer.features.push_back(buffer.part_count());
+}
+
+/**
+ * @brief Clip a polyline to a frustum, appending the result to a buffer
+ *
+ * The result is appended to @p buffer as a single feature with one part for each piece of the polyline that is inside
+ * the frustum.
+ * @tparam T Number type (eg float)
+ * @param [in] frustum
+ * @param [in] polyline
+ * @param [in,out] buffer The buffer that the clipped polyline is appended to
+ */
+template <typename T>
+void clip(cam::frustum<T> const& frustum, geom::polyline3<T> const& polyline, clip_buffer<T, 3>& buffer)
+{
+    auto const& planes = frustum.planes();
+    guts::clip_strip(
+        std::span<math::vec3<T> const>(polyline.vertices()),
+        [&](math::vec3<T> const& p) -> std::array<T, 6>
+        {
+            return {planes[0].side(p), planes[1].side(p), planes[2].side(p),
+                    planes[3].side(p), planes[4].side(p), planes[5].side(p)};
+        },
+        buffer.vertices, buffer.offsets);
+    buffer.features.push_back(buffer.part_count());
+}
+
+/**
+ * @brief Clip a batch of polylines to the view volume of a view-projection matrix
+ *
+ * @p buffer is cleared and then feature i of @p buffer is the result of clipping the @p ith polyline.
+ * @tparam T Number type (eg float)
+ * @param [in] view_proj The view-projection matrix (eg projection * view)
+ * @param [in] polylines
+ * @param [out] buffer
+ * @param [in] depth The clip space depth range of @p view_proj
+ */
+template <typename T>
+void clip(math::mtx4<T> const& view_proj, std::span<geom::polyline3<T> const> const polylines,
+          clip_buffer<T, 3>& buffer, depth_range_types const depth = depth_range_types::zero_to_one)
+{
+    buffer.clear();
+    for (geom::polyline3<T> const& polyline : polylines)
+    {
+        clip(view_proj, polyline, buffer, depth);
+    }
+}
+
+/**
+ * @brief Clip a batch of polylines to a frustum
+ *
+ * @p buffer is cleared and then feature i of @p buffer is the result of clipping the @p ith polyline.
+ * @tparam T Number type (eg float)
+ * @param [in] frustum
+ * @param [in] polylines
+ * @param [out] buffer
+ */
+template <typename T>
+void clip(cam::frustum<T> const& frustum, std::span<geom::polyline3<T> const> const polylines,
+          clip_buffer<T, 3>& buffer)
+{
+    buffer.clear();
+    for (geom::polyline3<T> const& polyline : polylines)
+    {
+        clip(frustum, polyline, buffer);
+    }
+}
+
 } // namespace stf::alg
 
 #endif
\ No newline at end of file
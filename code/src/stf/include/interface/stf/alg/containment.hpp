@@ -1,7 +1,18 @@
 #ifndef STF_ALG_CONTAINMENT_HPP_HEADER_GUARD
 #define STF_ALG_CONTAINMENT_HPP_HEADER_GUARD
 
+#include <cstdint>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "stf/alg/parallel.hpp"
+#include "stf/enums.hpp"
 #include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/math/constants.hpp"
 #include "stf/math/vector.hpp"
 
 /**
@@ -12,6 +23,110 @@
 namespace stf::alg
 {
 
+/// @cond DELETED
+namespace guts
+{
+
+template <typename T>
+struct sweep_edge final
+{
+    T y_min;
+    T y_max;
+    math::vec2<T> a;
+    math::vec2<T> b;
+};
+
+// classify points against the edges of a set of rings by sweeping a horizontal line over the points in order of y. the
+// sorted points are split into one contiguous run per thread and each run performs its own sweep over the edges
+template <typename T>
+void classify(std::vector<geom::polygon<T> const*> const& rings, geom::aabb2<T> const& box,
+              std::span<math::vec2<T> const> const points, std::span<containment_types> const classes,
+              size_t const threads)
+{
+    if (rings.front()->is_empty())
+    {
+        std::fill(classes.begin(), classes.begin() + points.size(), containment_types::outside);
+        return;
+    }
+
+    std::vector<sweep_edge<T>> edges;
+    for (geom::polygon<T> const* ring : rings)
+    {
+        size_t const size = ring->size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            math::vec2<T> const& a = (*ring)[i];
+            math::vec2<T> const& b = (*ring)[(i + 1) % size];
+            edges.push_back(sweep_edge<T>{std::min(a.y, b.y), std::max(a.y, b.y), a, b});
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](auto const& lhs, auto const& rhs) { return lhs.y_min < rhs.y_min; });
+
+    std::vector<uint32_t> order(points.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    parallel_sort(order, threads, [&](uint32_t const lhs, uint32_t const rhs)
+    {
+        return points[lhs].y < points[rhs].y || (points[lhs].y == points[rhs].y && lhs < rhs);
+    });
+
+    parallel_for(order.size(), threads, [&](size_t const begin, size_t const end, size_t)
+    {
+        // the edges whose y-range might contain the sweep line
+        std::vector<sweep_edge<T> const*> active;
+        size_t next = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            math::vec2<T> const& query = points[order[i]];
+            for (; next < edges.size() && edges[next].y_min <= query.y; ++next)
+            {
+                active.push_back(&edges[next]);
+            }
+
+            if (!box.contains(query))
+            {
+                classes[order[i]] = containment_types::outside;
+                continue;
+            }
+
+            bool boundary = false;
+            bool inside = false;
+            for (size_t k = 0; k < active.size() && !boundary;)
+            {
+                sweep_edge<T> const& edge = *active[k];
+                if (edge.y_max < query.y)
+                {
+                    // the sweep line has passed the edge
+                    active[k] = active.back();
+                    active.pop_back();
+                    continue;
+                }
+                ++k;
+
+                T const orientation = math::orientation(edge.a, edge.b, query);
+                if (orientation == math::constants<T>::zero)
+                {
+                    // the query is on the line through the edge (and within its y-range)
+                    boundary = std::min(edge.a.x, edge.b.x) <= query.x && query.x <= std::max(edge.a.x, edge.b.x);
+                }
+                else if ((edge.a.y > query.y) != (edge.b.y > query.y))
+                {
+                    // the ray in +x crosses the edge if the query is on the left of the edge directed upwards
+                    inside ^= (orientation > math::constants<T>::zero) == (edge.b.y > edge.a.y);
+                }
+            }
+
+            containment_types const type = inside ? containment_types::inside : containment_types::outside;
+            classes[order[i]] = boundary ? containment_types::boundary : type;
+        }
+    });
+}
+
+} // namespace guts
+/// @endcond
+
 /**
  * @brief Compute whether an aabb contains a point
  * @tparam T Number type (eg float)
@@ -40,6 +155,47 @@ inline bool contains(geom::aabb<T, N> const& lhs, geom::aabb<T, N> const& rhs)
     return lhs.contains(rhs);
 }
 
+/**
+ * @brief Classify a batch of points relative to a polygon
+ *
+ * The points are sorted by y and a horizontal line is swept over them while maintaining the set of edges that it
+ * crosses, so each point is only tested against the edges whose y-range contains it. The classifications match
+ * @ref geom::polygon::contains (up to rounding for points that are within an ulp of the boundary): a point is on the
+ * boundary if @ref geom::polygon::contains is only true for a closed boundary.
+ * @tparam T Number type (eg float)
+ * @param [in] polygon
+ * @param [in] points
+ * @param [out] classes The classification of each point
+ * @param [in] threads The maximum number of threads to use (the sorted points are partitioned across the threads)
+ * @note @p classes must have at least as many entries as @p points
+ */
+template <typename T>
+void classify(geom::polygon<T> const& polygon, std::span<math::vec2<T> const> const points,
+              std::span<containment_types> const classes, size_t const threads = 1)
+{
+    guts::classify<T>({&polygon}, polygon.aabb(), points, classes, threads);
+}
+
+/**
+ * @brief Classify a batch of points relative to a holygon
+ *
+ * The edges of the hull and the holes are swept together, so the cost does not depend on the number of holes that are
+ * far from the points. See @ref classify for a polygon.
+ * @tparam T Number type (eg float)
+ * @param [in] holygon
+ * @param [in] points
+ * @param [out] classes The classification of each point
+ * @param [in] threads The maximum number of threads to use (the sorted points are partitioned across the threads)
+ * @note @p classes must have at least as many entries as @p points
+ * @note The holes are assumed to be disjoint and contained in the hull
+ */
+template <typename T>
+void classify(geom::holygon<T> const& holygon, std::span<math::vec2<T> const> const points,
+              std::span<containment_types> const classes, size_t const threads = 1)
+{
+    guts::classify<T>(geom::guts::rings(holygon), holygon.aabb(), points, classes, threads);
+}
+
 } // namespace stf::alg
 
 #endif
\ No newline at end of file
@@ -0,0 +1,104 @@
+#ifndef STF_ALG_CULLING_HPP_HEADER_GUARD
+#define STF_ALG_CULLING_HPP_HEADER_GUARD
+
+#include <cstdint>
+
+#include <concepts>
+#include <iterator>
+#include <vector>
+
+#include "stf/cam/frustum.hpp"
+#include "stf/enums.hpp"
+#include "stf/geom/aabb.hpp"
+
+/**
+ * @file culling.hpp
+ * @brief A file containing functions that cull geometric objects against a view volume
+ */
+
+namespace stf::alg
+{
+
+/**
+ * @brief A concept for a caller-supplied hierarchy of aabbs
+ *
+ * Nodes are identified by indices. The hierarchy must provide the bounds of a node and an iterable range containing
+ * the indices of the children of a node (an empty range denotes a leaf).
+ * @tparam tree_t Hierarchy type
+ * @tparam T Number type (eg float)
+ */
+template <typename tree_t, typename T>
+concept aabb_hierarchy = requires(tree_t const& tree, size_t const node) {
+    { tree.bounds(node) } -> std::convertible_to<geom::aabb3<T>>;
+    { std::begin(tree.children(node)) } -> std::input_iterator;
+    { std::end(tree.children(node)) };
+};
+
+/// @cond DELETED
+namespace guts
+{
+
+template <typename T, typename tree_t, typename visitor_t>
+void cull(cam::frustum<T> const& frustum, tree_t const& tree, size_t const node, uint32_t mask,
+          std::vector<size_t>& hints, visitor_t& visit)
+{
+    if (node >= hints.size())
+    {
+        hints.resize(node + 1, 0);
+    }
+
+    intersection_types type = frustum.classify(tree.bounds(node), mask, hints[node]);
+    if (type == intersection_types::inside) // the entire subtree is visible
+    {
+        visit(node, type);
+    }
+    else if (type == intersection_types::intersecting)
+    {
+        auto const& children = tree.children(node);
+        if (std::begin(children) == std::end(children)) // leaf nodes are reported as intersecting
+        {
+            visit(node, type);
+        }
+        else // only the planes that straddle this node need to be tested for the children
+        {
+            for (size_t child : children)
+            {
+                guts::cull(frustum, tree, child, mask, hints, visit);
+            }
+        }
+    }
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Cull a hierarchy of aabbs against a frustum
+ *
+ * The hierarchy is traversed depth-first starting at @p root. Each node carries the bitmask of frustum planes that
+ * straddle its parent, so planes that entirely contain a node are never tested against its descendants. A node that is
+ * entirely inside the frustum is reported without visiting its descendants. A leaf that straddles the frustum is
+ * reported as intersecting. Nodes outside the frustum are not reported.
+ *
+ * @p hints stores the last rejecting plane for each node. Passing the same vector in subsequent frames lets each node
+ * test the plane that rejected it previously before any other plane.
+ * @tparam T Number type (eg float)
+ * @tparam tree_t Hierarchy type (see @ref aabb_hierarchy)
+ * @tparam visitor_t Callable with the signature void(size_t node, intersection_types type)
+ * @param [in] frustum The frustum to cull against
+ * @param [in] tree The hierarchy of aabbs
+ * @param [in] root The index of the root node
+ * @param [in,out] hints The per-node plane hints (resized as necessary)
+ * @param [in] visit The callable invoked for every reported node
+ */
+template <typename T, typename tree_t, typename visitor_t>
+    requires aabb_hierarchy<tree_t, T>
+void cull(cam::frustum<T> const& frustum, tree_t const& tree, size_t const root, std::vector<size_t>& hints,
+          visitor_t&& visit)
+{
+    guts::cull(frustum, tree, root, cam::frustum<T>::c_all_planes, hints, visit);
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
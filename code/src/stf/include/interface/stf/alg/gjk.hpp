@@ -0,0 +1,959 @@
+#ifndef STF_ALG_GJK_HPP_HEADER_GUARD
+#define STF_ALG_GJK_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "stf/cam/frustum.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/cone.hpp"
+#include "stf/geom/hypersphere.hpp"
+#include "stf/geom/obb.hpp"
+#include "stf/geom/segment.hpp"
+#include "stf/geom/triangle.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file gjk.hpp
+ * @brief A file containing the GJK and EPA algorithms for convex shapes in R^3
+ */
+
+namespace stf::alg
+{
+
+/**
+ * @brief A struct representing a capsule (the set of points within a distance of a segment) in R^3
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct capsule final
+{
+    /**
+     * @brief The segment at the core of the capsule
+     */
+    geom::segment3<T> segment;
+
+    /**
+     * @brief The radius of the capsule
+     */
+    T radius;
+};
+
+/**
+ * @brief A struct representing the convex hull of a set of points in R^3
+ * @tparam T Number type (eg float)
+ * @note The points are not owned and must outlive @p this
+ */
+template <typename T>
+struct convex_points final
+{
+    /**
+     * @brief The points whose convex hull defines the shape
+     */
+    std::span<math::vec3<T> const> points;
+};
+
+/**
+ * @brief Compute a point of an @ref geom::aabb that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(geom::aabb3<T> const& box, math::vec3<T> const& direction)
+{
+    return box.extremity(direction);
+}
+
+/**
+ * @brief Compute a point of an @ref geom::obb that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(geom::obb3<T> const& box, math::vec3<T> const& direction)
+{
+    return box.extremity(direction);
+}
+
+/**
+ * @brief Compute a point of a @ref geom::sphere that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] sphere
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(geom::sphere<T> const& sphere, math::vec3<T> const& direction)
+{
+    T const length = direction.length();
+    return (length > math::constants<T>::zero) ? sphere.center + (sphere.radius / length) * direction : sphere.center;
+}
+
+/**
+ * @brief Compute a point of a @ref geom::cone that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] cone
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(geom::cone<T> const& cone, math::vec3<T> const& direction)
+{
+    return cone.extremity(direction);
+}
+
+/**
+ * @brief Compute a point of a @ref geom::segment that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] segment
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(geom::segment3<T> const& segment, math::vec3<T> const& direction)
+{
+    return (math::dot(segment.a, direction) >= math::dot(segment.b, direction)) ? segment.a : segment.b;
+}
+
+/**
+ * @brief Compute a point of a @ref geom::triangle that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] triangle
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(geom::triangle3<T> const& triangle, math::vec3<T> const& direction)
+{
+    T const a = math::dot(triangle.a, direction);
+    T const b = math::dot(triangle.b, direction);
+    T const c = math::dot(triangle.c, direction);
+    if (a >= b && a >= c)
+    {
+        return triangle.a;
+    }
+    return (b >= c) ? triangle.b : triangle.c;
+}
+
+/**
+ * @brief Compute a point of a @ref cam::frustum that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] frustum
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(cam::frustum<T> const& frustum, math::vec3<T> const& direction)
+{
+    size_t best = 0;
+    T extreme = math::dot(frustum.vertex(0), direction);
+    for (size_t i = 1; i < cam::frustum<T>::c_num_vertices; ++i)
+    {
+        T const projection = math::dot(frustum.vertex(i), direction);
+        if (projection > extreme)
+        {
+            best = i;
+            extreme = projection;
+        }
+    }
+    return frustum.vertex(best);
+}
+
+/**
+ * @brief Compute a point of a @ref capsule that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] capsule
+ * @param [in] direction
+ * @return The support point
+ */
+template <typename T>
+math::vec3<T> support(capsule<T> const& capsule, math::vec3<T> const& direction)
+{
+    return support(geom::sphere<T>(support(capsule.segment, direction), capsule.radius), direction);
+}
+
+/**
+ * @brief Compute a point of a @ref convex_points that is maximally extreme in a direction
+ * @tparam T Number type (eg float)
+ * @param [in] shape
+ * @param [in] direction
+ * @note This takes time linear in the number of points
+ * @return The support point (or the origin if there are no points)
+ */
+template <typename T>
+math::vec3<T> support(convex_points<T> const& shape, math::vec3<T> const& direction)
+{
+    if (shape.points.empty())
+    {
+        return math::vec3<T>(math::constants<T>::zero);
+    }
+
+    size_t best = 0;
+    T extreme = math::dot(shape.points[0], direction);
+    for (size_t i = 1; i < shape.points.size(); ++i)
+    {
+        T const projection = math::dot(shape.points[i], direction);
+        if (projection > extreme)
+        {
+            best = i;
+            extreme = projection;
+        }
+    }
+    return shape.points[best];
+}
+
+/**
+ * @brief A concept for a convex shape in R^3 that is described by a support function
+ *
+ * The shape must provide an overload of @ref support that returns a point of the shape that is maximally extreme in
+ * a (not necessarily normalized) direction.
+ * @tparam shape_t Shape type
+ * @tparam T Number type (eg float)
+ */
+template <typename shape_t, typename T>
+concept convex_shape = requires(shape_t const& shape, math::vec3<T> const& direction) {
+    { support(shape, direction) } -> std::convertible_to<math::vec3<T>>;
+};
+
+/**
+ * @brief A struct storing the simplex that GJK terminated with
+ *
+ * Passing the same simplex to consecutive queries between the same pair of shapes warm-starts the next query: the
+ * support points are recomputed from the directions that generated them, so the simplex remains valid after the
+ * shapes move. For temporally coherent queries this typically reduces the number of iterations to one or two.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct gjk_simplex final
+{
+    /**
+     * @brief Type alias for vector type
+     */
+    using vec_t = math::vec3<T>;
+
+    /**
+     * @brief A vertex of the simplex (a point of the Minkowski difference lhs - rhs)
+     */
+    struct vertex final
+    {
+        /**
+         * @brief The point of the Minkowski difference
+         */
+        vec_t point;
+
+        /**
+         * @brief The support point of lhs
+         */
+        vec_t lhs;
+
+        /**
+         * @brief The support point of rhs
+         */
+        vec_t rhs;
+
+        /**
+         * @brief The direction that generated the vertex
+         */
+        vec_t direction;
+    };
+
+    /**
+     * @brief The vertices of the simplex (only the first @ref size are meaningful)
+     */
+    std::array<vertex, 4> vertices;
+
+    /**
+     * @brief The number of vertices of the simplex
+     */
+    size_t size = 0;
+
+    /**
+     * @brief Reset the simplex so that the next query is not warm-started
+     */
+    inline void clear() { size = 0; }
+};
+
+/**
+ * @brief A struct storing the result of a GJK query
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct gjk_result final
+{
+    /**
+     * @brief Whether or not the shapes intersect
+     */
+    bool intersecting;
+
+    /**
+     * @brief The distance between the shapes (zero if they intersect)
+     */
+    T distance;
+
+    /**
+     * @brief The point of lhs that is closest to rhs (a point common to both shapes if they intersect)
+     */
+    math::vec3<T> lhs_point;
+
+    /**
+     * @brief The point of rhs that is closest to lhs (a point common to both shapes if they intersect)
+     */
+    math::vec3<T> rhs_point;
+
+    /**
+     * @brief The number of iterations that the query took
+     */
+    size_t iterations;
+};
+
+/**
+ * @brief A struct storing the result of an EPA query
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct epa_result final
+{
+    /**
+     * @brief Whether or not the shapes intersect
+     */
+    bool intersecting;
+
+    /**
+     * @brief The penetration depth (the negated distance between the shapes if they do not intersect)
+     */
+    T depth;
+
+    /**
+     * @brief The unit direction pointing from lhs toward rhs
+     * @note Translating lhs by -depth * normal resolves the penetration
+     */
+    math::vec3<T> normal;
+
+    /**
+     * @brief The point of lhs that penetrates deepest into rhs (or the closest point if they do not intersect)
+     */
+    math::vec3<T> lhs_point;
+
+    /**
+     * @brief The point of rhs that penetrates deepest into lhs (or the closest point if they do not intersect)
+     */
+    math::vec3<T> rhs_point;
+};
+
+/// @cond DELETED
+namespace guts
+{
+
+inline constexpr size_t c_max_gjk_iterations = 64;
+inline constexpr size_t c_max_epa_iterations = 64;
+
+// a subset of the vertices of a simplex along with the barycentric weights of a point on that subset
+template <typename T>
+struct simplex_region final
+{
+    size_t count;
+    std::array<size_t, 4> indices;
+    std::array<T, 4> weights;
+
+    math::vec3<T> point(gjk_simplex<T> const& simplex) const
+    {
+        math::vec3<T> result(math::constants<T>::zero);
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += weights[i] * simplex.vertices[indices[i]].point;
+        }
+        return result;
+    }
+};
+
+template <typename T>
+simplex_region<T> closest_on_segment(gjk_simplex<T> const& simplex, size_t const i, size_t const j)
+{
+    math::vec3<T> const& a = simplex.vertices[i].point;
+    math::vec3<T> const ab = simplex.vertices[j].point - a;
+    T const t = -math::dot(a, ab);
+    T const denom = math::dot(ab, ab);
+    if (t <= math::constants<T>::zero)
+    {
+        return {1, {i}, {math::constants<T>::one}};
+    }
+    if (t >= denom)
+    {
+        return {1, {j}, {math::constants<T>::one}};
+    }
+    T const s = t / denom;
+    return {2, {i, j}, {math::constants<T>::one - s, s}};
+}
+
+// the closest point on a triangle to the origin (from "Real-Time Collision Detection" by Ericson)
+template <typename T>
+simplex_region<T> closest_on_triangle(gjk_simplex<T> const& simplex, size_t const i, size_t const j, size_t const k)
+{
+    T constexpr zero = math::constants<T>::zero;
+    T constexpr one = math::constants<T>::one;
+
+    math::vec3<T> const& a = simplex.vertices[i].point;
+    math::vec3<T> const& b = simplex.vertices[j].point;
+    math::vec3<T> const& c = simplex.vertices[k].point;
+    math::vec3<T> const ab = b - a;
+    math::vec3<T> const ac = c - a;
+
+    T const d1 = -math::dot(ab, a);
+    T const d2 = -math::dot(ac, a);
+    if (d1 <= zero && d2 <= zero)
+    {
+        return {1, {i}, {one}};
+    }
+
+    T const d3 = -math::dot(ab, b);
+    T const d4 = -math::dot(ac, b);
+    if (d3 >= zero && d4 <= d3)
+    {
+        return {1, {j}, {one}};
+    }
+
+    T const vc = d1 * d4 - d3 * d2;
+    if (vc <= zero && d1 >= zero && d3 <= zero)
+    {
+        T const s = d1 / (d1 - d3);
+        return {2, {i, j}, {one - s, s}};
+    }
+
+    T const d5 = -math::dot(ab, c);
+    T const d6 = -math::dot(ac, c);
+    if (d6 >= zero && d5 <= d6)
+    {
+        return {1, {k}, {one}};
+    }
+
+    T const vb = d5 * d2 - d1 * d6;
+    if (vb <= zero && d2 >= zero && d6 <= zero)
+    {
+        T const s = d2 / (d2 - d6);
+        return {2, {i, k}, {one - s, s}};
+    }
+
+    T const va = d3 * d6 - d5 * d4;
+    if (va <= zero && (d4 - d3) >= zero && (d5 - d6) >= zero)
+    {
+        T const s = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return {2, {j, k}, {one - s, s}};
+    }
+
+    T const sum = va + vb + vc;
+    if (sum <= zero)
+    {
+        // the triangle is degenerate so the closest point lies on one of its edges
+        std::array<simplex_region<T>, 3> const edges = {closest_on_segment(simplex, i, j),
+                                                        closest_on_segment(simplex, i, k),
+                                                        closest_on_segment(simplex, j, k)};
+        return *std::min_element(edges.begin(), edges.end(), [&](auto const& lhs, auto const& rhs)
+        {
+            return lhs.point(simplex).length_squared() < rhs.point(simplex).length_squared();
+        });
+    }
+
+    T const v = vb / sum;
+    T const w = vc / sum;
+    return {3, {i, j, k}, {one - v - w, v, w}};
+}
+
+template <typename T>
+simplex_region<T> closest_on_tetrahedron(gjk_simplex<T> const& simplex)
+{
+    // each face is listed with the vertex opposite to it
+    static constexpr std::array<std::array<size_t, 4>, 4> c_faces = {
+        std::array<size_t, 4>{0, 1, 2, 3}, std::array<size_t, 4>{0, 1, 3, 2},
+        std::array<size_t, 4>{0, 2, 3, 1}, std::array<size_t, 4>{1, 2, 3, 0}};
+
+    bool inside = true;
+    simplex_region<T> best = {};
+    T best_distance = math::constants<T>::pos_inf;
+    for (std::array<size_t, 4> const& face : c_faces)
+    {
+        math::vec3<T> const& a = simplex.vertices[face[0]].point;
+        math::vec3<T> const normal =
+            math::cross(simplex.vertices[face[1]].point - a, simplex.vertices[face[2]].point - a);
+        T const origin_side = -math::dot(a, normal);
+        T const opposite_side = math::dot(simplex.vertices[face[3]].point - a, normal);
+        if (origin_side * opposite_side < math::constants<T>::zero)
+        {
+            inside = false;
+            simplex_region<T> const region = closest_on_triangle(simplex, face[0], face[1], face[2]);
+            T const distance = region.point(simplex).length_squared();
+            if (distance < best_distance)
+            {
+                best = region;
+                best_distance = distance;
+            }
+        }
+    }
+
+    if (inside)
+    {
+        // the weights of the origin are the relative volumes of the tetrahedra formed by replacing each vertex
+        auto volume = [&](math::vec3<T> const& a, math::vec3<T> const& b, math::vec3<T> const& c,
+                          math::vec3<T> const& d) { return math::dot(math::cross(b - a, c - a), d - a); };
+        math::vec3<T> const origin(math::constants<T>::zero);
+        math::vec3<T> const& p0 = simplex.vertices[0].point;
+        math::vec3<T> const& p1 = simplex.vertices[1].point;
+        math::vec3<T> const& p2 = simplex.vertices[2].point;
+        math::vec3<T> const& p3 = simplex.vertices[3].point;
+        T const total = volume(p0, p1, p2, p3);
+        T const w1 = volume(p0, origin, p2, p3) / total;
+        T const w2 = volume(p0, p1, origin, p3) / total;
+        T const w3 = volume(p0, p1, p2, origin) / total;
+        return {4, {0, 1, 2, 3}, {math::constants<T>::one - w1 - w2 - w3, w1, w2, w3}};
+    }
+    return best;
+}
+
+// reduces the simplex to the smallest subset that contains its closest point to the origin
+template <typename T>
+simplex_region<T> reduce(gjk_simplex<T>& simplex)
+{
+    simplex_region<T> region;
+    switch (simplex.size)
+    {
+        case 1: region = {1, {0}, {math::constants<T>::one}}; break;
+        case 2: region = closest_on_segment(simplex, 0, 1); break;
+        case 3: region = closest_on_triangle(simplex, 0, 1, 2); break;
+        default: region = closest_on_tetrahedron(simplex); break;
+    }
+
+    // the indices of a region are increasing so the vertices can be compacted in place
+    for (size_t i = 0; i < region.count; ++i)
+    {
+        simplex.vertices[i] = simplex.vertices[region.indices[i]];
+        region.indices[i] = i;
+    }
+    simplex.size = region.count;
+    return region;
+}
+
+// whether or not a point is affinely independent of the vertices of a simplex
+template <typename T>
+bool independent(gjk_simplex<T> const& simplex, math::vec3<T> const& point)
+{
+    T constexpr tol_tol = math::constants<T>::tol_tol;
+    math::vec3<T> const& p0 = simplex.vertices[0].point;
+    math::vec3<T> const offset = point - p0;
+    switch (simplex.size)
+    {
+        case 0: return true;
+        case 1: return offset.length_squared() > tol_tol * std::max(point.length_squared(), p0.length_squared());
+        case 2:
+        {
+            math::vec3<T> const edge = simplex.vertices[1].point - p0;
+            T const area = math::cross(edge, offset).length_squared();
+            return area > tol_tol * edge.length_squared() * offset.length_squared();
+        }
+        default:
+        {
+            math::vec3<T> const normal =
+                math::cross(simplex.vertices[1].point - p0, simplex.vertices[2].point - p0);
+            T const height = math::dot(normal, offset);
+            return height * height > tol_tol * normal.length_squared() * offset.length_squared();
+        }
+    }
+}
+
+template <typename T, typename lhs_t, typename rhs_t>
+typename gjk_simplex<T>::vertex evaluate(lhs_t const& lhs, rhs_t const& rhs, math::vec3<T> const& direction)
+{
+    math::vec3<T> const a = support(lhs, direction);
+    math::vec3<T> const b = support(rhs, -direction);
+    return {a - b, a, b, direction};
+}
+
+template <bool early_out, typename T, typename lhs_t, typename rhs_t>
+gjk_result<T> gjk(lhs_t const& lhs, rhs_t const& rhs, gjk_simplex<T>& simplex)
+{
+    using vec_t = math::vec3<T>;
+    using vertex_t = typename gjk_simplex<T>::vertex;
+
+    // warm start by recomputing the previous simplex with the current shapes, discarding any degenerate vertices
+    size_t const cached = std::min(simplex.size, simplex.vertices.size());
+    simplex.size = 0;
+    for (size_t i = 0; i < cached; ++i)
+    {
+        vertex_t const vertex = evaluate<T>(lhs, rhs, simplex.vertices[i].direction);
+        if (independent(simplex, vertex.point))
+        {
+            simplex.vertices[simplex.size++] = vertex;
+        }
+    }
+    if (simplex.size == 0)
+    {
+        vec_t const direction(math::constants<T>::one, math::constants<T>::zero, math::constants<T>::zero);
+        simplex.vertices[simplex.size++] = evaluate<T>(lhs, rhs, direction);
+    }
+
+    gjk_result<T> result = {false, math::constants<T>::zero, vec_t(), vec_t(), 0};
+    simplex_region<T> region;
+    vec_t closest;
+    while (true)
+    {
+        ++result.iterations;
+        region = reduce(simplex);
+        closest = region.point(simplex);
+        T const length_squared = closest.length_squared();
+
+        T scale = math::constants<T>::zero;
+        for (size_t i = 0; i < simplex.size; ++i)
+        {
+            scale = std::max(scale, simplex.vertices[i].point.length_squared());
+        }
+        if (simplex.size == 4 || length_squared <= math::constants<T>::tol_tol * scale)
+        {
+            result.intersecting = true;
+            break;
+        }
+
+        vertex_t const vertex = evaluate<T>(lhs, rhs, -closest);
+        T const projection = math::dot(closest, vertex.point);
+        if constexpr (early_out)
+        {
+            if (projection > math::constants<T>::zero)
+            {
+                // -closest is a separating axis
+                break;
+            }
+        }
+
+        // terminate when the new vertex does not make sufficient progress toward the origin
+        if (length_squared - projection <= math::constants<T>::tol * length_squared ||
+            result.iterations >= c_max_gjk_iterations)
+        {
+            break;
+        }
+        simplex.vertices[simplex.size++] = vertex;
+    }
+
+    result.distance = (result.intersecting) ? math::constants<T>::zero : closest.length();
+    result.lhs_point = vec_t(math::constants<T>::zero);
+    result.rhs_point = vec_t(math::constants<T>::zero);
+    for (size_t i = 0; i < region.count; ++i)
+    {
+        result.lhs_point += region.weights[i] * simplex.vertices[i].lhs;
+        result.rhs_point += region.weights[i] * simplex.vertices[i].rhs;
+    }
+    return result;
+}
+
+// expands a simplex containing the origin into a tetrahedron that contains the origin
+template <typename T, typename lhs_t, typename rhs_t>
+bool complete_tetrahedron(lhs_t const& lhs, rhs_t const& rhs, gjk_simplex<T>& simplex)
+{
+    using vec_t = math::vec3<T>;
+    T constexpr zero = math::constants<T>::zero;
+    T constexpr one = math::constants<T>::one;
+
+    auto extend = [&](vec_t const& direction)
+    {
+        typename gjk_simplex<T>::vertex const vertex = evaluate<T>(lhs, rhs, direction);
+        if (independent(simplex, vertex.point))
+        {
+            simplex.vertices[simplex.size++] = vertex;
+            return true;
+        }
+        return false;
+    };
+
+    if (simplex.size == 1)
+    {
+        std::array<vec_t, 6> const axes = {vec_t(one, zero, zero), vec_t(-one, zero, zero), vec_t(zero, one, zero),
+                                           vec_t(zero, -one, zero), vec_t(zero, zero, one), vec_t(zero, zero, -one)};
+        std::any_of(axes.begin(), axes.end(), extend);
+    }
+    if (simplex.size == 2)
+    {
+        vec_t const edge = simplex.vertices[1].point - simplex.vertices[0].point;
+        size_t axis = 0;
+        for (size_t i = 1; i < 3; ++i)
+        {
+            axis = (std::abs(edge[i]) < std::abs(edge[axis])) ? i : axis;
+        }
+        vec_t unit(zero);
+        unit[axis] = one;
+        vec_t const u = math::cross(edge, unit);
+        vec_t const v = math::cross(edge, u);
+        std::array<vec_t, 4> const directions = {u, -u, v, -v};
+        std::any_of(directions.begin(), directions.end(), extend);
+    }
+    if (simplex.size == 3)
+    {
+        vec_t const normal = math::cross(simplex.vertices[1].point - simplex.vertices[0].point,
+                                         simplex.vertices[2].point - simplex.vertices[0].point);
+        if (!extend(normal))
+        {
+            extend(-normal);
+        }
+    }
+    return simplex.size == 4;
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Compute the distance between two convex shapes with the Gilbert-Johnson-Keerthi algorithm
+ *
+ * GJK iteratively builds a simplex in the Minkowski difference lhs - rhs that approaches the point of the difference
+ * that is closest to the origin. The shapes intersect if the difference contains the origin.
+ * @tparam T Number type (eg float)
+ * @tparam lhs_t Shape type
+ * @tparam rhs_t Shape type
+ * @param [in] lhs
+ * @param [in] rhs
+ * @param [in,out] simplex The simplex to warm-start from, which is overwritten with the terminating simplex
+ * @return The result of the query
+ */
+template <typename T, typename lhs_t, typename rhs_t>
+    requires convex_shape<lhs_t, T> && convex_shape<rhs_t, T>
+gjk_result<T> gjk(lhs_t const& lhs, rhs_t const& rhs, gjk_simplex<T>& simplex)
+{
+    return guts::gjk<false>(lhs, rhs, simplex);
+}
+
+/**
+ * @brief Compute the distance between two convex shapes with the Gilbert-Johnson-Keerthi algorithm
+ * @tparam T Number type (eg float)
+ * @tparam lhs_t Shape type
+ * @tparam rhs_t Shape type
+ * @param [in] lhs
+ * @param [in] rhs
+ * @return The result of the query
+ */
+template <typename T, typename lhs_t, typename rhs_t>
+    requires convex_shape<lhs_t, T> && convex_shape<rhs_t, T>
+gjk_result<T> gjk(lhs_t const& lhs, rhs_t const& rhs)
+{
+    gjk_simplex<T> simplex;
+    return gjk(lhs, rhs, simplex);
+}
+
+/**
+ * @brief Compute whether or not two convex shapes intersect with the Gilbert-Johnson-Keerthi algorithm
+ *
+ * This exits as soon as a separating axis is found, so it is cheaper than computing the distance with @ref gjk.
+ * @tparam T Number type (eg float)
+ * @tparam lhs_t Shape type
+ * @tparam rhs_t Shape type
+ * @param [in] lhs
+ * @param [in] rhs
+ * @param [in,out] simplex The simplex to warm-start from, which is overwritten with the terminating simplex
+ * @return Whether or not @p lhs and @p rhs intersect
+ */
+template <typename T, typename lhs_t, typename rhs_t>
+    requires convex_shape<lhs_t, T> && convex_shape<rhs_t, T>
+bool gjk_intersects(lhs_t const& lhs, rhs_t const& rhs, gjk_simplex<T>& simplex)
+{
+    return guts::gjk<true>(lhs, rhs, simplex).intersecting;
+}
+
+/**
+ * @brief Compute whether or not two convex shapes intersect with the Gilbert-Johnson-Keerthi algorithm
+ * @tparam T Number type (eg float)
+ * @tparam lhs_t Shape type
+ * @tparam rhs_t Shape type
+ * @param [in] lhs
+ * @param [in] rhs
+ * @return Whether or not @p lhs and @p rhs intersect
+ */
+template <typename T, typename lhs_t, typename rhs_t>
+    requires convex_shape<lhs_t, T> && convex_shape<rhs_t, T>
+bool gjk_intersects(lhs_t const& lhs, rhs_t const& rhs)
+{
+    gjk_simplex<T> simplex;
+    return gjk_intersects(lhs, rhs, simplex);
+}
+
+/**
+ * @brief Compute the penetration depth of two convex shapes with the Expanding Polytope Algorithm
+ *
+ * If GJK finds that the shapes intersect, its terminating simplex is expanded into a polytope in the Minkowski
+ * difference lhs - rhs. The face of the polytope that is closest to the origin is repeatedly split by the support point
+ * in the direction of its normal until the polytope converges to the boundary of the difference.
+ * @tparam T Number type (eg float)
+ * @tparam lhs_t Shape type
+ * @tparam rhs_t Shape type
+ * @param [in] lhs
+ * @param [in] rhs
+ * @param [in,out] simplex The simplex to warm-start from, which is overwritten with the terminating GJK simplex
+ * @note Shapes that touch without overlapping in a volume are reported as intersecting with depth zero
+ * @return The result of the query
+ */
+template <typename T, typename lhs_t, typename rhs_t>
+    requires convex_shape<lhs_t, T> && convex_shape<rhs_t, T>
+epa_result<T> epa(lhs_t const& lhs, rhs_t const& rhs, gjk_simplex<T>& simplex)
+{
+    using vec_t = math::vec3<T>;
+    using vertex_t = typename gjk_simplex<T>::vertex;
+
+    gjk_result<T> const distance = gjk(lhs, rhs, simplex);
+    if (!distance.intersecting)
+    {
+        vec_t const normal = (distance.rhs_point - distance.lhs_point) / distance.distance;
+        return {false, -distance.distance, normal, distance.lhs_point, distance.rhs_point};
+    }
+
+    gjk_simplex<T> tetrahedron = simplex;
+    if (!guts::complete_tetrahedron(lhs, rhs, tetrahedron))
+    {
+        // the Minkowski difference is flat, so the shapes touch without overlapping in a volume
+        vec_t normal(math::constants<T>::one, math::constants<T>::zero, math::constants<T>::zero);
+        if (tetrahedron.size == 3)
+        {
+            vec_t const& a = tetrahedron.vertices[0].point;
+            vec_t const& b = tetrahedron.vertices[1].point;
+            vec_t const& c = tetrahedron.vertices[2].point;
+            normal = math::normalized(math::cross(b - a, c - a));
+        }
+        return {true, math::constants<T>::zero, normal, distance.lhs_point, distance.rhs_point};
+    }
+
+    struct face_t final
+    {
+        std::array<uint32_t, 3> indices;
+        vec_t normal;
+        T distance;
+    };
+
+    std::vector<vertex_t> vertices(tetrahedron.vertices.begin(), tetrahedron.vertices.end());
+    std::vector<face_t> faces;
+    std::vector<std::pair<uint32_t, uint32_t>> horizon;
+
+    auto make_face = [&](uint32_t const a, uint32_t const b, uint32_t const c)
+    {
+        vec_t normal = math::cross(vertices[b].point - vertices[a].point, vertices[c].point - vertices[a].point);
+        T const length = normal.length();
+        if (length <= math::constants<T>::zero)
+        {
+            // degenerate faces are never selected as the closest face
+            return face_t{{a, b, c}, vec_t(math::constants<T>::zero), math::constants<T>::pos_inf};
+        }
+        normal /= length;
+        return face_t{{a, b, c}, normal, math::dot(normal, vertices[a].point)};
+    };
+
+    // orient the faces of the tetrahedron outward
+    static constexpr std::array<std::array<uint32_t, 4>, 4> c_faces = {
+        std::array<uint32_t, 4>{0, 1, 2, 3}, std::array<uint32_t, 4>{0, 3, 1, 2},
+        std::array<uint32_t, 4>{0, 2, 3, 1}, std::array<uint32_t, 4>{1, 3, 2, 0}};
+    for (std::array<uint32_t, 4> const& face : c_faces)
+    {
+        vec_t const normal = math::cross(vertices[face[1]].point - vertices[face[0]].point,
+                                         vertices[face[2]].point - vertices[face[0]].point);
+        T const side = math::dot(normal, vertices[face[3]].point - vertices[face[0]].point);
+        bool const inward = side > math::constants<T>::zero;
+        faces.push_back(inward ? make_face(face[0], face[2], face[1]) : make_face(face[0], face[1], face[2]));
+    }
+
+    size_t closest = 0;
+    for (size_t iteration = 0; iteration < guts::c_max_epa_iterations; ++iteration)
+    {
+        closest = 0;
+        for (size_t i = 1; i < faces.size(); ++i)
+        {
+            closest = (faces[i].distance < faces[closest].distance) ? i : closest;
+        }
+
+        face_t const face = faces[closest];
+        vertex_t const vertex = guts::evaluate<T>(lhs, rhs, face.normal);
+        T const extent = math::dot(vertex.point, face.normal);
+        if (extent - face.distance <= math::constants<T>::tol * (math::constants<T>::one + extent))
+        {
+            break;
+        }
+
+        // remove the faces visible from the new vertex and collect the edges of the hole they leave behind
+        horizon.clear();
+        for (size_t i = faces.size(); i-- > 0;)
+        {
+            vec_t const offset = vertex.point - vertices[faces[i].indices[0]].point;
+            if (math::dot(faces[i].normal, offset) > math::constants<T>::zero)
+            {
+                for (size_t e = 0; e < 3; ++e)
+                {
+                    std::pair<uint32_t, uint32_t> const edge = {faces[i].indices[e], faces[i].indices[(e + 1) % 3]};
+                    auto found = std::find(horizon.begin(), horizon.end(), std::make_pair(edge.second, edge.first));
+                    if (found == horizon.end())
+                    {
+                        horizon.push_back(edge);
+                    }
+                    else
+                    {
+                        *found = horizon.back();
+                        horizon.pop_back();
+                    }
+                }
+                faces[i] = faces.back();
+                faces.pop_back();
+            }
+        }
+
+        // connect the horizon to the new vertex
+        uint32_t const index = static_cast<uint32_t>(vertices.size());
+        vertices.push_back(vertex);
+        for (std::pair<uint32_t, uint32_t> const& edge : horizon)
+        {
+            faces.push_back(make_face(edge.first, edge.second, index));
+        }
+
+        if (faces.empty())
+        {
+            faces.push_back(face);
+            break;
+        }
+    }
+
+    closest = 0;
+    for (size_t i = 1; i < faces.size(); ++i)
+    {
+        closest = (faces[i].distance < faces[closest].distance) ? i : closest;
+    }
+    face_t const& face = faces[closest];
+
+    // the contact points interpolate the support points at the projection of the origin onto the closest face
+    vertex_t const& a = vertices[face.indices[0]];
+    vertex_t const& b = vertices[face.indices[1]];
+    vertex_t const& c = vertices[face.indices[2]];
+    vec_t const weights = geom::triangle3<T>(a.point, b.point, c.point).barycentric(face.distance * face.normal);
+    vec_t const lhs_point = weights[0] * a.lhs + weights[1] * b.lhs + weights[2] * c.lhs;
+    vec_t const rhs_point = weights[0] * a.rhs + weights[1] * b.rhs + weights[2] * c.rhs;
+    return {true, face.distance, face.normal, lhs_point, rhs_point};
+}
+
+/**
+ * @brief Compute the penetration depth of two convex shapes with the Expanding Polytope Algorithm
+ * @tparam T Number type (eg float)
+ * @tparam lhs_t Shape type
+ * @tparam rhs_t Shape type
+ * @param [in] lhs
+ * @param [in] rhs
+ * @return The result of the query
+ */
+template <typename T, typename lhs_t, typename rhs_t>
+    requires convex_shape<lhs_t, T> && convex_shape<rhs_t, T>
+epa_result<T> epa(lhs_t const& lhs, rhs_t const& rhs)
+{
+    gjk_simplex<T> simplex;
+    return epa(lhs, rhs, simplex);
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
@@ -1,11 +1,14 @@
 #ifndef STF_ALG_INTERSECT_HPP_HEADER_GUARD
 #define STF_ALG_INTERSECT_HPP_HEADER_GUARD
 
+#include <cmath>
+
 #include <optional>
 
 #include "stf/alg/intersects.hpp"
 #include "stf/geom/ray.hpp"
 #include "stf/geom/hyperplane.hpp"
+#include "stf/math/constants.hpp"
 
 /**
  * @file intersect.hpp
@@ -26,24 +29,19 @@ namespace stf::alg
 template <typename T>
 std::optional<math::vec3<T>> intersect(geom::ray3<T> const& ray, geom::plane<T> const& plane)
 {
-    if (intersects(ray, plane))
+    // the signed distance and the projected direction are each computed once
+    T const signed_dist = plane.signed_dist(ray.origin);
+    if (signed_dist == math::constants<T>::zero)
     {
-        if (plane.contains(ray.origin))
-        {
-            return ray.origin;
-        }
-        else
-        {
-            T const dist = plane.dist(ray.origin);
-            T const dot = math::dot(plane.normal(), ray.direction);
-            T const scalar = dist / std::abs(dot);
-            return ray.origin + scalar * ray.direction;
-        }
+        return ray.origin;
     }
-    else
+
+    T const dot = math::dot(plane.normal(), ray.direction);
+    if (dot == math::constants<T>::zero || std::signbit(signed_dist) == std::signbit(dot))
     {
-        return std::nullopt;
+        return std::nullopt; // the ray is parallel to the plane or points away from it
     }
+    return ray.origin + (-signed_dist / dot) * ray.direction;
 }
 
 /**
@@ -3,12 +3,16 @@
 
 #include "stf/cam/frustum.hpp"
 #include "stf/geom/aabb.hpp"
+#include "stf/geom/cone.hpp"
+#include "stf/geom/convex_polygon.hpp"
 #include "stf/geom/hyperplane.hpp"
+#include "stf/geom/hypersphere.hpp"
 #include "stf/geom/obb.hpp"
 #include "stf/geom/polygon.hpp"
 #include "stf/geom/polyline.hpp"
 #include "stf/geom/ray.hpp"
 #include "stf/geom/segment.hpp"
+#include "stf/geom/triangle.hpp"
 #include "stf/math/constants.hpp"
 #include "stf/math/interval.hpp"
 
@@ -72,6 +76,45 @@ inline bool intersects(geom::obb3<T> const& lhs, geom::obb3<T> const& rhs)
     return geom::intersects(lhs, rhs);
 }
 
+/**
+ * @brief Compute whether or not two convex polygons intersect
+ * @tparam T Number type (eg float)
+ * @param [in] lhs
+ * @param [in] rhs
+ * @return Whether or not @p lhs intersects @p rhs
+ */
+template <typename T>
+inline bool intersects(geom::convex_polygon<T> const& lhs, geom::convex_polygon<T> const& rhs)
+{
+    return lhs.intersects(rhs);
+}
+
+/**
+ * @brief Compute whether or not a convex polygon and an obb2 intersect
+ * @tparam T Number type (eg float)
+ * @param [in] polygon
+ * @param [in] obb
+ * @return Whether or not @p polygon intersects @p obb
+ */
+template <typename T>
+inline bool intersects(geom::convex_polygon<T> const& polygon, geom::obb2<T> const& obb)
+{
+    return polygon.intersects(obb);
+}
+
+/**
+ * @brief Compute whether or not an obb2 and a convex polygon intersect
+ * @tparam T Number type (eg float)
+ * @param [in] obb
+ * @param [in] polygon
+ * @return Whether or not @p obb intersects @p polygon
+ */
+template <typename T>
+inline bool intersects(geom::obb2<T> const& obb, geom::convex_polygon<T> const& polygon)
+{
+    return intersects(polygon, obb);
+}
+
 /**
  * @brief Compute whether or not two segment2s intersect
  * @tparam T Number type (eg float)
@@ -312,6 +355,32 @@ inline bool intersects(geom::polyline2<T> const& polyline, geom::polygon<T> cons
     return intersects(polygon, polyline);
 }
 
+/**
+ * @brief Compute whether or not a triangle and an aabb intersect
+ * @tparam T Number type (eg float)
+ * @param [in] triangle
+ * @param [in] aabb
+ * @return Whether or not @p triangle intersects @p aabb
+ */
+template <typename T>
+inline bool intersects(geom::triangle3<T> const& triangle, geom::aabb3<T> const& aabb)
+{
+    return triangle.intersects(aabb);
+}
+
+/**
+ * @brief Compute whether or not an aabb and a triangle intersect
+ * @tparam T Number type (eg float)
+ * @param [in] aabb
+ * @param [in] triangle
+ * @return Whether or not @p aabb intersects @p triangle
+ */
+template <typename T>
+inline bool intersects(geom::aabb3<T> const& aabb, geom::triangle3<T> const& triangle)
+{
+    return triangle.intersects(aabb);
+}
+
 /**
  * @brief Compute whether or not a ray and a plane intersect
  * @tparam T Number type (eg float)
@@ -435,6 +504,88 @@ inline bool intersects(geom::obb3<T> const& obb, cam::frustum<T> const& frustum)
     return frustum.intersects(obb);
 }
 
+/**
+ * @brief Compute whether or not a frustum and a sphere intersect
+ * @tparam T Number type (eg float)
+ * @note This function reports false positives for some inputs (returns true for inputs that do not actually intersect)
+ * @param [in] frustum
+ * @param [in] sphere
+ * @return Whether or not @p frustum intersects @p sphere
+ */
+template <typename T>
+inline bool intersects_fast(cam::frustum<T> const& frustum, geom::sphere<T> const& sphere)
+{
+    return frustum.intersects_fast(sphere);
+}
+
+/**
+ * @brief Compute whether or not a sphere and a frustum intersect
+ * @tparam T Number type (eg float)
+ * @note This function reports false positives for some inputs (returns true for inputs that do not actually intersect)
+ * @param [in] sphere
+ * @param [in] frustum
+ * @return Whether or not @p sphere intersects @p frustum
+ */
+template <typename T>
+inline bool intersects_fast(geom::sphere<T> const& sphere, cam::frustum<T> const& frustum)
+{
+    return frustum.intersects_fast(sphere);
+}
+
+/**
+ * @brief Compute whether or not a frustum and a sphere intersect
+ * @tparam T Number type (eg float)
+ * @param [in] frustum
+ * @param [in] sphere
+ * @return Whether or not @p frustum intersects @p sphere
+ */
+template <typename T>
+inline bool intersects(cam::frustum<T> const& frustum, geom::sphere<T> const& sphere)
+{
+    return frustum.intersects(sphere);
+}
+
+/**
+ * @brief Compute whether or not a sphere and a frustum intersect
+ * @tparam T Number type (eg float)
+ * @param [in] sphere
+ * @param [in] frustum
+ * @return Whether or not @p sphere intersects @p frustum
+ */
+template <typename T>
+inline bool intersects(geom::sphere<T> const& sphere, cam::frustum<T> const& frustum)
+{
+    return frustum.intersects(sphere);
+}
+
+/**
+ * @brief Compute whether or not a frustum and a cone intersect
+ * @tparam T Number type (eg float)
+ * @note This function reports false positives for some inputs (returns true for inputs that do not actually intersect)
+ * @param [in] frustum
+ * @param [in] cone
+ * @return Whether or not @p frustum intersects @p cone
+ */
+template <typename T>
+inline bool intersects_fast(cam::frustum<T> const& frustum, geom::cone<T> const& cone)
+{
+    return frustum.intersects_fast(cone);
+}
+
+/**
+ * @brief Compute whether or not a cone and a frustum intersect
+ * @tparam T Number type (eg float)
+ * @note This function reports false positives for some inputs (returns true for inputs that do not actually intersect)
+ * @param [in] cone
+ * @param [in] frustum
+ * @return Whether or not @p cone intersects @p frustum
+ */
+template <typename T>
+inline bool intersects_fast(geom::cone<T> const& cone, cam::frustum<T> const& frustum)
+{
+    return frustum.intersects_fast(cone);
+}
+
 } // namespace stf::alg
 
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+#ifndef STF_ALG_PARALLEL_HPP_HEADER_GUARD
+#define STF_ALG_PARALLEL_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+/**
+ * @file parallel.hpp
+ * @brief A file containing functions that distribute work across threads
+ */
+
+namespace stf::alg
+{
+
+/**
+ * @brief Compute a reasonable default number of threads to use for parallel work
+ * @return The number of hardware threads (or 1 if that number is unknown)
+ */
+inline size_t default_thread_count()
+{
+    return std::max(static_cast<size_t>(1), static_cast<size_t>(std::thread::hardware_concurrency()));
+}
+
+/**
+ * @brief Partition the range [0, @p count) into contiguous chunks and invoke a callable on each chunk in parallel
+ *
+ * The range is split into at most @p threads chunks of (nearly) equal size. The first chunk is processed on the
+ * calling thread and the function returns after every chunk has been processed. Chunk @p i is always assigned the
+ * thread index @p i, so callers can use the thread index to address per-thread storage.
+ * @tparam callable_t Callable with the signature void(size_t begin, size_t end, size_t thread)
+ * @param [in] count The number of items to process
+ * @param [in] threads The maximum number of threads to use
+ * @param [in] fn The callable invoked for each chunk
+ * @note @p fn must not throw
+ * @note When @p threads is 0 or 1, @p fn is invoked on the calling thread
+ */
+template <typename callable_t>
+void parallel_for(size_t const count, size_t const threads, callable_t&& fn)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t const chunks = std::clamp(threads, static_cast<size_t>(1), count);
+    if (chunks == 1)
+    {
+        fn(static_cast<size_t>(0), count, static_cast<size_t>(0));
+        return;
+    }
+
+    size_t const size = count / chunks;
+    size_t const remainder = count % chunks;
+    auto begin = [size, remainder](size_t const i) { return i * size + std::min(i, remainder); };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    for (size_t i = 1; i < chunks; ++i)
+    {
+        workers.emplace_back([&fn, b = begin(i), e = begin(i + 1), i]() { fn(b, e, i); });
+    }
+    fn(begin(0), begin(1), static_cast<size_t>(0));
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Sort a vector in parallel
+ *
+ * The vector is split into (at most) @p threads contiguous chunks that are sorted concurrently, then adjacent sorted
+ * runs are merged pairwise (with each round of merges running concurrently) until a single run remains.
+ * @tparam value_t Value type
+ * @tparam compare_t Strict weak ordering with the signature bool(value_t const&, value_t const&)
+ * @param [in,out] values The values to sort
+ * @param [in] threads The maximum number of threads to use
+ * @param [in] compare The ordering
+ * @note The sort is not stable, so equivalent values might be reordered -- use a total order for a deterministic result
+ */
+template <typename value_t, typename compare_t>
+void parallel_sort(std::vector<value_t>& values, size_t const threads, compare_t compare)
+{
+    size_t const chunks = std::clamp(threads, static_cast<size_t>(1), std::max(values.size(), static_cast<size_t>(1)));
+    auto bound = [&values, chunks](size_t const i) { return values.begin() + values.size() * i / chunks; };
+    parallel_for(chunks, chunks, [&](size_t const begin, size_t const end, size_t)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::sort(bound(i), bound(i + 1), compare);
+        }
+    });
+
+    for (size_t width = 1; width < chunks; width *= 2)
+    {
+        size_t const merges = (chunks + 2 * width - 1) / (2 * width);
+        parallel_for(merges, merges, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                size_t const first = 2 * width * i;
+                size_t const middle = std::min(first + width, chunks);
+                size_t const last = std::min(first + 2 * width, chunks);
+                std::inplace_merge(bound(first), bound(middle), bound(last), compare);
+            }
+        });
+    }
+}
+
+/**
+ * @brief Replace each value with the sum of the values that precede it (an exclusive prefix sum) in parallel
+ *
+ * Each chunk is summed concurrently, the chunk totals are scanned on the calling thread, and then each chunk is
+ * rewritten concurrently starting from its offset.
+ * @tparam value_t Arithmetic type
+ * @param [in,out] values The values to scan
+ * @param [in] threads The maximum number of threads to use
+ * @return The sum of all the values
+ */
+template <typename value_t>
+value_t parallel_exclusive_scan(std::vector<value_t>& values, size_t const threads)
+{
+    std::vector<value_t> offsets(std::max(threads, static_cast<size_t>(1)) + 1, value_t(0));
+    parallel_for(values.size(), threads, [&](size_t const begin, size_t const end, size_t const thread)
+    {
+        offsets[thread + 1] = std::accumulate(values.begin() + begin, values.begin() + end, value_t(0));
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    parallel_for(values.size(), threads, [&](size_t const begin, size_t const end, size_t const thread)
+    {
+        value_t sum = offsets[thread];
+        for (size_t i = begin; i < end; ++i)
+        {
+            value_t const value = values[i];
+            values[i] = sum;
+            sum += value;
+        }
+    });
+    return offsets.back();
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
@@ -0,0 +1,394 @@
+#ifndef STF_ALG_RAY_PACKET_HPP_HEADER_GUARD
+#define STF_ALG_RAY_PACKET_HPP_HEADER_GUARD
+
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stf/alg/raycast.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/ray.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/bvh.hpp"
+
+/**
+ * @file ray_packet.hpp
+ * @brief A file containing functions that cast packets of coherent rays against geometric objects
+ */
+
+namespace stf::alg
+{
+
+/**
+ * @brief A packet of rays stored as a structure of arrays
+ *
+ * Each function that operates on a packet loops over the lanes of the packet with no data dependent branches in the
+ * loop body, so the compiler can map the lanes to SIMD registers (eg W = 4 for SSE and W = 8 for AVX with floats).
+ * Lanes are enabled and disabled with a bitmask where bit i corresponds to lane i.
+ * @tparam T Number type (eg float)
+ * @tparam W Number of rays in the packet
+ */
+template <typename T, size_t W>
+struct ray_packet final
+{
+    static_assert(0 < W && W <= 32, "the lanes of a ray_packet must fit in a 32-bit mask");
+
+    /**
+     * @brief Type alias for the per-lane values
+     */
+    using lanes_t = std::array<T, W>;
+
+    /**
+     * @brief Type alias for a ray
+     */
+    using ray_t = geom::ray3<T>;
+
+public:
+    /**
+     * @brief The components of the ray origins
+     */
+    std::array<lanes_t, 3> origin;
+
+    /**
+     * @brief The components of the ray directions
+     */
+    std::array<lanes_t, 3> direction;
+
+    /**
+     * @brief The components of the inverse ray directions (0 components are mapped to the largest finite number)
+     */
+    std::array<lanes_t, 3> inv_direction;
+
+    /**
+     * @brief The rows of the watertight ray-triangle transform in each lane (indexed by row, then component)
+     *
+     * Row 0 and row 1 map a point (relative to the ray origin) to the sheared coordinates perpendicular to the
+     * direction and row 2 maps it to the scaled distance along the direction. Applying the rows gives the same values
+     * as the axis permutation and shear of @ref prepared_ray, but without a per-lane gather.
+     */
+    std::array<std::array<lanes_t, 3>, 3> shear;
+
+    /**
+     * @brief The mask of lanes that hold a ray
+     */
+    uint32_t mask;
+
+    /**
+     * @brief Construct from a set of rays
+     * @param [in] rays The rays to store (lane i holds @p rays[i])
+     * @note Only the first W rays are stored. If there are fewer than W rays, the remaining lanes are disabled
+     */
+    explicit ray_packet(std::span<ray_t const> const rays)
+        : mask(0)
+    {
+        for (size_t i = 0; i < W; ++i)
+        {
+            // fill unused lanes with a valid ray so that computations in disabled lanes are well-defined
+            ray_t const& ray = (i < rays.size()) ? rays[i] : ray_t(math::vec3<T>(0), math::vec3<T>(0, 0, 1));
+            mask |= (i < rays.size()) ? (static_cast<uint32_t>(1) << i) : 0;
+            for (size_t d = 0; d < 3; ++d)
+            {
+                origin[d][i] = ray.origin[d];
+                direction[d][i] = ray.direction[d];
+                inv_direction[d][i] = (ray.direction[d] == math::constants<T>::zero)
+                                          ? math::constants<T>::pos_inf
+                                          : math::constants<T>::one / ray.direction[d];
+            }
+
+            prepared_ray<T> const prepared(ray);
+            for (size_t d = 0; d < 3; ++d)
+            {
+                T const z = (d == prepared.kz) ? math::constants<T>::one : math::constants<T>::zero;
+                shear[0][d][i] = ((d == prepared.kx) ? math::constants<T>::one : math::constants<T>::zero) -
+                                 prepared.shear.x * z;
+                shear[1][d][i] = ((d == prepared.ky) ? math::constants<T>::one : math::constants<T>::zero) -
+                                 prepared.shear.y * z;
+                shear[2][d][i] = prepared.shear.z * z;
+            }
+        }
+    }
+
+    /**
+     * @brief Compute the ray in a lane
+     * @param [in] i The lane
+     * @return The ray in lane @p i
+     */
+    ray_t ray(size_t const i) const
+    {
+        return ray_t(math::vec3<T>(origin[0][i], origin[1][i], origin[2][i]),
+                     math::vec3<T>(direction[0][i], direction[1][i], direction[2][i]));
+    }
+
+    /**
+     * @brief Compute the mask with every lane enabled
+     * @return The mask with the lowest W bits set
+     */
+    static constexpr uint32_t all()
+    {
+        return (W == 32) ? ~static_cast<uint32_t>(0) : (static_cast<uint32_t>(1) << W) - 1;
+    }
+};
+
+/**
+ * @brief A struct to store the result of casting a @ref ray_packet against a @ref spatial::bvh
+ * @tparam T Number type (eg float)
+ * @tparam W Number of rays in the packet
+ */
+template <typename T, size_t W>
+struct packet_hit final
+{
+    /**
+     * @brief The ray parameter of the hit point in each lane (only meaningful in lanes of @ref mask)
+     */
+    std::array<T, W> t;
+
+    /**
+     * @brief The index of the primitive hit in each lane (only meaningful in lanes of @ref mask)
+     */
+    std::array<size_t, W> primitive;
+
+    /**
+     * @brief The mask of lanes that hit a primitive
+     */
+    uint32_t mask;
+};
+
+/**
+ * @brief Cast the lanes of a @ref ray_packet against an aabb
+ * @tparam T Number type (eg float)
+ * @tparam W Number of rays in the packet
+ * @param [in] packet
+ * @param [in] box
+ * @param [in] t_max The largest ray parameter to consider in each lane
+ * @param [in] mask The lanes to test
+ * @param [out] t_near The first ray parameter at which each lane is inside @p box (only meaningful for hit lanes)
+ * @return The mask of lanes in @p mask that intersect @p box in [0, t_max]
+ */
+template <typename T, size_t W>
+uint32_t raycast(ray_packet<T, W> const& packet, geom::aabb3<T> const& box, std::array<T, W> const& t_max,
+                 uint32_t const mask, std::array<T, W>& t_near)
+{
+    T const zero = math::constants<T>::zero;
+    T const huge = math::constants<T>::pos_inf;
+
+    std::array<T, W> t_far = t_max;
+    t_near.fill(zero);
+    for (size_t d = 0; d < 3; ++d)
+    {
+        for (size_t i = 0; i < W; ++i)
+        {
+            T const o = packet.origin[d][i];
+            T const t0 = (box.min[d] - o) * packet.inv_direction[d][i];
+            T const t1 = (box.max[d] - o) * packet.inv_direction[d][i];
+
+            // a lane that is parallel to the slab either never or always lies between its planes
+            bool const parallel = packet.direction[d][i] == zero;
+            bool const between = box.min[d] <= o && o <= box.max[d];
+            T const lo = parallel ? (between ? -huge : huge) : std::min(t0, t1);
+            T const hi = parallel ? (between ? huge : -huge) : std::max(t0, t1) * guts::c_slab_padding<T>;
+            t_near[i] = std::max(t_near[i], lo);
+            t_far[i] = std::min(t_far[i], hi);
+        }
+    }
+
+    uint32_t hits = 0;
+    for (size_t i = 0; i < W; ++i)
+    {
+        hits |= (t_near[i] <= t_far[i]) ? (static_cast<uint32_t>(1) << i) : 0;
+    }
+    return hits & mask;
+}
+
+/**
+ * @brief Cast the lanes of a @ref ray_packet against a triangle
+ *
+ * Uses the watertight test of Woop, Benthin, and Wald in each lane (with the same results as the single ray test in
+ * @ref raycast.hpp) so that lanes through an edge or vertex shared by adjacent triangles hit at least one of them.
+ * Triangles are two-sided. Lanes that hit the triangle closer than their current value in @p t have @p t updated.
+ * @tparam T Number type (eg float)
+ * @tparam W Number of rays in the packet
+ * @param [in] packet
+ * @param [in] a The first vertex of the triangle
+ * @param [in] b The second vertex of the triangle
+ * @param [in] c The third vertex of the triangle
+ * @param [in] mask The lanes to test
+ * @param [in,out] t The largest ray parameter to consider in each lane (updated for lanes that hit)
+ * @return The mask of lanes in @p mask that hit the triangle in [0, t]
+ */
+template <typename T, size_t W>
+uint32_t raycast(ray_packet<T, W> const& packet, math::vec3<T> const& a, math::vec3<T> const& b,
+                 math::vec3<T> const& c, uint32_t const mask, std::array<T, W>& t)
+{
+    using wide_t = std::conditional_t<(sizeof(T) < sizeof(double)), double, T>;
+    T const zero = math::constants<T>::zero;
+    T const one = math::constants<T>::one;
+
+    uint32_t hits = 0;
+    for (size_t i = 0; i < W; ++i)
+    {
+        // translate to the ray origin, then shear and scale so that the ray points along +z
+        T const ox = packet.origin[0][i];
+        T const oy = packet.origin[1][i];
+        T const oz = packet.origin[2][i];
+        auto transform = [&packet, i, ox, oy, oz](math::vec3<T> const& p, size_t const row)
+        {
+            return packet.shear[row][0][i] * (p.x - ox) + packet.shear[row][1][i] * (p.y - oy) +
+                   packet.shear[row][2][i] * (p.z - oz);
+        };
+        T const ax = transform(a, 0);
+        T const ay = transform(a, 1);
+        T const bx = transform(b, 0);
+        T const by = transform(b, 1);
+        T const cx = transform(c, 0);
+        T const cy = transform(c, 1);
+
+        // compute the scaled barycentric coordinates (in higher precision when the lane passes through an edge)
+        T u = cx * by - cy * bx;
+        T v = ax * cy - ay * cx;
+        T w = bx * ay - by * ax;
+        bool const edge = u == zero || v == zero || w == zero;
+        u = edge ? static_cast<T>(static_cast<wide_t>(cx) * by - static_cast<wide_t>(cy) * bx) : u;
+        v = edge ? static_cast<T>(static_cast<wide_t>(ax) * cy - static_cast<wide_t>(ay) * cx) : v;
+        w = edge ? static_cast<T>(static_cast<wide_t>(bx) * ay - static_cast<wide_t>(by) * ax) : w;
+        bool const inside = !((u < zero || v < zero || w < zero) && (u > zero || v > zero || w > zero));
+
+        // compute the scaled hit distance
+        T const det = u + v + w;
+        T const scaled = u * transform(a, 2) + v * transform(b, 2) + w * transform(c, 2);
+        T const dist = scaled / ((det == zero) ? one : det);
+
+        bool const hit = inside && det != zero && zero <= dist && dist <= t[i];
+        bool const active = (mask >> i) & 1;
+        t[i] = (hit && active) ? dist : t[i];
+        hits |= (hit && active) ? (static_cast<uint32_t>(1) << i) : 0;
+    }
+    return hits;
+}
+
+/// @cond DELETED
+namespace guts
+{
+
+template <typename T, size_t W, bool any>
+packet_hit<T, W> traverse(spatial::bvh<T, 3> const& tree, std::span<math::vec3<T> const> const vertices,
+                          std::span<uint32_t const> const indices, ray_packet<T, W> const& packet, T const t_max)
+{
+    packet_hit<T, W> result;
+    result.t.fill(t_max);
+    result.primitive.fill(0);
+    result.mask = 0;
+    if (tree.empty())
+    {
+        return result;
+    }
+
+    // lanes that still need to be traced (any hit queries retire a lane at its first hit)
+    uint32_t remaining = packet.mask;
+
+    std::array<T, W> t_near;
+    spatial::traversal_stack<std::pair<size_t, uint32_t>> stack({tree.root(), packet.mask});
+    while (!stack.empty() && remaining != 0)
+    {
+        auto const [index, parent] = stack.pop();
+
+        // retest the bounds since closer hits may have been found after this node was pushed
+        uint32_t const active = raycast(packet, tree.bounds(index), result.t, parent & remaining, t_near);
+        if (active == 0)
+        {
+            continue;
+        }
+
+        typename spatial::bvh<T, 3>::node_t const& node = tree.node(index);
+        if (node.is_leaf())
+        {
+            for (size_t i = node.first; i < node.first + node.count; ++i)
+            {
+                size_t const p = tree.primitive(i);
+                math::vec3<T> const& a = vertices[indices[3 * p]];
+                math::vec3<T> const& b = vertices[indices[3 * p + 1]];
+                math::vec3<T> const& c = vertices[indices[3 * p + 2]];
+                uint32_t const hits = raycast(packet, a, b, c, active & remaining, result.t);
+                for (size_t l = 0; l < W; ++l)
+                {
+                    result.primitive[l] = ((hits >> l) & 1) ? p : result.primitive[l];
+                }
+                result.mask |= hits;
+                if constexpr (any)
+                {
+                    remaining &= ~hits;
+                }
+            }
+        }
+        else
+        {
+            // order the children along the direction of the first active lane. visiting the nearer child first lets
+            // hits found there prune the farther child
+            size_t const left = index + 1;
+            size_t const right = node.first;
+            size_t const lane = static_cast<size_t>(std::countr_zero(active));
+            math::vec3<T> const direction(packet.direction[0][lane], packet.direction[1][lane],
+                                          packet.direction[2][lane]);
+            math::vec3<T> const delta = tree.bounds(right).center() - tree.bounds(left).center();
+            bool const left_first = math::dot(delta, direction) >= math::constants<T>::zero;
+            stack.push({left_first ? right : left, active});
+            stack.push({left_first ? left : right, active});
+        }
+    }
+    return result;
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Compute the nearest triangle of an indexed mesh hit by each lane of a @ref ray_packet
+ *
+ * The packet traverses the hierarchy together. Each node is tested against the lanes that reached its parent and a
+ * subtree is skipped once no lane enters it before that lane's nearest hit. This amortizes the traversal over
+ * coherent rays (eg rays through neighboring pixels).
+ * @tparam T Number type (eg float)
+ * @tparam W Number of rays in the packet
+ * @param [in] tree The hierarchy over the bounds of the triangles (triangle i has vertices indices[3i, 3i + 3))
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] packet
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The nearest hit in each lane
+ */
+template <typename T, size_t W>
+inline packet_hit<T, W> nearest_hit(spatial::bvh<T, 3> const& tree, std::span<math::vec3<T> const> const vertices,
+                                    std::span<uint32_t const> const indices, ray_packet<T, W> const& packet,
+                                    T const t_max = math::constants<T>::pos_inf)
+{
+    return guts::traverse<T, W, false>(tree, vertices, indices, packet, t_max);
+}
+
+/**
+ * @brief Compute any triangle of an indexed mesh hit by each lane of a @ref ray_packet (eg for shadow rays)
+ * @tparam T Number type (eg float)
+ * @tparam W Number of rays in the packet
+ * @param [in] tree The hierarchy over the bounds of the triangles (triangle i has vertices indices[3i, 3i + 3))
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] packet
+ * @param [in] t_max The largest ray parameter to consider
+ * @return A hit in each lane (not necessarily the nearest)
+ */
+template <typename T, size_t W>
+inline packet_hit<T, W> any_hit(spatial::bvh<T, 3> const& tree, std::span<math::vec3<T> const> const vertices,
+                                std::span<uint32_t const> const indices, ray_packet<T, W> const& packet,
+                                T const t_max = math::constants<T>::pos_inf)
+{
+    return guts::traverse<T, W, true>(tree, vertices, indices, packet, t_max);
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
@@ -0,0 +1,655 @@
+#ifndef STF_ALG_RAYCAST_HPP_HEADER_GUARD
+#define STF_ALG_RAYCAST_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/hyperplane.hpp"
+#include "stf/geom/hypersphere.hpp"
+#include "stf/geom/obb.hpp"
+#include "stf/geom/ray.hpp"
+#include "stf/geom/triangle.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/bvh.hpp"
+
+/**
+ * @file raycast.hpp
+ * @brief A file containing functions that cast rays against geometric objects and hierarchies of them
+ */
+
+namespace stf::alg
+{
+
+/// @cond DELETED
+namespace guts
+{
+
+// slightly enlarges the far slab distance to counteract rounding (see "Robust BVH Ray Traversal" by Ize)
+template <typename T>
+inline constexpr T c_slab_padding = math::constants<T>::one + T(4) * std::numeric_limits<T>::epsilon();
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief The ray parameter written by the batch raycast functions for rays that miss
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+inline constexpr T c_ray_miss = math::constants<T>::pos_inf;
+
+/**
+ * @brief A ray with precomputed data that is reused when casting the ray against many objects
+ *
+ * Stores the inverse of the direction (for slab tests against aabbs) and the axis permutation and shear constants of
+ * the watertight ray-triangle test described by Woop, Benthin, and Wald in "Watertight Ray/Triangle Intersection".
+ * Distances reported by the raycast functions are ray parameters t, so the hit point is origin + t * direction.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct prepared_ray final
+{
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec3<T>;
+
+public:
+    /**
+     * @brief The origin of the ray
+     */
+    vec_t origin;
+
+    /**
+     * @brief The direction of the ray
+     */
+    vec_t direction;
+
+    /**
+     * @brief The componentwise inverse of @ref direction
+     */
+    vec_t inv_direction;
+
+    /**
+     * @brief The index of the dimension where @ref direction has the largest magnitude
+     */
+    size_t kz;
+
+    /**
+     * @brief The index of the first remaining dimension (chosen to preserve the winding of triangles)
+     */
+    size_t kx;
+
+    /**
+     * @brief The index of the second remaining dimension (chosen to preserve the winding of triangles)
+     */
+    size_t ky;
+
+    /**
+     * @brief The shear constants that map @ref direction to the unit vector in dimension @ref kz
+     */
+    vec_t shear;
+
+    /**
+     * @brief Construct from a ray
+     * @param [in] ray
+     * @note The direction of @p ray must be nonzero
+     */
+    explicit prepared_ray(geom::ray3<T> const& ray)
+        : origin(ray.origin)
+        , direction(ray.direction)
+    {
+        for (size_t d = 0; d < 3; ++d)
+        {
+            inv_direction[d] = math::constants<T>::one / direction[d];
+        }
+
+        kz = 0;
+        for (size_t d = 1; d < 3; ++d)
+        {
+            kz = (std::abs(direction[d]) > std::abs(direction[kz])) ? d : kz;
+        }
+        kx = (kz + 1) % 3;
+        ky = (kx + 1) % 3;
+        if (direction[kz] < math::constants<T>::zero)
+        {
+            std::swap(kx, ky);
+        }
+
+        shear.z = math::constants<T>::one / direction[kz];
+        shear.x = direction[kx] * shear.z;
+        shear.y = direction[ky] * shear.z;
+    }
+};
+
+/**
+ * @brief A struct to store the result of casting a ray against a @ref spatial::bvh
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct hit final
+{
+    /**
+     * @brief The ray parameter of the hit point
+     */
+    T t;
+
+    /**
+     * @brief The index of the primitive that was hit
+     */
+    size_t primitive;
+};
+
+/**
+ * @brief Compute the first ray parameter at which a ray is inside an aabb
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] box
+ * @param [in] t_max The largest ray parameter to consider
+ * @note The slab bounds are padded by a few ulps so that rays passing exactly through an edge are not missed
+ * @return The (possibly empty) first ray parameter in [0, @p t_max] at which @p ray is inside @p box
+ */
+template <typename T>
+std::optional<T> raycast(prepared_ray<T> const& ray, geom::aabb3<T> const& box,
+                         T const t_max = math::constants<T>::pos_inf)
+{
+    T t_near = math::constants<T>::zero;
+    T t_far = t_max;
+    for (size_t d = 0; d < 3; ++d)
+    {
+        // a ray that is parallel to the slab either never or always lies between its planes
+        if (ray.direction[d] == math::constants<T>::zero)
+        {
+            if (ray.origin[d] < box.min[d] || box.max[d] < ray.origin[d])
+            {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        T const t0 = (box.min[d] - ray.origin[d]) * ray.inv_direction[d];
+        T const t1 = (box.max[d] - ray.origin[d]) * ray.inv_direction[d];
+        t_near = std::max(t_near, std::min(t0, t1));
+        t_far = std::min(t_far, std::max(t0, t1) * guts::c_slab_padding<T>);
+    }
+    return (t_near <= t_far) ? std::optional<T>(t_near) : std::nullopt;
+}
+
+/**
+ * @brief Compute the first ray parameter at which a ray is inside an aabb
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] box
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) first ray parameter in [0, @p t_max] at which @p ray is inside @p box
+ */
+template <typename T>
+inline std::optional<T> raycast(geom::ray3<T> const& ray, geom::aabb3<T> const& box,
+                                T const t_max = math::constants<T>::pos_inf)
+{
+    return raycast(prepared_ray<T>(ray), box, t_max);
+}
+
+/**
+ * @brief Compute the ray parameter at which a ray intersects a triangle
+ *
+ * Uses the watertight test of Woop, Benthin, and Wald so that rays through an edge or vertex shared by adjacent
+ * triangles hit at least one of them. Triangles are two-sided.
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] a The first vertex of the triangle
+ * @param [in] b The second vertex of the triangle
+ * @param [in] c The third vertex of the triangle
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) ray parameter in [0, @p t_max] at which @p ray intersects the triangle
+ */
+template <typename T>
+std::optional<T> raycast(prepared_ray<T> const& ray, math::vec3<T> const& a, math::vec3<T> const& b,
+                         math::vec3<T> const& c, T const t_max = math::constants<T>::pos_inf)
+{
+    T const zero = math::constants<T>::zero;
+
+    // translate to the ray origin
+    math::vec3<T> const pa = a - ray.origin;
+    math::vec3<T> const pb = b - ray.origin;
+    math::vec3<T> const pc = c - ray.origin;
+
+    // shear and scale so that the ray points along the kz axis
+    T const ax = pa[ray.kx] - ray.shear.x * pa[ray.kz];
+    T const ay = pa[ray.ky] - ray.shear.y * pa[ray.kz];
+    T const bx = pb[ray.kx] - ray.shear.x * pb[ray.kz];
+    T const by = pb[ray.ky] - ray.shear.y * pb[ray.kz];
+    T const cx = pc[ray.kx] - ray.shear.x * pc[ray.kz];
+    T const cy = pc[ray.ky] - ray.shear.y * pc[ray.kz];
+
+    // compute the scaled barycentric coordinates
+    T u = cx * by - cy * bx;
+    T v = ax * cy - ay * cx;
+    T w = bx * ay - by * ax;
+
+    // fall back to higher precision when the ray passes (nearly) exactly through an edge
+    using wide_t = std::conditional_t<(sizeof(T) < sizeof(double)), double, T>;
+    if constexpr (!std::is_same_v<wide_t, T>)
+    {
+        if (u == zero || v == zero || w == zero)
+        {
+            u = static_cast<T>(static_cast<wide_t>(cx) * by - static_cast<wide_t>(cy) * bx);
+            v = static_cast<T>(static_cast<wide_t>(ax) * cy - static_cast<wide_t>(ay) * cx);
+            w = static_cast<T>(static_cast<wide_t>(bx) * ay - static_cast<wide_t>(by) * ax);
+        }
+    }
+
+    if ((u < zero || v < zero || w < zero) && (u > zero || v > zero || w > zero))
+    {
+        return std::nullopt;
+    }
+
+    T const det = u + v + w;
+    if (det == zero)
+    {
+        return std::nullopt;
+    }
+
+    // compute the scaled hit distance and divide only when the hit is in range
+    T const az = ray.shear.z * pa[ray.kz];
+    T const bz = ray.shear.z * pb[ray.kz];
+    T const cz = ray.shear.z * pc[ray.kz];
+    T const t = (u * az + v * bz + w * cz) / det;
+    return (zero <= t && t <= t_max) ? std::optional<T>(t) : std::nullopt;
+}
+
+/**
+ * @brief Compute the ray parameter at which a ray intersects a triangle
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] a The first vertex of the triangle
+ * @param [in] b The second vertex of the triangle
+ * @param [in] c The third vertex of the triangle
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) ray parameter in [0, @p t_max] at which @p ray intersects the triangle
+ */
+template <typename T>
+inline std::optional<T> raycast(geom::ray3<T> const& ray, math::vec3<T> const& a, math::vec3<T> const& b,
+                                math::vec3<T> const& c, T const t_max = math::constants<T>::pos_inf)
+{
+    return raycast(prepared_ray<T>(ray), a, b, c, t_max);
+}
+
+/**
+ * @brief Compute the ray parameter at which a ray intersects a triangle
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] triangle
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) ray parameter in [0, @p t_max] at which @p ray intersects @p triangle
+ */
+template <typename T>
+inline std::optional<T> raycast(prepared_ray<T> const& ray, geom::triangle3<T> const& triangle,
+                                T const t_max = math::constants<T>::pos_inf)
+{
+    return raycast(ray, triangle.a, triangle.b, triangle.c, t_max);
+}
+
+/**
+ * @brief Compute the ray parameter at which a ray intersects a triangle
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] triangle
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) ray parameter in [0, @p t_max] at which @p ray intersects @p triangle
+ */
+template <typename T>
+inline std::optional<T> raycast(geom::ray3<T> const& ray, geom::triangle3<T> const& triangle,
+                                T const t_max = math::constants<T>::pos_inf)
+{
+    return raycast(prepared_ray<T>(ray), triangle, t_max);
+}
+
+/**
+ * @brief Compute the first ray parameter at which a ray is inside an obb
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] box
+ * @param [in] t_max The largest ray parameter to consider
+ * @note The basis of @p box is assumed to be orthonormal
+ * @return The (possibly empty) first ray parameter in [0, @p t_max] at which @p ray is inside @p box
+ */
+template <typename T>
+std::optional<T> raycast(geom::ray3<T> const& ray, geom::obb3<T> const& box,
+                         T const t_max = math::constants<T>::pos_inf)
+{
+    // express the ray in the frame of the box and cast against the corresponding aabb
+    math::vec3<T> const delta = ray.origin - box.center();
+    math::vec3<T> origin;
+    math::vec3<T> direction;
+    for (size_t d = 0; d < 3; ++d)
+    {
+        origin[d] = math::dot(delta, box.basis()[d]);
+        direction[d] = math::dot(ray.direction, box.basis()[d]);
+    }
+    geom::aabb3<T> const local(-box.half_extents(), box.half_extents());
+    return raycast(prepared_ray<T>(geom::ray3<T>(origin, direction)), local, t_max);
+}
+
+/**
+ * @brief Compute the first ray parameter at which a ray is inside a sphere
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] sphere
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) first ray parameter in [0, @p t_max] at which @p ray is inside @p sphere
+ */
+template <typename T>
+std::optional<T> raycast(geom::ray3<T> const& ray, geom::sphere<T> const& sphere,
+                         T const t_max = math::constants<T>::pos_inf)
+{
+    // solve |o + t * d - c|^2 = r^2 for t
+    math::vec3<T> const delta = ray.origin - sphere.center;
+    T const a = math::dot(ray.direction, ray.direction);
+    T const b = math::dot(delta, ray.direction);
+    T const c = math::dot(delta, delta) - sphere.radius * sphere.radius;
+    if (c <= math::constants<T>::zero) // the origin is inside the sphere
+    {
+        return math::constants<T>::zero;
+    }
+
+    T const discriminant = b * b - a * c;
+    if (b >= math::constants<T>::zero || discriminant < math::constants<T>::zero)
+    {
+        return std::nullopt; // the sphere is behind the ray or the ray misses the sphere
+    }
+
+    // compute the smaller root in a way that avoids cancellation
+    T const t = c / (-b + std::sqrt(discriminant));
+    return (t <= t_max) ? std::optional<T>(t) : std::nullopt;
+}
+
+/**
+ * @brief Compute the ray parameter at which a ray intersects a plane
+ * @tparam T Number type (eg float)
+ * @param [in] ray
+ * @param [in] plane
+ * @param [in] t_max The largest ray parameter to consider
+ * @note If the origin of @p ray is on @p plane, the ray parameter is zero
+ * @return The (possibly empty) ray parameter in [0, @p t_max] at which @p ray intersects @p plane
+ */
+template <typename T>
+std::optional<T> raycast(geom::ray3<T> const& ray, geom::plane<T> const& plane,
+                         T const t_max = math::constants<T>::pos_inf)
+{
+    T const signed_dist = plane.signed_dist(ray.origin);
+    if (signed_dist == math::constants<T>::zero)
+    {
+        return math::constants<T>::zero;
+    }
+
+    // a ray that is parallel to the plane yields an infinite parameter, which is rejected by the range check
+    T const t = -signed_dist / math::dot(plane.normal(), ray.direction);
+    return (math::constants<T>::zero <= t && t <= t_max) ? std::optional<T>(t) : std::nullopt;
+}
+
+/**
+ * @brief Cast a batch of rays against a plane
+ *
+ * The loop body is branchless (every entry of @p t is written) so that the compiler can vectorize it. This is the bulk
+ * analog of @ref raycast for a single ray, useful for picking or projecting many points onto the ground.
+ * @tparam T Number type (eg float)
+ * @param [in] rays
+ * @param [in] plane
+ * @param [out] t The ray parameter in [0, @p t_max] at which each ray hits @p plane (or @ref c_ray_miss)
+ * @param [in] t_max The largest ray parameter to consider
+ * @note @p t must have at least as many entries as @p rays
+ */
+template <typename T>
+void raycast(std::span<geom::ray3<T> const> const rays, geom::plane<T> const& plane, std::span<T> const t,
+             T const t_max = math::constants<T>::pos_inf)
+{
+    math::vec3<T> const normal = plane.normal();
+    math::vec3<T> const point = plane.point();
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        T const signed_dist = math::dot(normal, rays[i].origin - point);
+        T const param = -signed_dist / math::dot(normal, rays[i].direction);
+        bool const hit = math::constants<T>::zero <= param && param <= t_max;
+        T const result = hit ? param : c_ray_miss<T>;
+        t[i] = (signed_dist == math::constants<T>::zero) ? math::constants<T>::zero : result;
+    }
+}
+
+/**
+ * @brief Cast a batch of rays against a sphere
+ *
+ * The loop body is branchless (every entry of @p t is written) so that the compiler can vectorize it.
+ * @tparam T Number type (eg float)
+ * @param [in] rays
+ * @param [in] sphere
+ * @param [out] t The first ray parameter in [0, @p t_max] at which each ray is inside @p sphere (or @ref c_ray_miss)
+ * @param [in] t_max The largest ray parameter to consider
+ * @note @p t must have at least as many entries as @p rays
+ */
+template <typename T>
+void raycast(std::span<geom::ray3<T> const> const rays, geom::sphere<T> const& sphere, std::span<T> const t,
+             T const t_max = math::constants<T>::pos_inf)
+{
+    T const radius_squared = sphere.radius * sphere.radius;
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        // see the single ray version for the derivation
+        math::vec3<T> const delta = rays[i].origin - sphere.center;
+        math::vec3<T> const& direction = rays[i].direction;
+        T const a = math::dot(direction, direction);
+        T const b = math::dot(delta, direction);
+        T const c = math::dot(delta, delta) - radius_squared;
+        T const discriminant = b * b - a * c;
+        T const root = c / (-b + std::sqrt(std::max(discriminant, math::constants<T>::zero)));
+        bool const hit = b < math::constants<T>::zero && discriminant >= math::constants<T>::zero && root <= t_max;
+        T const result = hit ? root : c_ray_miss<T>;
+        t[i] = (c <= math::constants<T>::zero) ? math::constants<T>::zero : result;
+    }
+}
+
+/**
+ * @brief Cast a batch of rays against an aabb
+ *
+ * The loop body is branchless (every entry of @p t is written) so that the compiler can vectorize it.
+ * @tparam T Number type (eg float)
+ * @param [in] rays
+ * @param [in] box
+ * @param [out] t The first ray parameter in [0, @p t_max] at which each ray is inside @p box (or @ref c_ray_miss)
+ * @param [in] t_max The largest ray parameter to consider
+ * @note @p t must have at least as many entries as @p rays
+ */
+template <typename T>
+void raycast(std::span<geom::ray3<T> const> const rays, geom::aabb3<T> const& box, std::span<T> const t,
+             T const t_max = math::constants<T>::pos_inf)
+{
+    for (size_t i = 0; i < rays.size(); ++i)
+    {
+        T t_near = math::constants<T>::zero;
+        T t_far = t_max;
+        for (size_t d = 0; d < 3; ++d)
+        {
+            // a ray that is parallel to the slab either never or always lies between its planes, so its slab interval
+            // is selected to be empty or unbounded
+            T const origin = rays[i].origin[d];
+            T const inv_direction = math::constants<T>::one / rays[i].direction[d];
+            T const t0 = (box.min[d] - origin) * inv_direction;
+            T const t1 = (box.max[d] - origin) * inv_direction;
+            bool const parallel = rays[i].direction[d] == math::constants<T>::zero;
+            bool const between = box.min[d] <= origin && origin <= box.max[d];
+            T const near = parallel ? (between ? math::constants<T>::neg_inf : t_max) : std::min(t0, t1);
+            T const far = parallel ? (between ? t_max : math::constants<T>::neg_inf) : std::max(t0, t1);
+            t_near = std::max(t_near, near);
+            t_far = std::min(t_far, far * guts::c_slab_padding<T>);
+        }
+        t[i] = (t_near <= t_far) ? t_near : c_ray_miss<T>;
+    }
+}
+
+/// @cond DELETED
+namespace guts
+{
+
+template <typename T, typename intersector_t, bool any>
+std::optional<hit<T>> traverse(spatial::bvh<T, 3> const& tree, prepared_ray<T> const& ray, intersector_t& intersect,
+                               T t_max)
+{
+    if (tree.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::optional<hit<T>> best;
+    spatial::traversal_stack<std::pair<size_t, T>> stack({tree.root(), math::constants<T>::zero});
+    while (!stack.empty())
+    {
+        auto const [index, t_enter] = stack.pop();
+        if (t_enter > t_max) // a closer hit was found after this node was pushed
+        {
+            continue;
+        }
+
+        typename spatial::bvh<T, 3>::node_t const& node = tree.node(index);
+        if (node.is_leaf())
+        {
+            for (size_t i = node.first; i < node.first + node.count; ++i)
+            {
+                size_t const primitive = tree.primitive(i);
+                if (std::optional<T> t = intersect(primitive, t_max); t && *t <= t_max)
+                {
+                    best = hit<T>{*t, primitive};
+                    t_max = *t;
+                    if constexpr (any)
+                    {
+                        return best;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // push the farther child first so that the nearer child is visited first
+            size_t const left = index + 1;
+            size_t const right = node.first;
+            std::optional<T> const l = raycast(ray, tree.bounds(left), t_max);
+            std::optional<T> const r = raycast(ray, tree.bounds(right), t_max);
+            if (l && r)
+            {
+                bool const left_first = *l <= *r;
+                stack.push(left_first ? std::make_pair(right, *r) : std::make_pair(left, *l));
+                stack.push(left_first ? std::make_pair(left, *l) : std::make_pair(right, *r));
+            }
+            else if (l)
+            {
+                stack.push({left, *l});
+            }
+            else if (r)
+            {
+                stack.push({right, *r});
+            }
+        }
+    }
+    return best;
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Compute the nearest primitive of a @ref spatial::bvh hit by a ray
+ *
+ * Children are visited front-to-back and subtrees whose bounds are entered beyond the nearest hit found so far are
+ * skipped.
+ * @tparam T Number type (eg float)
+ * @tparam intersector_t Callable with the signature std::optional<T>(size_t primitive, T t_max) that returns the ray
+ * parameter in [0, t_max] at which the ray hits a primitive
+ * @param [in] tree The hierarchy over the bounds of the primitives
+ * @param [in] ray
+ * @param [in] intersect The callable that casts the ray against a single primitive
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) nearest hit
+ */
+template <typename T, typename intersector_t>
+inline std::optional<hit<T>> nearest_hit(spatial::bvh<T, 3> const& tree, prepared_ray<T> const& ray,
+                                         intersector_t&& intersect, T const t_max = math::constants<T>::pos_inf)
+{
+    return guts::traverse<T, intersector_t, false>(tree, ray, intersect, t_max);
+}
+
+/**
+ * @brief Compute any primitive of a @ref spatial::bvh hit by a ray (eg for line-of-sight queries)
+ *
+ * Traversal stops at the first hit found, which is not necessarily the nearest.
+ * @tparam T Number type (eg float)
+ * @tparam intersector_t Callable with the signature std::optional<T>(size_t primitive, T t_max) that returns the ray
+ * parameter in [0, t_max] at which the ray hits a primitive
+ * @param [in] tree The hierarchy over the bounds of the primitives
+ * @param [in] ray
+ * @param [in] intersect The callable that casts the ray against a single primitive
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) hit
+ */
+template <typename T, typename intersector_t>
+inline std::optional<hit<T>> any_hit(spatial::bvh<T, 3> const& tree, prepared_ray<T> const& ray,
+                                     intersector_t&& intersect, T const t_max = math::constants<T>::pos_inf)
+{
+    return guts::traverse<T, intersector_t, true>(tree, ray, intersect, t_max);
+}
+
+/**
+ * @brief Compute the nearest triangle of an indexed mesh hit by a ray
+ * @tparam T Number type (eg float)
+ * @param [in] tree The hierarchy over the bounds of the triangles (triangle i has vertices indices[3i, 3i + 3))
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] ray
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) nearest hit
+ */
+template <typename T>
+std::optional<hit<T>> nearest_hit(spatial::bvh<T, 3> const& tree, std::span<math::vec3<T> const> const vertices,
+                                  std::span<uint32_t const> const indices, prepared_ray<T> const& ray,
+                                  T const t_max = math::constants<T>::pos_inf)
+{
+    auto intersect = [&](size_t const i, T const max) -> std::optional<T>
+    {
+        return raycast(ray, vertices[indices[3 * i]], vertices[indices[3 * i + 1]], vertices[indices[3 * i + 2]], max);
+    };
+    return nearest_hit(tree, ray, intersect, t_max);
+}
+
+/**
+ * @brief Compute any triangle of an indexed mesh hit by a ray (eg for line-of-sight queries)
+ * @tparam T Number type (eg float)
+ * @param [in] tree The hierarchy over the bounds of the triangles (triangle i has vertices indices[3i, 3i + 3))
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] ray
+ * @param [in] t_max The largest ray parameter to consider
+ * @return The (possibly empty) hit
+ */
+template <typename T>
+std::optional<hit<T>> any_hit(spatial::bvh<T, 3> const& tree, std::span<math::vec3<T> const> const vertices,
+                              std::span<uint32_t const> const indices, prepared_ray<T> const& ray,
+                              T const t_max = math::constants<T>::pos_inf)
+{
+    auto intersect = [&](size_t const i, T const max) -> std::optional<T>
+    {
+        return raycast(ray, vertices[indices[3 * i]], vertices[indices[3 * i + 1]], vertices[indices[3 * i + 2]], max);
+    };
+    return any_hit(tree, ray, intersect, t_max);
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
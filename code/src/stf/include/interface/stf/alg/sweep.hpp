@@ -0,0 +1,348 @@
+#ifndef STF_ALG_SWEEP_HPP_HEADER_GUARD
+#define STF_ALG_SWEEP_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+
+#include "stf/alg/parallel.hpp"
+#include "stf/alg/raycast.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/hyperplane.hpp"
+#include "stf/geom/hypersphere.hpp"
+#include "stf/geom/ray.hpp"
+#include "stf/geom/triangle.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/sweep_and_prune.hpp"
+
+/**
+ * @file sweep.hpp
+ * @brief A file containing continuous collision tests that compute when a moving object first touches another
+ *
+ * Each test moves an object along a displacement over the course of a frame (parameterized by time in [0, 1]) and
+ * reports the first time at which it touches a stationary object. Objects that already touch report a time of zero.
+ * When both objects move, pass the displacement of the first relative to the second.
+ */
+
+namespace stf::alg
+{
+
+/**
+ * @brief The time written by the batch time of impact functions for pairs that do not touch during the frame
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+inline constexpr T c_no_impact = math::constants<T>::pos_inf;
+
+/// @cond DELETED
+namespace guts
+{
+
+// the first time in [0, 1] at which a point moving along a displacement is within a radius of a segment
+template <typename T>
+std::optional<T> time_of_impact_capsule(math::vec3<T> const& origin, math::vec3<T> const& displacement,
+                                        math::vec3<T> const& a, math::vec3<T> const& b, T const radius)
+{
+    T constexpr zero = math::constants<T>::zero;
+    T constexpr one = math::constants<T>::one;
+
+    // intersect with the infinite cylinder around the segment (from "Real-Time Collision Detection" by Ericson) and
+    // accept roots whose projection onto the segment lies between its endpoints
+    math::vec3<T> const d = b - a;
+    math::vec3<T> const m = origin - a;
+    T const dd = math::dot(d, d);
+    T const md = math::dot(m, d);
+    T const vd = math::dot(displacement, d);
+    T const qa = dd * math::dot(displacement, displacement) - vd * vd;
+    T const qb = dd * math::dot(m, displacement) - md * vd;
+    T const qc = dd * (math::dot(m, m) - radius * radius) - md * md;
+    if (qc <= zero && zero <= md && md <= dd)
+    {
+        return zero;
+    }
+
+    std::optional<T> best;
+    T const discriminant = qb * qb - qa * qc;
+    if (qa > zero && discriminant >= zero)
+    {
+        T const t = (-qb - std::sqrt(discriminant)) / qa;
+        T const s = md + t * vd;
+        if (zero <= t && t <= one && zero <= s && s <= dd)
+        {
+            best = t;
+        }
+    }
+
+    // the hemispherical caps
+    geom::ray3<T> const path(origin, displacement);
+    for (math::vec3<T> const& end : {a, b})
+    {
+        std::optional<T> const t = raycast(path, geom::sphere<T>(end, radius), one);
+        if (t && (!best || *t < *best))
+        {
+            best = t;
+        }
+    }
+    return best;
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Compute the time at which a moving sphere first touches a stationary sphere
+ * @tparam T Number type (eg float)
+ * @param [in] sphere The moving sphere (at time zero)
+ * @param [in] displacement The displacement of @p sphere over the frame
+ * @param [in] stationary
+ * @return The (possibly empty) first time in [0, 1] at which @p sphere touches @p stationary
+ */
+template <typename T>
+std::optional<T> time_of_impact(geom::sphere<T> const& sphere, math::vec3<T> const& displacement,
+                                geom::sphere<T> const& stationary)
+{
+    geom::sphere<T> const sum(stationary.center, sphere.radius + stationary.radius);
+    return raycast(geom::ray3<T>(sphere.center, displacement), sum, math::constants<T>::one);
+}
+
+/**
+ * @brief Compute the time at which a moving sphere first touches a plane
+ * @tparam T Number type (eg float)
+ * @param [in] sphere The moving sphere (at time zero)
+ * @param [in] displacement The displacement of @p sphere over the frame
+ * @param [in] plane
+ * @return The (possibly empty) first time in [0, 1] at which @p sphere touches @p plane
+ */
+template <typename T>
+std::optional<T> time_of_impact(geom::sphere<T> const& sphere, math::vec3<T> const& displacement,
+                                geom::plane<T> const& plane)
+{
+    T const signed_dist = plane.signed_dist(sphere.center);
+    if (std::abs(signed_dist) <= sphere.radius)
+    {
+        return math::constants<T>::zero;
+    }
+
+    T const speed = math::dot(plane.normal(), displacement);
+    if (speed * signed_dist >= math::constants<T>::zero)
+    {
+        return std::nullopt; // the sphere is moving parallel to or away from the plane
+    }
+
+    // the sphere touches the plane when its center is one radius away on the side it starts from
+    T const offset = (signed_dist > math::constants<T>::zero) ? sphere.radius : -sphere.radius;
+    T const t = (offset - signed_dist) / speed;
+    return (t <= math::constants<T>::one) ? std::optional<T>(t) : std::nullopt;
+}
+
+/**
+ * @brief Compute the time at which a moving sphere first touches an aabb
+ *
+ * The path of the center is cast against the box expanded by the radius. If the entry point is near an edge or corner
+ * of the box, the rounded part of the Minkowski sum is resolved by casting against the capsules of the adjacent edges.
+ * @tparam T Number type (eg float)
+ * @param [in] sphere The moving sphere (at time zero)
+ * @param [in] displacement The displacement of @p sphere over the frame
+ * @param [in] box
+ * @return The (possibly empty) first time in [0, 1] at which @p sphere touches @p box
+ */
+template <typename T>
+std::optional<T> time_of_impact(geom::sphere<T> const& sphere, math::vec3<T> const& displacement,
+                                geom::aabb3<T> const& box)
+{
+    math::vec3<T> const padding(sphere.radius);
+    geom::aabb3<T> const expanded(box.min - padding, box.max + padding);
+    geom::ray3<T> const path(sphere.center, displacement);
+    std::optional<T> const t = raycast(path, expanded, math::constants<T>::one);
+    if (!t)
+    {
+        return std::nullopt;
+    }
+
+    // classify the entry point by the dimensions in which it lies outside the (unexpanded) box
+    math::vec3<T> const entry = sphere.center + *t * displacement;
+    size_t outside = 0;
+    math::vec3<T> corner;
+    for (size_t d = 0; d < 3; ++d)
+    {
+        outside += (entry[d] < box.min[d] || box.max[d] < entry[d]) ? 1 : 0;
+        corner[d] = (entry[d] < box.center()[d]) ? box.min[d] : box.max[d];
+    }
+    if (outside <= 1)
+    {
+        return t; // the entry point is on a face of the expanded box
+    }
+
+    // the entry point is in the region of an edge (outside in two dimensions) or a corner (outside in three). in
+    // either case the sphere first touches one of the edges of the box that meet at the nearest corner
+    std::optional<T> best;
+    for (size_t d = 0; d < 3; ++d)
+    {
+        math::vec3<T> other = corner;
+        other[d] = (corner[d] == box.min[d]) ? box.max[d] : box.min[d];
+        std::optional<T> const hit =
+            guts::time_of_impact_capsule(sphere.center, displacement, corner, other, sphere.radius);
+        if (hit && (!best || *hit < *best))
+        {
+            best = hit;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Compute the time at which a moving sphere first touches a triangle
+ * @tparam T Number type (eg float)
+ * @param [in] sphere The moving sphere (at time zero)
+ * @param [in] displacement The displacement of @p sphere over the frame
+ * @param [in] triangle
+ * @note The triangle is assumed to be non-degenerate
+ * @return The (possibly empty) first time in [0, 1] at which @p sphere touches @p triangle
+ */
+template <typename T>
+std::optional<T> time_of_impact(geom::sphere<T> const& sphere, math::vec3<T> const& displacement,
+                                geom::triangle3<T> const& triangle)
+{
+    T constexpr zero = math::constants<T>::zero;
+    if (triangle.dist_squared(sphere.center) <= sphere.radius * sphere.radius)
+    {
+        return zero;
+    }
+
+    // the sphere first touches the interior of the triangle if the contact point with the plane of the triangle lies
+    // inside the triangle
+    math::vec3<T> const normal = triangle.normal();
+    T const signed_dist = math::dot(normal, sphere.center - triangle.a);
+    T const speed = math::dot(normal, displacement);
+    if (speed * signed_dist < zero)
+    {
+        T const offset = (signed_dist > zero) ? sphere.radius : -sphere.radius;
+        T const t = (offset - signed_dist) / speed;
+        math::vec3<T> const contact = sphere.center + t * displacement - offset * normal;
+        math::vec3<T> const weights = triangle.barycentric(contact);
+        bool const in_frame = zero <= t && t <= math::constants<T>::one; // the sphere may already be past the plane
+        if (in_frame && weights[0] >= zero && weights[1] >= zero && weights[2] >= zero)
+        {
+            return t;
+        }
+    }
+
+    // otherwise the sphere first touches an edge (or never touches the triangle)
+    std::optional<T> best;
+    std::array<math::vec3<T>, 3> const vertices = {triangle.a, triangle.b, triangle.c};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        std::optional<T> const hit = guts::time_of_impact_capsule(sphere.center, displacement, vertices[i],
+                                                                  vertices[(i + 1) % 3], sphere.radius);
+        if (hit && (!best || *hit < *best))
+        {
+            best = hit;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Compute the time at which a moving aabb first touches a stationary aabb
+ * @tparam T Number type (eg float)
+ * @param [in] box The moving aabb (at time zero)
+ * @param [in] displacement The displacement of @p box over the frame
+ * @param [in] stationary
+ * @return The (possibly empty) first time in [0, 1] at which @p box touches @p stationary
+ */
+template <typename T>
+std::optional<T> time_of_impact(geom::aabb3<T> const& box, math::vec3<T> const& displacement,
+                                geom::aabb3<T> const& stationary)
+{
+    // the boxes touch when their projections onto every axis overlap, so intersect the time intervals of each axis
+    T first = math::constants<T>::zero;
+    T last = math::constants<T>::one;
+    for (size_t d = 0; d < 3; ++d)
+    {
+        T const speed = displacement[d];
+        if (speed == math::constants<T>::zero)
+        {
+            if (box.max[d] < stationary.min[d] || stationary.max[d] < box.min[d])
+            {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        T const t0 = (stationary.min[d] - box.max[d]) / speed;
+        T const t1 = (stationary.max[d] - box.min[d]) / speed;
+        first = std::max(first, std::min(t0, t1));
+        last = std::min(last, std::max(t0, t1));
+        if (first > last)
+        {
+            return std::nullopt;
+        }
+    }
+    return first;
+}
+
+/**
+ * @brief Compute the time of impact for each candidate pair (eg from a broadphase) of moving spheres
+ *
+ * For the candidate pairs to be conservative, the broadphase should be run over bounds that contain each object at the
+ * start and end of the frame.
+ * @tparam T Number type (eg float)
+ * @param [in] spheres The spheres (at time zero)
+ * @param [in] displacements The displacement of each sphere over the frame
+ * @param [in] pairs Pairs of indices into @p spheres
+ * @param [out] times The first time in [0, 1] at which each pair touches (or @ref c_no_impact)
+ * @param [in] threads The maximum number of threads to use
+ * @note @p times must have at least as many entries as @p pairs
+ */
+template <typename T>
+void time_of_impact(std::span<geom::sphere<T> const> const spheres, std::span<math::vec3<T> const> const displacements,
+                    std::span<spatial::index_pair const> const pairs, std::span<T> const times,
+                    size_t const threads = 1)
+{
+    parallel_for(pairs.size(), threads, [&](size_t const begin, size_t const end, size_t)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto const [lhs, rhs] = pairs[i];
+            math::vec3<T> const relative = displacements[lhs] - displacements[rhs];
+            times[i] = time_of_impact(spheres[lhs], relative, spheres[rhs]).value_or(c_no_impact<T>);
+        }
+    });
+}
+
+/**
+ * @brief Compute the time of impact for each candidate pair (eg from a broadphase) of moving aabbs
+ *
+ * For the candidate pairs to be conservative, the broadphase should be run over bounds that contain each object at the
+ * start and end of the frame.
+ * @tparam T Number type (eg float)
+ * @param [in] boxes The aabbs (at time zero)
+ * @param [in] displacements The displacement of each aabb over the frame
+ * @param [in] pairs Pairs of indices into @p boxes
+ * @param [out] times The first time in [0, 1] at which each pair touches (or @ref c_no_impact)
+ * @param [in] threads The maximum number of threads to use
+ * @note @p times must have at least as many entries as @p pairs
+ */
+template <typename T>
+void time_of_impact(std::span<geom::aabb3<T> const> const boxes, std::span<math::vec3<T> const> const displacements,
+                    std::span<spatial::index_pair const> const pairs, std::span<T> const times,
+                    size_t const threads = 1)
+{
+    parallel_for(pairs.size(), threads, [&](size_t const begin, size_t const end, size_t)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto const [lhs, rhs] = pairs[i];
+            math::vec3<T> const relative = displacements[lhs] - displacements[rhs];
+            times[i] = time_of_impact(boxes[lhs], relative, boxes[rhs]).value_or(c_no_impact<T>);
+        }
+    });
+}
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
@@ -0,0 +1,606 @@
+#ifndef STF_ALG_TILING_HPP_HEADER_GUARD
+#define STF_ALG_TILING_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "stf/alg/clipping.hpp"
+#include "stf/alg/parallel.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/geom/polyline.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file tiling.hpp
+ * @brief A file containing a class that clips geometry to every tile of a grid in a single pass
+ */
+
+namespace stf::alg
+{
+
+/**
+ * @brief A struct to represent a grid of tiles
+ *
+ * Tile (column, row) covers [origin + (column, row) * size, origin + (column + 1, row + 1) * size] expanded by
+ * @ref buffer on every side (so neighboring tiles overlap when the buffer is positive).
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct tile_grid final
+{
+    /**
+     * @brief The min corner of tile (0, 0)
+     */
+    math::vec2<T> origin;
+
+    /**
+     * @brief The dimensions of each tile
+     */
+    math::vec2<T> size;
+
+    /**
+     * @brief The distance that each tile is expanded by on every side
+     */
+    T buffer;
+
+    /**
+     * @brief The number of columns in the grid
+     */
+    size_t columns;
+
+    /**
+     * @brief The number of rows in the grid
+     */
+    size_t rows;
+
+    /**
+     * @brief Compute the number of tiles in a @ref tile_grid
+     * @return The number of tiles
+     */
+    inline size_t count() const { return columns * rows; }
+
+    /**
+     * @brief Compute the index of a tile (tiles are stored in row-major order)
+     * @param [in] column
+     * @param [in] row
+     * @return The index of the tile
+     */
+    inline size_t index(size_t const column, size_t const row) const { return row * columns + column; }
+
+    /**
+     * @brief Compute the min coordinate of a column (axis 0) or row (axis 1) including the buffer
+     * @param [in] axis
+     * @param [in] i
+     * @return The min coordinate
+     */
+    inline T min(size_t const axis, size_t const i) const
+    {
+        return origin[axis] + static_cast<T>(i) * size[axis] - buffer;
+    }
+
+    /**
+     * @brief Compute the max coordinate of a column (axis 0) or row (axis 1) including the buffer
+     * @param [in] axis
+     * @param [in] i
+     * @return The max coordinate
+     */
+    inline T max(size_t const axis, size_t const i) const
+    {
+        return origin[axis] + static_cast<T>(i + 1) * size[axis] + buffer;
+    }
+
+    /**
+     * @brief Compute the bounds of a tile (including the buffer)
+     * @param [in] column
+     * @param [in] row
+     * @return The bounds of the tile
+     */
+    inline geom::aabb2<T> bounds(size_t const column, size_t const row) const
+    {
+        return geom::aabb2<T>(math::vec2<T>(min(0, column), min(1, row)), math::vec2<T>(max(0, column), max(1, row)));
+    }
+
+    /**
+     * @brief Compute the range of columns (axis 0) or rows (axis 1) whose buffered extent overlaps an interval
+     * @param [in] axis
+     * @param [in] lo
+     * @param [in] hi
+     * @param [out] first The first overlapping column/row
+     * @param [out] last The last overlapping column/row
+     * @return Whether or not any column/row overlaps [@p lo, @p hi]
+     */
+    bool range(size_t const axis, T const lo, T const hi, size_t& first, size_t& last) const
+    {
+        size_t const count = (axis == 0) ? columns : rows;
+        T const a = std::ceil((lo - origin[axis] - buffer) / size[axis] - math::constants<T>::one);
+        T const b = std::floor((hi - origin[axis] + buffer) / size[axis]);
+        if (count == 0 || !(a <= b) || b < math::constants<T>::zero || static_cast<T>(count - 1) < a)
+        {
+            return false;
+        }
+        first = (a < math::constants<T>::zero) ? 0 : static_cast<size_t>(a);
+        last = std::min(static_cast<size_t>(b), count - 1);
+        return true;
+    }
+};
+
+/**
+ * @brief The output of tiling for a single tile
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct tile_buffer final
+{
+    /**
+     * @brief The geometry clipped to the tile (see @ref clip_buffer)
+     */
+    clip_buffer<T> clipped;
+
+    /**
+     * @brief Feature i of @ref clipped came from input feature sources[i]
+     */
+    std::vector<size_t> sources;
+
+    /**
+     * @brief Clear the output of a @ref tile_buffer (retaining the allocated capacity)
+     */
+    void clear()
+    {
+        clipped.clear();
+        sources.clear();
+    }
+};
+
+/**
+ * @brief A class that clips features to every tile of a @ref tile_grid that they overlap
+ *
+ * Rather than clipping each feature to each tile, a feature is first split into the columns of the grid and then each
+ * column is split into rows. Each split is a single pass over the edges in which an edge is only clipped to the
+ * columns (or rows) that it overlaps, so the cost is proportional to the size of the output rather than to the number
+ * of tiles times the size of the feature. Clipping a ring to a column or a row (a slab between two parallel lines) is
+ * equivalent to Sutherland-Hodgman against both lines and only needs the part of each edge inside the slab.
+ *
+ * Features are distributed across threads and each thread writes to its own set of tile buffers, which are then
+ * concatenated in order so the output does not depend on the number of threads. All the buffers are retained between
+ * calls so repeated tiling does not allocate once the buffers have grown to fit the output.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+class tiler final
+{
+public:
+    /**
+     * @brief Type alias for vector
+     */
+    using vec_t = math::vec2<T>;
+
+public:
+    /**
+     * @brief Construct from a grid definition
+     * @param [in] grid
+     */
+    explicit tiler(tile_grid<T> const& grid) : m_grid(grid), m_tiles(grid.count()) {}
+
+    /**
+     * @brief Clip a set of polylines to the tiles of the grid
+     *
+     * Each tile contains one feature (made up of the pieces of the polyline inside the tile) for each polyline that
+     * overlaps the tile.
+     * @param [in] polylines
+     * @param [in] threads The maximum number of threads to use (the polylines are partitioned across the threads)
+     */
+    void tile(std::span<geom::polyline2<T> const> const polylines, size_t const threads = 1)
+    {
+        run(polylines.size(), threads,
+            [&](size_t const i, worker& w)
+            {
+                clip_line(std::span<vec_t const>(polylines[i].vertices()), w,
+                          [&](size_t const tile, std::span<vec_t const> const part) { w.emit(tile, i, part); });
+            });
+    }
+
+    /**
+     * @brief Clip a set of polygons to the tiles of the grid
+     *
+     * Each tile contains one feature (with a single ring) for each polygon that overlaps the tile. When a non-convex
+     * polygon leaves and re-enters a tile, the ring runs along the boundary of the tile between the crossings.
+     * @param [in] polygons
+     * @param [in] threads The maximum number of threads to use (the polygons are partitioned across the threads)
+     */
+    void tile(std::span<geom::polygon<T> const> const polygons, size_t const threads = 1)
+    {
+        run(polygons.size(), threads,
+            [&](size_t const i, worker& w)
+            {
+                clip_ring(std::span<vec_t const>(polygons[i].vertices()), w,
+                          [&](size_t const tile, std::span<vec_t const> const part) { w.emit(tile, i, part); });
+            });
+    }
+
+    /**
+     * @brief Clip a set of holygons to the tiles of the grid
+     *
+     * Each tile contains one feature for each holygon whose hull overlaps the tile. The first ring of the feature is
+     * the clipped hull and the remaining rings are the clipped holes that overlap the tile.
+     * @param [in] holygons
+     * @param [in] threads The maximum number of threads to use (the holygons are partitioned across the threads)
+     */
+    void tile(std::span<geom::holygon<T> const> const holygons, size_t const threads = 1)
+    {
+        run(holygons.size(), threads,
+            [&](size_t const i, worker& w)
+            {
+                clip_ring(std::span<vec_t const>(holygons[i].hull().vertices()), w,
+                          [&](size_t const tile, std::span<vec_t const> const part) { w.emit(tile, i, part); });
+                for (geom::polygon<T> const& hole : holygons[i].holes())
+                {
+                    clip_ring(std::span<vec_t const>(hole.vertices()), w,
+                              [&](size_t const tile, std::span<vec_t const> const part)
+                              {
+                                  if (w.open[tile]) // only add holes to tiles that the hull overlaps
+                                  {
+                                      w.emit(tile, i, part);
+                                  }
+                              });
+                }
+            });
+    }
+
+    /**
+     * @brief Const access to the output of a tile from the most recent call to @ref tile
+     * @param [in] column
+     * @param [in] row
+     * @return Const reference to the output of the tile
+     */
+    inline tile_buffer<T> const& at(size_t const column, size_t const row) const
+    {
+        return m_tiles[m_grid.index(column, row)];
+    }
+
+    /**
+     * @brief Const access to the grid
+     * @return Const reference to the grid
+     */
+    inline tile_grid<T> const& grid() const { return m_grid; }
+
+private:
+    static constexpr size_t c_invalid = std::numeric_limits<size_t>::max();
+
+    // per-thread output and scratch space
+    struct worker final
+    {
+        std::vector<tile_buffer<T>> tiles;
+        std::vector<bool> open; // whether or not the current feature has been started in each tile
+        std::vector<size_t> touched; // the tiles that the current feature has been started in
+
+        // the pieces of the current ring/polyline in each column and row. each piece starts at an offset in starts
+        std::vector<std::vector<vec_t>> columns;
+        std::vector<std::vector<size_t>> column_starts;
+        std::vector<std::vector<vec_t>> rows;
+        std::vector<std::vector<size_t>> row_starts;
+        std::vector<size_t> last; // the last edge that was clipped to each column/row (for joining polyline pieces)
+
+        void emit(size_t const tile, size_t const feature, std::span<vec_t const> const part)
+        {
+            tile_buffer<T>& buffer = tiles[tile];
+            if (!open[tile])
+            {
+                open[tile] = true;
+                touched.push_back(tile);
+                buffer.sources.push_back(feature);
+            }
+            buffer.clipped.vertices.insert(buffer.clipped.vertices.end(), part.begin(), part.end());
+            buffer.clipped.offsets.push_back(buffer.clipped.vertices.size());
+        }
+
+        void finish()
+        {
+            for (size_t const tile : touched)
+            {
+                tiles[tile].clipped.features.push_back(tiles[tile].clipped.part_count());
+                open[tile] = false;
+            }
+            touched.clear();
+        }
+    };
+
+    // clips a segment to the slab of points whose coordinate on the axis is in [lo, hi]. the endpoints of the clipped
+    // segment are written to p and q and the return value is whether or not the segment overlaps the slab
+    static bool clip_slab(vec_t const& a, vec_t const& b, size_t const axis, T const lo, T const hi, vec_t& p, vec_t& q)
+    {
+        T t0 = math::constants<T>::zero;
+        T t1 = math::constants<T>::one;
+        T const delta = b[axis] - a[axis];
+        if (delta == math::constants<T>::zero)
+        {
+            if (a[axis] < lo || hi < a[axis])
+            {
+                return false;
+            }
+        }
+        else
+        {
+            T const ta = (lo - a[axis]) / delta;
+            T const tb = (hi - a[axis]) / delta;
+            t0 = std::max(t0, std::min(ta, tb));
+            t1 = std::min(t1, std::max(ta, tb));
+            if (t1 < t0)
+            {
+                return false;
+            }
+        }
+
+        // snap the clipped endpoints onto the slab so the next pass sees them exactly on the boundary
+        p = (t0 == math::constants<T>::zero) ? a : a + t0 * (b - a);
+        q = (t1 == math::constants<T>::one) ? b : a + t1 * (b - a);
+        p[axis] = std::clamp(p[axis], lo, hi);
+        q[axis] = std::clamp(q[axis], lo, hi);
+        return true;
+    }
+
+    static void close(std::vector<vec_t>& ring)
+    {
+        while (ring.size() > 1 && ring.back() == ring.front())
+        {
+            ring.pop_back();
+        }
+    }
+
+    // splits a ring into the slabs along an axis, writing the clipped ring of slab i to rings[i]. returns whether or
+    // not any slab overlaps the ring (with the overlapping slabs in [first, last])
+    bool split_ring(std::span<vec_t const> const ring, size_t const axis, std::vector<std::vector<vec_t>>& rings,
+                    size_t& first, size_t& last) const
+    {
+        T lo = math::constants<T>::pos_inf;
+        T hi = math::constants<T>::neg_inf;
+        for (vec_t const& vertex : ring)
+        {
+            lo = std::min(lo, vertex[axis]);
+            hi = std::max(hi, vertex[axis]);
+        }
+        if (ring.size() < 3 || !m_grid.range(axis, lo, hi, first, last))
+        {
+            return false;
+        }
+
+        for (size_t s = first; s <= last; ++s)
+        {
+            rings[s].clear();
+        }
+        for (size_t i = 0; i < ring.size(); ++i)
+        {
+            vec_t const& a = ring[i];
+            vec_t const& b = ring[(i + 1) % ring.size()];
+            size_t begin = 0;
+            size_t end = 0;
+            if (m_grid.range(axis, std::min(a[axis], b[axis]), std::max(a[axis], b[axis]), begin, end))
+            {
+                for (size_t s = begin; s <= end; ++s)
+                {
+                    vec_t p;
+                    vec_t q;
+                    if (clip_slab(a, b, axis, m_grid.min(axis, s), m_grid.max(axis, s), p, q))
+                    {
+                        guts::append(rings[s], p);
+                        guts::append(rings[s], q);
+                    }
+                }
+            }
+        }
+        for (size_t s = first; s <= last; ++s)
+        {
+            close(rings[s]);
+        }
+        return true;
+    }
+
+    template <typename callable_t>
+    void clip_ring(std::span<vec_t const> const ring, worker& w, callable_t&& emit) const
+    {
+        size_t c0 = 0;
+        size_t c1 = 0;
+        if (!split_ring(ring, 0, w.columns, c0, c1))
+        {
+            return;
+        }
+
+        for (size_t c = c0; c <= c1; ++c)
+        {
+            size_t r0 = 0;
+            size_t r1 = 0;
+            if (w.columns[c].size() >= 3 && split_ring(std::span<vec_t const>(w.columns[c]), 1, w.rows, r0, r1))
+            {
+                for (size_t r = r0; r <= r1; ++r)
+                {
+                    if (w.rows[r].size() >= 3)
+                    {
+                        emit(m_grid.index(c, r), std::span<vec_t const>(w.rows[r]));
+                    }
+                }
+            }
+        }
+    }
+
+    // splits a polyline into the slabs along an axis, writing the pieces in slab i to lines[i] (with the pieces
+    // starting at the offsets in starts[i]). returns whether or not any slab overlaps the polyline (with the
+    // overlapping slabs in [first, last])
+    bool split_line(std::span<vec_t const> const line, size_t const axis, std::vector<std::vector<vec_t>>& lines,
+                    std::vector<std::vector<size_t>>& starts, std::vector<size_t>& last_edge, size_t& first,
+                    size_t& last) const
+    {
+        T lo = math::constants<T>::pos_inf;
+        T hi = math::constants<T>::neg_inf;
+        for (vec_t const& vertex : line)
+        {
+            lo = std::min(lo, vertex[axis]);
+            hi = std::max(hi, vertex[axis]);
+        }
+        if (line.size() < 2 || !m_grid.range(axis, lo, hi, first, last))
+        {
+            return false;
+        }
+
+        for (size_t s = first; s <= last; ++s)
+        {
+            lines[s].clear();
+            starts[s].clear();
+            last_edge[s] = c_invalid;
+        }
+        for (size_t i = 0; i + 1 < line.size(); ++i)
+        {
+            vec_t const& a = line[i];
+            vec_t const& b = line[i + 1];
+            size_t begin = 0;
+            size_t end = 0;
+            if (m_grid.range(axis, std::min(a[axis], b[axis]), std::max(a[axis], b[axis]), begin, end))
+            {
+                for (size_t s = begin; s <= end; ++s)
+                {
+                    vec_t p;
+                    vec_t q;
+                    if (clip_slab(a, b, axis, m_grid.min(axis, s), m_grid.max(axis, s), p, q))
+                    {
+                        // continue the current piece if the previous edge ended in the slab where this edge starts
+                        bool const joined = last_edge[s] + 1 == i && !lines[s].empty() && lines[s].back() == p;
+                        if (!joined)
+                        {
+                            starts[s].push_back(lines[s].size());
+                            lines[s].push_back(p);
+                        }
+                        guts::append(lines[s], q);
+                        last_edge[s] = i;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    template <typename callable_t>
+    void clip_line(std::span<vec_t const> const line, worker& w, callable_t&& emit) const
+    {
+        size_t c0 = 0;
+        size_t c1 = 0;
+        if (!split_line(line, 0, w.columns, w.column_starts, w.last, c0, c1))
+        {
+            return;
+        }
+
+        for (size_t c = c0; c <= c1; ++c)
+        {
+            std::vector<vec_t> const& pieces = w.columns[c];
+            std::vector<size_t> const& starts = w.column_starts[c];
+            for (size_t k = 0; k < starts.size(); ++k)
+            {
+                size_t const begin = starts[k];
+                size_t const end = (k + 1 < starts.size()) ? starts[k + 1] : pieces.size();
+                std::span<vec_t const> const piece(pieces.data() + begin, end - begin);
+
+                size_t r0 = 0;
+                size_t r1 = 0;
+                if (piece.size() >= 2 && split_line(piece, 1, w.rows, w.row_starts, w.last, r0, r1))
+                {
+                    for (size_t r = r0; r <= r1; ++r)
+                    {
+                        std::vector<vec_t> const& row = w.rows[r];
+                        std::vector<size_t> const& row_starts = w.row_starts[r];
+                        for (size_t m = 0; m < row_starts.size(); ++m)
+                        {
+                            size_t const b = row_starts[m];
+                            size_t const e = (m + 1 < row_starts.size()) ? row_starts[m + 1] : row.size();
+                            if (e - b >= 2)
+                            {
+                                emit(m_grid.index(c, r), std::span<vec_t const>(row.data() + b, e - b));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // tiles features [0, count) across threads and concatenates the per-thread output into the tiles
+    template <typename callable_t>
+    void run(size_t const count, size_t const threads, callable_t&& clip_feature)
+    {
+        size_t const chunks = std::clamp(threads, static_cast<size_t>(1), std::max(count, static_cast<size_t>(1)));
+        if (m_workers.size() < chunks)
+        {
+            m_workers.resize(chunks);
+        }
+        for (size_t t = 0; t < chunks; ++t)
+        {
+            worker& w = m_workers[t];
+            w.tiles.resize(m_grid.count());
+            for (tile_buffer<T>& buffer : w.tiles)
+            {
+                buffer.clear();
+            }
+            w.open.assign(m_grid.count(), false);
+            w.columns.resize(m_grid.columns);
+            w.column_starts.resize(m_grid.columns);
+            w.rows.resize(m_grid.rows);
+            w.row_starts.resize(m_grid.rows);
+            w.last.resize(std::max(m_grid.columns, m_grid.rows));
+        }
+
+        parallel_for(count, chunks,
+                     [&](size_t const begin, size_t const end, size_t const thread)
+                     {
+                         worker& w = m_workers[thread];
+                         for (size_t i = begin; i < end; ++i)
+                         {
+                             clip_feature(i, w);
+                             w.finish();
+                         }
+                     });
+
+        // concatenate the output of each thread (in thread order so the features stay in input order)
+        parallel_for(m_tiles.size(), threads,
+                     [&](size_t const begin, size_t const end, size_t)
+                     {
+                         for (size_t i = begin; i < end; ++i)
+                         {
+                             tile_buffer<T>& tile = m_tiles[i];
+                             tile.clear();
+                             for (size_t t = 0; t < chunks; ++t)
+                             {
+                                 append(tile, m_workers[t].tiles[i]);
+                             }
+                         }
+                     });
+    }
+
+    static void append(tile_buffer<T>& dst, tile_buffer<T> const& src)
+    {
+        size_t const vertices = dst.clipped.vertices.size();
+        size_t const parts = dst.clipped.part_count();
+        dst.clipped.vertices.insert(dst.clipped.vertices.end(), src.clipped.vertices.begin(),
+                                    src.clipped.vertices.end());
+        for (size_t i = 1; i < src.clipped.offsets.size(); ++i)
+        {
+            dst.clipped.offsets.push_back(vertices + src.clipped.offsets[i]);
+        }
+        for (size_t i = 1; i < src.clipped.features.size(); ++i)
+        {
+            dst.clipped.features.push_back(parts + src.clipped.features[i]);
+        }
+        dst.sources.insert(dst.sources.end(), src.sources.begin(), src.sources.end());
+    }
+
+private:
+    tile_grid<T> m_grid;
+    std::vector<tile_buffer<T>> m_tiles;
+    std::vector<worker> m_workers;
+};
+
+} // namespace stf::alg
+
+#endif
\ No newline at end of file
@@ -1,16 +1,24 @@
 #ifndef STF_CAM_FRUSTUM_HPP_HEADER_GUARD
 #define STF_CAM_FRUSTUM_HPP_HEADER_GUARD
 
+#include <cstdint>
+
+#include <algorithm>
 #include <array>
 #include <vector>
 
 #include "stf/cam/scamera.hpp"
+#include "stf/enums.hpp"
 #include "stf/geom/aabb.hpp"
+#include "stf/geom/cone.hpp"
 #include "stf/geom/obb.hpp"
 #include "stf/geom/hyperplane.hpp"
+#include "stf/geom/hypersphere.hpp"
+#include "stf/geom/segment.hpp"
 #include "stf/math/basis.hpp"
 #include "stf/math/constants.hpp"
 #include "stf/math/interval.hpp"
+#include "stf/math/matrix.hpp"
 #include "stf/math/vector.hpp"
 
 /**
@@ -23,6 +31,9 @@ namespace stf::cam
 
 /**
  * @brief Struct to represent a frustumed pyramid in R^3
+ *
+ * A frustum is defined by its planes. The vertices, the aabb, and the additional separating axes are derived from the
+ * planes. The derived data is computed on construction, so a frustum is immutable and concurrent queries are safe.
  * @tparam T Number type (eg float)
  */
 template <typename T>
@@ -44,6 +55,21 @@ public:
      */
     using obb_t = geom::obb3<T>;
 
+    /**
+     * @brief Type alias for a sphere
+     */
+    using sphere_t = geom::sphere<T>;
+
+    /**
+     * @brief Type alias for a cone
+     */
+    using cone_t = geom::cone<T>;
+
+    /**
+     * @brief Type alias for a matrix
+     */
+    using mtx_t = math::mtx4<T>;
+
     /**
      * @brief Type alias for a plane
      */
@@ -64,12 +90,38 @@ public:
      */
     static constexpr size_t c_num_planes = 6;
 
+    /**
+     * @brief The number of vertices that define a frustum
+     */
+    static constexpr size_t c_num_vertices = 8;
+
+    /**
+     * @brief A bitmask with a bit set for each plane that defines a frustum
+     */
+    static constexpr uint32_t c_all_planes = (static_cast<uint32_t>(1) << c_num_planes) - 1;
+
 public:
     /**
      * @brief Construct a frustum from a scamera
      */
     explicit frustum(scamera<T> const& camera) : frustum(vertices(camera)) {}
 
+    /**
+     * @brief Construct a frustum from a view-projection matrix
+     *
+     * The planes are extracted directly from the rows of the matrix (Gribb/Hartmann). A point p is inside the frustum
+     * when its clip coordinates c = view_proj * p satisfy -c.w <= c.x <= c.w, -c.w <= c.y <= c.w, and the depth range
+     * constraint on c.z.
+     * @param [in] view_proj The view-projection matrix (eg projection * view)
+     * @param [in] depth The clip space depth range of @p view_proj
+     * @note The vertices are computed from three-plane intersections
+     */
+    explicit frustum(mtx_t const& view_proj, depth_range_types const depth = depth_range_types::zero_to_one)
+        : m_planes(frustum::extract(view_proj, depth))
+        , m_derived(vertices(m_planes))
+    {
+    }
+
     /**
      * @brief Compute whether or not a point is contained in the frustum
      * @param [in] point The query point
@@ -130,6 +182,94 @@ public:
         return true; // fallthrough to return true
     }
 
+    /**
+     * @brief Compute whether or not a sphere is contained in the frustum
+     * @param [in] sphere The query sphere
+     * @return Whether or not @p sphere is contained in @p this
+     */
+    bool contains(sphere_t const& sphere) const
+    {
+        for (size_t i = 0; i < c_num_planes; ++i)
+        {
+            if (m_planes[i].side(sphere.center) < sphere.radius)
+            {
+                return false;
+            }
+        }
+        return true; // fallthrough to return true
+    }
+
+    /**
+     * @brief Compute whether or not a sphere intersects a frustum
+     * @param [in] sphere The query sphere
+     * @note This algorithm may return false positives (returns true for some spheres near the edges of the frustum that
+     * don't actually intersect)
+     * @return Whether or not @p sphere intersects @p this
+     */
+    bool intersects_fast(sphere_t const& sphere) const
+    {
+        // check if any frustum plane entirely excludes the sphere
+        for (size_t i = 0; i < c_num_planes; ++i)
+        {
+            if (m_planes[i].side(sphere.center) < -sphere.radius)
+            {
+                return false;
+            }
+        }
+        return true; // fallthrough to return true
+    }
+
+    /**
+     * @brief Compute whether or not a sphere intersects a frustum
+     * @param [in] sphere The query sphere
+     * @return Whether or not @p sphere intersects @p this
+     */
+    bool intersects(sphere_t const& sphere) const
+    {
+        if (intersects_fast(sphere)) // if the fast check returns true, do a thorough check to avoid false positives
+        {
+            // the closest point of the frustum to a point outside of it lies on a face that the point is outside of. so
+            // the distance to the frustum is the minimum distance to those faces
+            bool outside = false;
+            T min = math::constants<T>::pos_inf;
+            for (size_t i = 0; i < c_num_planes; ++i)
+            {
+                if (m_planes[i].side(sphere.center) < math::constants<T>::zero)
+                {
+                    outside = true;
+                    min = std::min(min, dist_squared_to_face(i, sphere.center));
+                }
+            }
+            return !outside || min <= sphere.radius * sphere.radius;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Compute whether or not a cone intersects a frustum
+     * @param [in] cone The query cone
+     * @note This algorithm may return false positives (returns true for some cones near the edges of the frustum that
+     * don't actually intersect)
+     * @return Whether or not @p cone intersects @p this
+     */
+    bool intersects_fast(cone_t const& cone) const
+    {
+        // check if any frustum plane entirely excludes the cone
+        for (size_t i = 0; i < c_num_planes; ++i)
+        {
+            // check if the extremity in the direction of the normal is contained in the halfspace
+            plane_t const& plane = m_planes[i];
+            if (plane.side(cone.extremity(plane.normal())) < math::constants<T>::zero)
+            {
+                return false;
+            }
+        }
+        return true; // fallthrough to return true
+    }
+
     /**
      * @brief Compute whether or not an aabb intersects a frustum
      * @param [in] aabb The query aabb
@@ -139,7 +279,7 @@ public:
      */
     bool intersects_fast(aabb_t const& aabb) const
     {
-        if (m_aabb.intersects(aabb))
+        if (derived().aabb.intersects(aabb))
         {
             // check if any frustum plane entirely excludes the box
             for (size_t i = 0; i < c_num_planes; ++i)
@@ -156,13 +296,7 @@ public:
 
             // check if any box plane entirely excludes the frustum
             {
-                // clang-format off
-                std::array<vec_t, 8> verts = {
-                    // near points                  // far points
-                    m_vertices.ntl, m_vertices.ntr, m_vertices.ftl, m_vertices.ftr,
-                    m_vertices.nbl, m_vertices.nbr, m_vertices.fbl, m_vertices.fbr,
-                };
-                // clang-format on
+                std::array<vec_t, c_num_vertices> const& verts = derived().points;
 
                 for (size_t d = 0; d < 3; ++d) // iterate over each dimension (x, y, and z)
                 {
@@ -206,6 +340,62 @@ public:
         }
     }
 
+    /**
+     * @brief Classify an aabb against a subset of the planes of the frustum
+     *
+     * Only the planes flagged in @p mask are tested. Planes that entirely contain @p aabb are cleared from @p mask, so
+     * when @p aabb bounds a node in a hierarchy, the children of that node only need to test the planes that remain.
+     * The plane at index @p hint is tested first. If @p aabb is rejected, @p hint is set to the rejecting plane so that
+     * the next query for the same object (eg in the following frame) tests that plane first.
+     * @param [in] aabb The query aabb
+     * @param [in,out] mask Bitmask of the planes to test
+     * @param [in,out] hint Index of the plane to test first
+     * @note This is a plane-only test, so it reports some aabbs as intersecting when they are actually outside (see
+     * @ref intersects_fast)
+     * @note The value of @p mask is only meaningful when @p aabb is not outside
+     * @return The classification of @p aabb relative to @p this
+     */
+    intersection_types classify(aabb_t const& aabb, uint32_t& mask, size_t& hint) const
+    {
+        // test the hinted plane first since it is the plane most likely to reject the aabb
+        if (hint < c_num_planes && (mask & (static_cast<uint32_t>(1) << hint)))
+        {
+            if (classify_plane(aabb, hint, mask) == intersection_types::outside)
+            {
+                return intersection_types::outside;
+            }
+        }
+
+        for (size_t i = 0; i < c_num_planes; ++i)
+        {
+            if (i != hint && (mask & (static_cast<uint32_t>(1) << i)))
+            {
+                if (classify_plane(aabb, i, mask) == intersection_types::outside)
+                {
+                    hint = i;
+                    return intersection_types::outside;
+                }
+            }
+        }
+
+        // every plane that contains the aabb has been removed from the mask
+        return (mask == 0) ? intersection_types::inside : intersection_types::intersecting;
+    }
+
+    /**
+     * @brief Classify an aabb against all the planes of the frustum
+     * @param [in] aabb The query aabb
+     * @note This is a plane-only test, so it reports some aabbs as intersecting when they are actually outside (see
+     * @ref intersects_fast)
+     * @return The classification of @p aabb relative to @p this
+     */
+    intersection_types classify(aabb_t const& aabb) const
+    {
+        uint32_t mask = c_all_planes;
+        size_t hint = 0;
+        return classify(aabb, mask, hint);
+    }
+
     /**
      * @brief Compute whether or not an aabb intersects a frustum
      * @param [in] aabb The query aabb
@@ -215,9 +405,9 @@ public:
     {
         if (intersects_fast(aabb)) // if the fast check returns true, do a more thorough check to avoid false positives
         {
-            // m_canonical_edge_axes contains only the axes defined the cross product of pairs of edges -- the face
+            // canonical_edge_axes contains only the axes defined the cross product of pairs of edges -- the face
             // normals are covered by intersects_fast
-            for (vec_t const& axis : m_canonical_edge_axes)
+            for (vec_t const& axis : derived().canonical_edge_axes)
             {
                 if (axis.length_squared() > math::constants<T>::zero)
                 {
@@ -243,7 +433,7 @@ public:
      */
     bool intersects(obb_t const& obb) const
     {
-        for (vec_t const& axis : frustum::all_axes(obb.basis(), m_planes, m_vertices))
+        for (vec_t const& axis : frustum::all_axes(obb.basis(), m_planes, derived().verts))
         {
             if (axis.length_squared() > math::constants<T>::zero)
             {
@@ -266,14 +456,7 @@ public:
     interval_t projection(vec_t const& axis) const
     {
         interval_t interval(math::constants<T>::pos_inf, math::constants<T>::neg_inf);
-        // clang-format off
-        std::array<vec_t, 8> points = {
-            // near points                  // far points
-            m_vertices.ntl, m_vertices.ntr, m_vertices.ftl, m_vertices.ftr,
-            m_vertices.nbl, m_vertices.nbr, m_vertices.fbl, m_vertices.fbr,
-        };
-        // clang-format on
-        for (vec_t const& point : points)
+        for (vec_t const& point : derived().points)
         {
             T const l = math::dot(point, axis);
             interval.a = std::min(interval.a, l);
@@ -287,6 +470,14 @@ public:
      */
     std::array<plane_t, c_num_planes> const& planes() const { return m_planes; }
 
+    /**
+     * @brief Compute the @p i vertex of the frustum
+     * @param [in] i
+     * @note The vertices are ordered (ntl, ntr, ftl, ftr, nbl, nbr, fbl, fbr)
+     * @return The position of the @p i vertex
+     */
+    vec_t const& vertex(size_t const i) const { return derived().points[i]; }
+
 private:
     struct vertices final
     {
@@ -301,6 +492,18 @@ private:
         vec_t fbl;
         vec_t fbr;
 
+        explicit vertices(std::array<plane_t, c_num_planes> const& planes)
+        {
+            ntl = frustum::intersect(planes[side::nearp], planes[side::top], planes[side::left]);
+            ntr = frustum::intersect(planes[side::nearp], planes[side::top], planes[side::right]);
+            nbl = frustum::intersect(planes[side::nearp], planes[side::bottom], planes[side::left]);
+            nbr = frustum::intersect(planes[side::nearp], planes[side::bottom], planes[side::right]);
+            ftl = frustum::intersect(planes[side::farp], planes[side::top], planes[side::left]);
+            ftr = frustum::intersect(planes[side::farp], planes[side::top], planes[side::right]);
+            fbl = frustum::intersect(planes[side::farp], planes[side::bottom], planes[side::left]);
+            fbr = frustum::intersect(planes[side::farp], planes[side::bottom], planes[side::right]);
+        }
+
         explicit vertices(scamera<T> const& camera)
         {
             // compute camera basis vectors
@@ -394,7 +597,129 @@ private:
     }
 
 private:
-    explicit frustum(vertices const& verts) : m_vertices(verts)
+    // compute the square of the distance from a point to face i (a convex quadrilateral)
+    T dist_squared_to_face(size_t const i, vec_t const& point) const
+    {
+        // vertex indices of each face in order around the face (indexed by side)
+        static constexpr std::array<std::array<size_t, 4>, c_num_planes> c_faces = {{
+            {0, 1, 5, 4}, // near
+            {2, 3, 7, 6}, // far
+            {0, 2, 6, 4}, // left
+            {1, 3, 7, 5}, // right
+            {0, 1, 3, 2}, // top
+            {4, 5, 7, 6}, // bottom
+        }};
+
+        plane_t const& plane = m_planes[i];
+        std::array<vec_t, c_num_vertices> const& points = derived().points;
+        std::array<size_t, 4> const& face = c_faces[i];
+
+        // if the projection of the point onto the plane is on the same side of every edge, it is inside the face
+        T const signed_dist = plane.side(point);
+        vec_t const projected = point - signed_dist * plane.normal();
+        size_t positive = 0;
+        size_t negative = 0;
+        for (size_t e = 0; e < 4; ++e)
+        {
+            vec_t const& a = points[face[e]];
+            vec_t const& b = points[face[(e + 1) % 4]];
+            T const orientation = math::dot(math::cross(b - a, projected - a), plane.normal());
+            positive += (orientation >= math::constants<T>::zero) ? 1 : 0;
+            negative += (orientation <= math::constants<T>::zero) ? 1 : 0;
+        }
+        if (positive == 4 || negative == 4)
+        {
+            return signed_dist * signed_dist;
+        }
+
+        // otherwise the closest point is on the boundary of the face
+        T min = math::constants<T>::pos_inf;
+        for (size_t e = 0; e < 4; ++e)
+        {
+            geom::segment3<T> const edge(points[face[e]], points[face[(e + 1) % 4]]);
+            min = std::min(min, edge.dist_squared(point));
+        }
+        return min;
+    }
+
+    // classify an aabb against a single plane, clearing the plane from the mask if it contains the aabb
+    intersection_types classify_plane(aabb_t const& aabb, size_t const i, uint32_t& mask) const
+    {
+        plane_t const& plane = m_planes[i];
+        if (plane.side(aabb.extremity(plane.normal())) < math::constants<T>::zero)
+        {
+            return intersection_types::outside;
+        }
+        else if (plane.side(aabb.extremity(-plane.normal())) >= math::constants<T>::zero)
+        {
+            mask &= ~(static_cast<uint32_t>(1) << i);
+            return intersection_types::inside;
+        }
+        else
+        {
+            return intersection_types::intersecting;
+        }
+    }
+
+    // data derived from the planes of a frustum
+    struct derived_data final
+    {
+        vertices verts;
+        std::array<vec_t, c_num_vertices> points; // verts ordered as (ntl, ntr, ftl, ftr, nbl, nbr, fbl, fbr)
+        aabb_t aabb;
+        std::array<vec_t, 18> canonical_edge_axes; // additional separation axes to test when intersecting with an aabb
+
+        explicit derived_data(vertices const& _verts)
+            : verts(_verts)
+            , points({verts.ntl, verts.ntr, verts.ftl, verts.ftr, verts.nbl, verts.nbr, verts.fbl, verts.fbr})
+            , aabb(aabb_t::fit(std::vector<vec_t>(points.begin(), points.end())))
+            , canonical_edge_axes(frustum::edge_axes(math::canonical_basis<T, 3>(), verts))
+        {
+        }
+    };
+
+private:
+    // extract the planes from the rows of a view-projection matrix
+    static std::array<plane_t, c_num_planes> extract(mtx_t const& view_proj, depth_range_types const depth)
+    {
+        math::vec4<T> const r0 = view_proj.row(0).as_vec();
+        math::vec4<T> const r1 = view_proj.row(1).as_vec();
+        math::vec4<T> const r2 = view_proj.row(2).as_vec();
+        math::vec4<T> const r3 = view_proj.row(3).as_vec();
+
+        std::array<plane_t, c_num_planes> planes;
+        planes[nearp] = frustum::extract(depth == depth_range_types::zero_to_one ? r2 : r3 + r2);
+        planes[farp] = frustum::extract(r3 - r2);
+        planes[left] = frustum::extract(r3 + r0);
+        planes[right] = frustum::extract(r3 - r0);
+        planes[top] = frustum::extract(r3 - r1);
+        planes[bottom] = frustum::extract(r3 + r1);
+        return planes;
+    }
+
+    // extract a plane with an inward normal from the coefficients (a, b, c, d) of the plane ax + by + cz + d = 0
+    static plane_t extract(math::vec4<T> const& coefficients)
+    {
+        vec_t const normal = coefficients.xyz;
+        vec_t const point = (-coefficients.w / normal.length_squared()) * normal;
+        return plane_t(point, normal);
+    }
+
+    // compute the point at which three planes intersect
+    static vec_t intersect(plane_t const& p0, plane_t const& p1, plane_t const& p2)
+    {
+        vec_t const& n0 = p0.normal();
+        vec_t const& n1 = p1.normal();
+        vec_t const& n2 = p2.normal();
+        T const d0 = math::dot(n0, p0.point());
+        T const d1 = math::dot(n1, p1.point());
+        T const d2 = math::dot(n2, p2.point());
+        vec_t const sum = d0 * math::cross(n1, n2) + d1 * math::cross(n2, n0) + d2 * math::cross(n0, n1);
+        return sum / math::dot(n0, math::cross(n1, n2));
+    }
+
+private:
+    explicit frustum(vertices const& verts) : m_derived(verts)
     {
         m_planes[farp] = geom::fit_plane(verts.ftl, verts.fbl, verts.ftr);
         m_planes[nearp] = geom::plane<T>(verts.ntl, -m_planes[farp].normal()); // flip far plane avoid precision issues
@@ -402,24 +727,13 @@ private:
         m_planes[right] = geom::fit_plane(verts.ftr, verts.fbr, verts.ntr);
         m_planes[top] = geom::fit_plane(verts.ftl, verts.ftr, verts.ntl);
         m_planes[bottom] = geom::fit_plane(verts.fbr, verts.fbl, verts.nbr);
-
-        // clang-format off
-        std::vector<vec_t> points = {
-            // near points                  // far points
-            m_vertices.ntl, m_vertices.ntr, m_vertices.ftl, m_vertices.ftr,
-            m_vertices.nbl, m_vertices.nbr, m_vertices.fbl, m_vertices.fbr,
-        };
-        // clang-format on
-        m_aabb = aabb_t::fit(points);
-
-        m_canonical_edge_axes = frustum::edge_axes(math::canonical_basis<T, 3>(), m_vertices);
     }
 
+    inline derived_data const& derived() const { return m_derived; }
+
 private:
     std::array<plane_t, c_num_planes> m_planes;
-    vertices m_vertices;
-    aabb_t m_aabb;
-    std::array<vec_t, 18> m_canonical_edge_axes; // additional separation axes to test when intersecting with an aabb
+    derived_data m_derived;
 };
 
 } // namespace stf::cam
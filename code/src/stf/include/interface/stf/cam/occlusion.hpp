@@ -0,0 +1,450 @@
+#ifndef STF_CAM_OCCLUSION_HPP_HEADER_GUARD
+#define STF_CAM_OCCLUSION_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
+#include "stf/alg/parallel.hpp"
+#include "stf/cam/scamera.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/matrix.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file occlusion.hpp
+ * @brief A file containing a software depth buffer for occlusion culling
+ */
+
+namespace stf::cam
+{
+
+/**
+ * @brief Class that rasterizes occluders into a low resolution depth buffer and tests bounding volumes against it
+ *
+ * Occluder triangles are transformed by a view-projection matrix that maps depth to [0, 1] (eg
+ * scamera::perspective() * scamera::view()) and rasterized with a pixel center coverage rule so that triangles
+ * sharing an edge leave no gaps. The value written to a pixel is the farthest depth of the triangle over that pixel. A
+ * hierarchical depth (Hi-Z) pyramid stores the farthest depth of each 2x2 block of the level below it. Queries project
+ * an aabb to a screen rectangle and nearest depth, then compare against a pyramid level where the rectangle covers at
+ * most 2x2 texels.
+ *
+ * The depth comparisons only err on the side of reporting objects as visible, but coverage is sampled at pixel
+ * centers. So an occluder is treated as covering the whole of every pixel whose center it covers, and an object that
+ * is only visible through the uncovered part of such a pixel (eg past the silhouette of an occluder) can be reported
+ * as occluded. The culling is approximate at the resolution of the buffer rather than strictly conservative.
+ *
+ * Rasterization is distributed across threads by horizontal bands of rows, so threads never write to the same pixel.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+class occlusion_buffer final
+{
+public:
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec3<T>;
+
+    /**
+     * @brief Type alias for an aabb
+     */
+    using aabb_t = geom::aabb3<T>;
+
+    /**
+     * @brief Type alias for a matrix
+     */
+    using mtx_t = math::mtx4<T>;
+
+public:
+    /**
+     * @brief Construct a cleared occlusion buffer with specified dimensions
+     * @param [in] width The width in pixels
+     * @param [in] height The height in pixels
+     */
+    occlusion_buffer(size_t const width, size_t const height)
+    {
+        size_t w = std::max(width, static_cast<size_t>(1));
+        size_t h = std::max(height, static_cast<size_t>(1));
+        m_levels.push_back(level(w, h));
+        while (w > 1 || h > 1)
+        {
+            w = (w + 1) / 2;
+            h = (h + 1) / 2;
+            m_levels.push_back(level(w, h));
+        }
+    }
+
+    /**
+     * @brief Reset every pixel to the far plane
+     */
+    void clear()
+    {
+        for (level& lvl : m_levels)
+        {
+            std::fill(lvl.depth.begin(), lvl.depth.end(), math::constants<T>::one);
+        }
+    }
+
+    /**
+     * @brief Rasterize indexed occluder triangles into the buffer
+     * @param [in] vertices The world space positions of the occluder vertices
+     * @param [in] indices Triplets of indices into @p vertices that define the triangles
+     * @param [in] view_proj The view-projection matrix (with depth mapped to [0, 1])
+     * @param [in] threads The maximum number of threads to use
+     * @note Triangles that cross the near plane are skipped
+     * @note The Hi-Z pyramid is rebuilt after rasterizing
+     */
+    void rasterize(std::span<vec_t const> const vertices, std::span<uint32_t const> const indices,
+                   mtx_t const& view_proj, size_t const threads = 1)
+    {
+        // transform every vertex to screen space
+        std::vector<math::vec4<T>> screen(vertices.size());
+        alg::parallel_for(vertices.size(), threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                screen[i] = to_screen(view_proj * math::vec4<T>(vertices[i], math::constants<T>::one));
+            }
+        });
+
+        // set up each triangle once and discard those that can't cover a pixel
+        std::vector<triangle> triangles;
+        triangles.reserve(indices.size() / 3);
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            triangle tri;
+            if (setup(screen[indices[i]], screen[indices[i + 1]], screen[indices[i + 2]], tri))
+            {
+                triangles.push_back(tri);
+            }
+        }
+
+        // rasterize in horizontal bands
+        level& base = m_levels.front();
+        alg::parallel_for(base.height, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (triangle const& tri : triangles)
+            {
+                raster(tri, begin, end);
+            }
+        });
+
+        build_pyramid(threads);
+    }
+
+    /**
+     * @brief Rasterize indexed occluder triangles into the buffer as seen by a camera
+     * @param [in] vertices The world space positions of the occluder vertices
+     * @param [in] indices Triplets of indices into @p vertices that define the triangles
+     * @param [in] camera The camera
+     * @param [in] threads The maximum number of threads to use
+     */
+    void rasterize(std::span<vec_t const> const vertices, std::span<uint32_t const> const indices,
+                   scamera<T> const& camera, size_t const threads = 1)
+    {
+        rasterize(vertices, indices, camera.perspective() * camera.view(), threads);
+    }
+
+    /**
+     * @brief Compute whether or not an aabb is hidden behind the rasterized occluders
+     * @param [in] box The query aabb
+     * @param [in] view_proj The view-projection matrix (with depth mapped to [0, 1])
+     * @note Boxes that cross the near plane or lie entirely off screen are reported as not occluded
+     * @return Whether or not @p box is occluded
+     */
+    bool occluded(aabb_t const& box, mtx_t const& view_proj) const
+    {
+        level const& base = m_levels.front();
+
+        // compute the screen rectangle and nearest depth of the box
+        T min_x = math::constants<T>::pos_inf;
+        T min_y = math::constants<T>::pos_inf;
+        T max_x = math::constants<T>::neg_inf;
+        T max_y = math::constants<T>::neg_inf;
+        T min_z = math::constants<T>::pos_inf;
+        for (size_t v = 0; v < aabb_t::vertex_count(); ++v)
+        {
+            math::vec4<T> const clip = view_proj * math::vec4<T>(box.vertex(v), math::constants<T>::one);
+            if (clip.w <= math::constants<T>::tol || clip.z < math::constants<T>::zero)
+            {
+                return false;
+            }
+            math::vec4<T> const p = to_screen(clip);
+            min_x = std::min(min_x, p.x);
+            min_y = std::min(min_y, p.y);
+            max_x = std::max(max_x, p.x);
+            max_y = std::max(max_y, p.y);
+            min_z = std::min(min_z, p.z);
+        }
+
+        T const width = static_cast<T>(base.width);
+        T const height = static_cast<T>(base.height);
+        if (max_x < math::constants<T>::zero || max_y < math::constants<T>::zero || width <= min_x || height <= min_y)
+        {
+            return false;
+        }
+
+        size_t x0 = pixel(min_x, base.width);
+        size_t y0 = pixel(min_y, base.height);
+        size_t x1 = pixel(max_x, base.width);
+        size_t y1 = pixel(max_y, base.height);
+
+        // pick the finest level at which the rectangle covers at most 2x2 texels
+        size_t l = 0;
+        while (l + 1 < m_levels.size() && ((x1 >> l) - (x0 >> l) > 1 || (y1 >> l) - (y0 >> l) > 1))
+        {
+            ++l;
+        }
+
+        level const& lvl = m_levels[l];
+        for (size_t y = y0 >> l; y <= (y1 >> l); ++y)
+        {
+            for (size_t x = x0 >> l; x <= (x1 >> l); ++x)
+            {
+                if (min_z <= lvl.depth[y * lvl.width + x])
+                {
+                    return false;
+                }
+            }
+        }
+        return true; // fallthrough to true
+    }
+
+    /**
+     * @brief Compute whether or not an aabb is hidden behind the rasterized occluders as seen by a camera
+     * @param [in] box The query aabb
+     * @param [in] camera The camera
+     * @return Whether or not @p box is occluded
+     */
+    bool occluded(aabb_t const& box, scamera<T> const& camera) const
+    {
+        return occluded(box, camera.perspective() * camera.view());
+    }
+
+    /**
+     * @brief Cull a batch of aabbs against the rasterized occluders
+     * @param [in] boxes The query aabbs
+     * @param [in] view_proj The view-projection matrix (with depth mapped to [0, 1])
+     * @param [out] visible The indices of the aabbs in @p boxes that are not occluded (in increasing order)
+     * @note @p visible must have at least as many entries as @p boxes
+     * @return The number of indices written to @p visible
+     */
+    size_t cull(std::span<aabb_t const> const boxes, mtx_t const& view_proj, std::span<size_t> const visible) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            if (!occluded(boxes[i], view_proj))
+            {
+                visible[count++] = i;
+            }
+        }
+        return count;
+    }
+
+public:
+    /**
+     * @brief Getter for the width of the buffer
+     * @return The width in pixels
+     */
+    size_t width() const { return m_levels.front().width; }
+
+    /**
+     * @brief Getter for the height of the buffer
+     * @return The height in pixels
+     */
+    size_t height() const { return m_levels.front().height; }
+
+    /**
+     * @brief Getter for the number of levels in the Hi-Z pyramid (including the full resolution level)
+     * @return The number of levels
+     */
+    size_t level_count() const { return m_levels.size(); }
+
+    /**
+     * @brief Getter for the depth of a texel in the Hi-Z pyramid
+     * @param [in] l The level (0 is full resolution)
+     * @param [in] x The column
+     * @param [in] y The row (0 is the top of the screen)
+     * @return The farthest occluder depth in the texel
+     */
+    T depth(size_t const l, size_t const x, size_t const y) const
+    {
+        level const& lvl = m_levels[l];
+        return lvl.depth[y * lvl.width + x];
+    }
+
+private:
+    struct level final
+    {
+        size_t width;
+        size_t height;
+        std::vector<T> depth;
+
+        level(size_t const _width, size_t const _height)
+            : width(_width)
+            , height(_height)
+            , depth(_width * _height, math::constants<T>::one)
+        {
+        }
+    };
+
+    // a triangle in screen space with its edge functions and depth plane
+    struct triangle final
+    {
+        std::array<math::vec2<T>, 3> vertices;
+        T min_x;
+        T min_y;
+        T max_x;
+        T max_y;
+        T z;     // depth at (0, 0)
+        T max_z; // farthest depth of the triangle
+        T dzdx;  // change in depth per pixel in x
+        T dzdy;  // change in depth per pixel in y
+    };
+
+private:
+    // convert clip coordinates to (x, y) in pixels (with y pointing down), z in [0, 1], and w
+    math::vec4<T> to_screen(math::vec4<T> const& clip) const
+    {
+        level const& base = m_levels.front();
+        T const half = math::constants<T>::half;
+        T const inv_w = math::constants<T>::one / clip.w;
+        T const x = (half + half * clip.x * inv_w) * static_cast<T>(base.width);
+        T const y = (half - half * clip.y * inv_w) * static_cast<T>(base.height);
+        return math::vec4<T>(x, y, clip.z * inv_w, clip.w);
+    }
+
+    // compute the index of the pixel containing a screen coordinate (clamped to the screen)
+    static size_t pixel(T const coord, size_t const size)
+    {
+        T const clamped = std::clamp(std::floor(coord), math::constants<T>::zero, static_cast<T>(size - 1));
+        return static_cast<size_t>(clamped);
+    }
+
+    static bool setup(math::vec4<T> const& a, math::vec4<T> const& b, math::vec4<T> const& c, triangle& tri)
+    {
+        // skip triangles that cross the near plane
+        if (a.w <= math::constants<T>::tol || b.w <= math::constants<T>::tol || c.w <= math::constants<T>::tol ||
+            a.z < math::constants<T>::zero || b.z < math::constants<T>::zero || c.z < math::constants<T>::zero)
+        {
+            return false;
+        }
+
+        T const area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (std::abs(area) <= math::constants<T>::tol)
+        {
+            return false;
+        }
+
+        // orient the triangle so that the edge functions are positive on the interior
+        bool const flip = area < math::constants<T>::zero;
+        tri.vertices[0] = math::vec2<T>(a.x, a.y);
+        tri.vertices[1] = flip ? math::vec2<T>(c.x, c.y) : math::vec2<T>(b.x, b.y);
+        tri.vertices[2] = flip ? math::vec2<T>(b.x, b.y) : math::vec2<T>(c.x, c.y);
+
+        tri.min_x = std::min({a.x, b.x, c.x});
+        tri.min_y = std::min({a.y, b.y, c.y});
+        tri.max_x = std::max({a.x, b.x, c.x});
+        tri.max_y = std::max({a.y, b.y, c.y});
+
+        // depth is affine in screen space, so solve for the plane z = z0 + dzdx * x + dzdy * y
+        T const inv_area = math::constants<T>::one / area;
+        tri.dzdx = ((b.z - a.z) * (c.y - a.y) - (c.z - a.z) * (b.y - a.y)) * inv_area;
+        tri.dzdy = ((c.z - a.z) * (b.x - a.x) - (b.z - a.z) * (c.x - a.x)) * inv_area;
+        tri.z = a.z - tri.dzdx * a.x - tri.dzdy * a.y;
+        tri.max_z = std::max({a.z, b.z, c.z});
+        return true;
+    }
+
+    // rasterize the pixels of a triangle in the rows [row_begin, row_end)
+    void raster(triangle const& tri, size_t const row_begin, size_t const row_end)
+    {
+        level& base = m_levels.front();
+
+        // only consider pixels whose centers are inside the bounding box of the triangle
+        T const half = math::constants<T>::half;
+        T const width = static_cast<T>(base.width);
+        T const height = static_cast<T>(base.height);
+        T const x_begin = std::max(std::ceil(tri.min_x - half), math::constants<T>::zero);
+        T const x_end = std::min(std::ceil(tri.max_x - half), width);
+        T const y_begin = std::max(std::ceil(tri.min_y - half), static_cast<T>(row_begin));
+        T const y_end = std::min(std::ceil(tri.max_y - half), std::min(height, static_cast<T>(row_end)));
+        if (x_end <= x_begin || y_end <= y_begin)
+        {
+            return;
+        }
+
+        // the farthest depth over a pixel is at the corner in the direction of increasing depth
+        T const dz_max = half * (std::abs(tri.dzdx) + std::abs(tri.dzdy));
+
+        size_t const x0 = static_cast<size_t>(x_begin);
+        size_t const x1 = static_cast<size_t>(x_end);
+        for (size_t y = static_cast<size_t>(y_begin); y < static_cast<size_t>(y_end); ++y)
+        {
+            T const cy = static_cast<T>(y) + half;
+            T* row = base.depth.data() + y * base.width;
+            for (size_t x = x0; x < x1; ++x)
+            {
+                T const cx = static_cast<T>(x) + half;
+
+                // a pixel is covered when its center is inside the triangle. ties are broken with a top-left rule so
+                // that a pixel center on an edge shared by two triangles is covered by exactly one of them
+                bool covered = true;
+                for (size_t e = 0; e < 3; ++e)
+                {
+                    math::vec2<T> const& a = tri.vertices[e];
+                    math::vec2<T> const& b = tri.vertices[(e + 1) % 3];
+                    T const dx = b.x - a.x;
+                    T const dy = b.y - a.y;
+                    T const f = dx * (cy - a.y) - dy * (cx - a.x);
+                    T const zero = math::constants<T>::zero;
+                    bool const top_left = dy < zero || (dy == zero && dx > zero);
+                    covered = covered && (f > zero || (f == zero && top_left));
+                }
+
+                T const z = std::min(tri.z + tri.dzdx * cx + tri.dzdy * cy + dz_max, tri.max_z);
+                row[x] = covered ? std::min(row[x], z) : row[x];
+            }
+        }
+    }
+
+    void build_pyramid(size_t const threads)
+    {
+        for (size_t l = 1; l < m_levels.size(); ++l)
+        {
+            level const& fine = m_levels[l - 1];
+            level& coarse = m_levels[l];
+            alg::parallel_for(coarse.height, threads, [&](size_t const begin, size_t const end, size_t)
+            {
+                for (size_t y = begin; y < end; ++y)
+                {
+                    size_t const fy0 = 2 * y;
+                    size_t const fy1 = std::min(2 * y + 1, fine.height - 1);
+                    for (size_t x = 0; x < coarse.width; ++x)
+                    {
+                        size_t const fx0 = 2 * x;
+                        size_t const fx1 = std::min(2 * x + 1, fine.width - 1);
+                        T const* top = fine.depth.data() + fy0 * fine.width;
+                        T const* bottom = fine.depth.data() + fy1 * fine.width;
+                        T const farthest = std::max(std::max(top[fx0], top[fx1]), std::max(bottom[fx0], bottom[fx1]));
+                        coarse.depth[y * coarse.width + x] = farthest;
+                    }
+                }
+            });
+        }
+    }
+
+private:
+    std::vector<level> m_levels;
+};
+
+} // namespace stf::cam
+
+#endif
\ No newline at end of file
@@ -0,0 +1,265 @@
+#ifndef STF_CAM_PREPARED_FRUSTUM_HPP_HEADER_GUARD
+#define STF_CAM_PREPARED_FRUSTUM_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include "stf/cam/frustum.hpp"
+#include "stf/geom/obb.hpp"
+#include "stf/math/basis.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/interval.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file prepared_frustum.hpp
+ * @brief A file containing a class that caches frustum data for repeated culling queries
+ */
+
+namespace stf::cam
+{
+
+/**
+ * @brief Class that caches the data of a @ref frustum that is reused by many culling queries
+ *
+ * Testing an obb against a frustum with the separating axis theorem requires the frustum face normals, the obb face
+ * normals, and the cross products of each frustum edge with each obb face normal. A @ref prepared_frustum computes the
+ * frustum edge directions and the projection of the frustum onto its face normals once (eg once per frame) so that
+ * each obb query only does work that depends on the obb.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+class prepared_frustum final
+{
+public:
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec3<T>;
+
+    /**
+     * @brief Type alias for an obb
+     */
+    using obb_t = geom::obb3<T>;
+
+    /**
+     * @brief Type alias for an interval
+     */
+    using interval_t = math::interval<T>;
+
+    /**
+     * @brief The number of planes that define a frustum
+     */
+    static constexpr size_t c_num_planes = frustum<T>::c_num_planes;
+
+    /**
+     * @brief The number of vertices that define a frustum
+     */
+    static constexpr size_t c_num_vertices = frustum<T>::c_num_vertices;
+
+    /**
+     * @brief The number of distinct edge directions of a frustum
+     */
+    static constexpr size_t c_num_edges = 6;
+
+public:
+    /**
+     * @brief Construct from a @ref frustum
+     * @param [in] frustum
+     */
+    explicit prepared_frustum(frustum<T> const& frustum)
+    {
+        for (size_t v = 0; v < c_num_vertices; ++v)
+        {
+            m_vertices[v] = frustum.vertex(v);
+        }
+
+        for (size_t i = 0; i < c_num_planes; ++i)
+        {
+            m_normals[i] = frustum.planes()[i].normal();
+            m_face_projections[i] = project(m_normals[i]);
+
+            // store the plane equations as a structure of arrays for batch sphere culling
+            m_nx[i] = m_normals[i].x;
+            m_ny[i] = m_normals[i].y;
+            m_nz[i] = m_normals[i].z;
+            m_offsets[i] = -math::dot(m_normals[i], frustum.planes()[i].point());
+        }
+
+        // vertex indices of one edge in each direction. the remaining edges of the frustum are parallel to one of these
+        static constexpr std::array<std::array<size_t, 2>, c_num_edges> c_edges = {{
+            {3, 2}, // ftr - ftl
+            {3, 7}, // ftr - fbr
+            {2, 0}, // ftl - ntl
+            {3, 1}, // ftr - ntr
+            {6, 4}, // fbl - nbl
+            {7, 5}, // fbr - nbr
+        }};
+        for (size_t j = 0; j < c_num_edges; ++j)
+        {
+            m_edges[j] = math::normalized(m_vertices[c_edges[j][0]] - m_vertices[c_edges[j][1]]);
+            for (size_t v = 0; v < c_num_vertices; ++v)
+            {
+                m_edge_crosses[j][v] = math::cross(m_edges[j], m_vertices[v]);
+            }
+        }
+    }
+
+    /**
+     * @brief Compute whether or not an obb intersects the frustum
+     * @param [in] obb The query obb
+     * @note The basis of @p obb is assumed to be orthonormal
+     * @return Whether or not @p obb intersects the frustum
+     */
+    bool intersects(obb_t const& obb) const
+    {
+        vec_t const& center = obb.center();
+        vec_t const& half_extents = obb.half_extents();
+        math::basis<T, 3> const& basis = obb.basis();
+
+        // check the frustum face normals -- these are the axes most likely to separate
+        for (size_t i = 0; i < c_num_planes; ++i)
+        {
+            vec_t const& normal = m_normals[i];
+            T const radius = half_extents[0] * std::abs(math::dot(normal, basis[0])) +
+                             half_extents[1] * std::abs(math::dot(normal, basis[1])) +
+                             half_extents[2] * std::abs(math::dot(normal, basis[2]));
+            if (prepared_frustum::separates(m_face_projections[i], math::dot(center, normal), radius))
+            {
+                return false;
+            }
+        }
+
+        // check the obb face normals
+        for (size_t k = 0; k < 3; ++k)
+        {
+            if (prepared_frustum::separates(project(basis[k]), math::dot(center, basis[k]), half_extents[k]))
+            {
+                return false;
+            }
+        }
+
+        // check the cross products of each frustum edge with each obb face normal. for the axis b x e, the projection
+        // of a point p is (b x e) . p = b . (e x p), so the frustum projections use the cached products e x v. the
+        // radius of the obb is the sum over the other two face normals of h_m * |b_m . (b x e)|, which simplifies to
+        // h_m * |e . b_l| where l is the remaining index
+        for (size_t j = 0; j < c_num_edges; ++j)
+        {
+            vec_t const& edge = m_edges[j];
+            vec_t const cross = math::cross(edge, center);
+            vec_t const d(math::dot(edge, basis[0]), math::dot(edge, basis[1]), math::dot(edge, basis[2]));
+            for (size_t k = 0; k < 3; ++k)
+            {
+                if (math::constants<T>::one - d[k] * d[k] > math::constants<T>::tol) // skip (near) parallel pairs
+                {
+                    size_t const a = (k + 1) % 3;
+                    size_t const b = (k + 2) % 3;
+                    T const radius = half_extents[a] * std::abs(d[b]) + half_extents[b] * std::abs(d[a]);
+
+                    interval_t projection(math::constants<T>::pos_inf, math::constants<T>::neg_inf);
+                    for (vec_t const& edge_cross : m_edge_crosses[j])
+                    {
+                        T const l = math::dot(basis[k], edge_cross);
+                        projection.a = std::min(projection.a, l);
+                        projection.b = std::max(projection.b, l);
+                    }
+
+                    if (prepared_frustum::separates(projection, math::dot(basis[k], cross), radius))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true; // fallthrough to true
+    }
+
+    /**
+     * @brief Cull a batch of obbs against the frustum
+     * @param [in] obbs The query obbs
+     * @param [out] visible The indices of the obbs in @p obbs that intersect the frustum (in increasing order)
+     * @note @p visible must have at least as many entries as @p obbs
+     * @return The number of indices written to @p visible
+     */
+    size_t cull(std::span<obb_t const> const obbs, std::span<size_t> const visible) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < obbs.size(); ++i)
+        {
+            if (intersects(obbs[i]))
+            {
+                visible[count++] = i;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Cull a batch of spheres against the frustum
+     *
+     * The spheres are stored as a structure of arrays so that the plane tests for consecutive spheres can be vectorized
+     * by the compiler. The loop body is branchless: every index is written to @p visible and the output position only
+     * advances for visible spheres.
+     * @param [in] x The x coordinates of the centers
+     * @param [in] y The y coordinates of the centers
+     * @param [in] z The z coordinates of the centers
+     * @param [in] radius The radii
+     * @param [out] visible The indices of the spheres that intersect the frustum (in increasing order)
+     * @note All input spans must have the same size and @p visible must have at least as many entries
+     * @note This is a plane-only test so it may return false positives (see @ref frustum::intersects_fast)
+     * @return The number of indices written to @p visible
+     */
+    size_t cull(std::span<T const> const x, std::span<T const> const y, std::span<T const> const z,
+                std::span<T const> const radius, std::span<size_t> const visible) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            T min = math::constants<T>::pos_inf;
+            for (size_t p = 0; p < c_num_planes; ++p)
+            {
+                min = std::min(min, m_nx[p] * x[i] + m_ny[p] * y[i] + m_nz[p] * z[i] + m_offsets[p]);
+            }
+            visible[count] = i;
+            count += (min >= -radius[i]) ? 1 : 0;
+        }
+        return count;
+    }
+
+private:
+    interval_t project(vec_t const& axis) const
+    {
+        interval_t interval(math::constants<T>::pos_inf, math::constants<T>::neg_inf);
+        for (vec_t const& vertex : m_vertices)
+        {
+            T const l = math::dot(vertex, axis);
+            interval.a = std::min(interval.a, l);
+            interval.b = std::max(interval.b, l);
+        }
+        return interval;
+    }
+
+    static inline bool separates(interval_t const& projection, T const center, T const radius)
+    {
+        return center + radius < projection.a || projection.b < center - radius;
+    }
+
+private:
+    std::array<vec_t, c_num_vertices> m_vertices;
+    std::array<vec_t, c_num_planes> m_normals;
+    std::array<interval_t, c_num_planes> m_face_projections; // projection of the frustum onto each face normal
+    std::array<T, c_num_planes> m_nx;      // x component of each plane normal
+    std::array<T, c_num_planes> m_ny;      // y component of each plane normal
+    std::array<T, c_num_planes> m_nz;      // z component of each plane normal
+    std::array<T, c_num_planes> m_offsets; // offset of each plane (so that n . p + offset is the signed distance)
+    std::array<vec_t, c_num_edges> m_edges;
+    std::array<std::array<vec_t, c_num_vertices>, c_num_edges> m_edge_crosses; // edge x vertex for each pair
+};
+
+} // namespace stf::cam
+
+#endif
\ No newline at end of file
@@ -24,6 +24,46 @@ inline boundary_types complement(boundary_types input)
     return static_cast<boundary_types>(~casted);
 }
 
+/**
+ * @brief An enum to specify how a volume is classified relative to a region
+ */
+enum class intersection_types : uint32_t
+{
+    outside = 0,
+    intersecting = 1,
+    inside = 2,
+};
+
+/**
+ * @brief An enum to specify how a point is classified relative to a region
+ */
+enum class containment_types : uint32_t
+{
+    outside = 0,
+    boundary = 1,
+    inside = 2,
+};
+
+/**
+ * @brief An enum to specify the depth range of clip space
+ */
+enum class depth_range_types : uint32_t
+{
+    zero_to_one = 0,    // eg math::perspective
+    neg_one_to_one = 1, // eg math::orthographic
+};
+
+/**
+ * @brief An enum to specify a boolean operation on regions
+ */
+enum class boolean_types : uint32_t
+{
+    unite = 0,        // in either region
+    intersect = 1,    // in both regions
+    subtract = 2,     // in the first region but not the second
+    exclusive_or = 3, // in exactly one region
+};
+
 } // namespace stf
 
 #endif
\ No newline at end of file
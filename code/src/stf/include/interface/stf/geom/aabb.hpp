@@ -8,6 +8,7 @@
 
 #include "stf/math/constants.hpp"
 #include "stf/math/interval.hpp"
+#include "stf/math/interpolation.hpp"
 #include "stf/math/vector.hpp"
 
 /**
@@ -0,0 +1,116 @@
+#ifndef STF_GEOM_CONE_HPP_HEADER_GUARD
+#define STF_GEOM_CONE_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file cone.hpp
+ * @brief A file containing a templated cone class along with associated functions
+ */
+
+namespace stf::geom
+{
+
+/**
+ * @brief A class representing a finite right circular cone in R^3 (eg the volume lit by a spot light)
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+struct cone final
+{
+
+    /**
+     * @brief Type alias for vector type
+     */
+    using vec_t = math::vec3<T>;
+
+public:
+    /**
+     * @brief The apex of the cone
+     */
+    vec_t apex;
+
+    /**
+     * @brief The direction from the apex to the center of the base
+     * @note Assumed to be a unit vector
+     */
+    vec_t axis;
+
+    /**
+     * @brief The distance from the apex to the base
+     */
+    T height;
+
+    /**
+     * @brief The angle between the axis and the lateral surface (half of the opening angle)
+     */
+    T angle;
+
+    /**
+     * @brief Construct from an apex, axis, height, and angle
+     * @param [in] _apex
+     * @param [in] _axis
+     * @param [in] _height
+     * @param [in] _angle
+     */
+    cone(vec_t const& _apex, vec_t const& _axis, T const _height, T const _angle)
+        : apex(_apex)
+        , axis(_axis)
+        , height(_height)
+        , angle(_angle)
+    {
+    }
+
+    /**
+     * @brief Compute the center of the base of the cone
+     * @return The center of the base
+     */
+    vec_t base_center() const { return apex + height * axis; }
+
+    /**
+     * @brief Compute the radius of the base of the cone
+     * @return The radius of the base
+     */
+    T base_radius() const { return height * std::tan(angle); }
+
+    /**
+     * @brief Compute an extremity of the cone in a given direction
+     * @param [in] direction
+     * @return A point of @p this that is maximally extreme in @p direction
+     */
+    vec_t extremity(vec_t const& direction) const
+    {
+        // the extremity is either the apex or the point on the rim of the base that is extreme in direction
+        vec_t rim = base_center();
+        vec_t const perp = direction - math::dot(direction, axis) * axis;
+        if (perp.length_squared() > math::constants<T>::zero)
+        {
+            rim += base_radius() * math::normalized(perp);
+        }
+        return (math::dot(apex, direction) > math::dot(rim, direction)) ? apex : rim;
+    }
+
+    /**
+     * @brief Compute whether or not the cone contains a point
+     * @param [in] query
+     * @return Whether or not @p this contains @p query
+     */
+    bool contains(vec_t const& query) const
+    {
+        vec_t const delta = query - apex;
+        T const l = math::dot(delta, axis);
+        if (l < math::constants<T>::zero || height < l)
+        {
+            return false;
+        }
+        T const r = l * std::tan(angle);
+        return (delta - l * axis).length_squared() <= r * r;
+    }
+};
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
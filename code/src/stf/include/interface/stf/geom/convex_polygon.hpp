@@ -0,0 +1,427 @@
+#ifndef STF_GEOM_CONVEX_POLYGON_HPP_HEADER_GUARD
+#define STF_GEOM_CONVEX_POLYGON_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "stf/enums.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/obb.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/geom/segment.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file convex_polygon.hpp
+ * @brief A file containing a templated convex polygon class along with associated functions
+ */
+
+namespace stf::geom
+{
+
+/**
+ * @brief A class to represent a convex polygon
+ *
+ * The vertices are stored in counterclockwise order (clockwise input is reversed and repeated vertices are removed).
+ * Convexity allows containment queries in O(log n) time by binary searching for the wedge (fanned from the first
+ * vertex) that contains the query. Intersection and distance queries between two convex polygons with n and m vertices
+ * are O(n + m): the Minkowski difference of the polygons is built by merging their edges in order of angle, and the
+ * polygons intersect iff the difference contains the origin.
+ * @tparam T Number type (eg float)
+ * @note The input vertices are assumed to be in convex position (eg the output of @ref alg::convex_hull)
+ */
+template <typename T>
+class convex_polygon final
+{
+public:
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec2<T>;
+
+    /**
+     * @brief Type alias for an aabb
+     */
+    using aabb_t = geom::aabb2<T>;
+
+public:
+    /**
+     * @brief Default constructor -- empty @ref convex_polygon
+     */
+    convex_polygon() : convex_polygon(std::vector<vec_t>()) {}
+
+    /**
+     * @brief Construct from an array of vertices in convex position -- there is an implicit edge from the last to the
+     * first vertex
+     * @param [in] vertices
+     */
+    explicit convex_polygon(std::vector<vec_t> const& vertices)
+        : m_vertices(convex_polygon::normalize(vertices))
+        , m_aabb(aabb_t::fit(m_vertices))
+    {
+    }
+
+    /**
+     * @brief Construct from a @ref polygon whose vertices are in convex position
+     * @param [in] polygon
+     */
+    explicit convex_polygon(polygon<T> const& polygon) : convex_polygon(polygon.vertices()) {}
+
+    /**
+     * @brief Construct from an @ref obb2
+     * @param [in] box
+     */
+    explicit convex_polygon(obb2<T> const& box)
+        : convex_polygon(std::vector<vec_t>({box.vertex(0), box.vertex(1), box.vertex(3), box.vertex(2)}))
+    {
+    }
+
+    /**
+     * @brief Compute whether or not a @ref convex_polygon is empty
+     * @note Must have at least 3 vertices to be considered non-empty
+     * @return Whether or not @p this is empty
+     */
+    inline bool is_empty() const { return m_vertices.size() < 3; }
+
+    /**
+     * @brief Compute the size of a @ref convex_polygon
+     * @return The number of vertices of @p this
+     */
+    inline size_t size() const { return is_empty() ? 0 : m_vertices.size(); }
+
+    /**
+     * @brief Const access to a vertex of a @ref convex_polygon
+     * @param [in] i
+     * @return A const reference to the @p ith vertex
+     */
+    inline vec_t const& operator[](size_t const i) const { return m_vertices[i]; }
+
+    /**
+     * @brief Access an edge of a @ref convex_polygon
+     * @param [in] i The index of the edge to return
+     * @return The edge at @p i
+     */
+    inline segment2<T> edge(size_t const i) const
+    {
+        return segment2<T>(m_vertices[i], m_vertices[(i + 1) % m_vertices.size()]);
+    }
+
+    /**
+     * @brief Compute the area of a @ref convex_polygon
+     * @return The area of @p this
+     */
+    T area() const
+    {
+        T sum = math::constants<T>::zero;
+        for (size_t i = 1; i + 1 < size(); ++i)
+        {
+            sum += math::orientation(m_vertices[0], m_vertices[i], m_vertices[i + 1]);
+        }
+        return math::constants<T>::half * sum;
+    }
+
+    /**
+     * @brief Compute whether or not a query point is contained in a @ref convex_polygon in O(log n) time
+     * @param [in] query The query point
+     * @param [in] type Whether the boundary is open or closed
+     * @return Whether or not @p this contains @p query
+     */
+    bool contains(vec_t const& query, boundary_types const type) const
+    {
+        if (is_empty() || !m_aabb.contains(query))
+        {
+            return false;
+        }
+
+        // the query must be in the cone at the first vertex that is bounded by the first and last edges
+        size_t const n = m_vertices.size();
+        vec_t const& origin = m_vertices[0];
+        T const first = math::orientation(origin, m_vertices[1], query);
+        T const last = math::orientation(origin, m_vertices[n - 1], query);
+        if (first < math::constants<T>::zero || last > math::constants<T>::zero)
+        {
+            return false;
+        }
+
+        // binary search for the last vertex i in [1, n - 2] that the query is on the left of (from the first vertex)
+        size_t lo = 1;
+        size_t hi = n - 2;
+        while (lo < hi)
+        {
+            size_t const mid = (lo + hi + 1) / 2;
+            if (math::orientation(origin, m_vertices[mid], query) >= math::constants<T>::zero)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
+        }
+
+        // the query is in the wedge (origin, v[lo], v[lo + 1]) so it only remains to test the far edge of the wedge
+        T const far = math::orientation(m_vertices[lo], m_vertices[lo + 1], query);
+        if (far < math::constants<T>::zero)
+        {
+            return false;
+        }
+
+        // a contained point on the line through an edge is on the boundary
+        bool const boundary = far == math::constants<T>::zero || first == math::constants<T>::zero ||
+                              last == math::constants<T>::zero;
+        return !boundary || type == boundary_types::closed;
+    }
+
+    /**
+     * @brief Compute the square of the distance from a @ref convex_polygon to a point
+     * @param [in] point
+     * @return The square of the distance between @p this and @p point
+     */
+    T dist_squared(vec_t const& point) const
+    {
+        if (contains(point, boundary_types::closed))
+        {
+            return math::constants<T>::zero;
+        }
+        return convex_polygon::boundary_dist_squared(m_vertices, point);
+    }
+
+    /**
+     * @brief Compute whether or not two convex polygons intersect in O(n + m) time
+     * @param [in] rhs
+     * @return Whether or not @p this intersects @p rhs
+     */
+    bool intersects(convex_polygon const& rhs) const
+    {
+        if (is_empty() || rhs.is_empty() || !m_aabb.intersects(rhs.m_aabb))
+        {
+            return false;
+        }
+        convex_polygon const difference(minkowski_difference(rhs));
+        return difference.contains(vec_t(math::constants<T>::zero), boundary_types::closed);
+    }
+
+    /**
+     * @brief Compute the square of the distance between two convex polygons in O(n + m) time
+     * @param [in] rhs
+     * @return The square of the distance between @p this and @p rhs (0 if they intersect)
+     */
+    T dist_squared(convex_polygon const& rhs) const
+    {
+        if (is_empty() || rhs.is_empty())
+        {
+            return math::constants<T>::pos_inf;
+        }
+        return convex_polygon(minkowski_difference(rhs)).dist_squared(vec_t(math::constants<T>::zero));
+    }
+
+    /**
+     * @brief Compute whether or not a @ref convex_polygon and an @ref obb2 intersect
+     * @param [in] box
+     * @return Whether or not @p this intersects @p box
+     */
+    inline bool intersects(obb2<T> const& box) const { return intersects(convex_polygon(box)); }
+
+    /**
+     * @brief Compute the square of the distance between a @ref convex_polygon and an @ref obb2
+     * @param [in] box
+     * @return The square of the distance between @p this and @p box (0 if they intersect)
+     */
+    inline T dist_squared(obb2<T> const& box) const { return dist_squared(convex_polygon(box)); }
+
+    /**
+     * @brief Compute the distance from a @ref convex_polygon to a point
+     * @param [in] point
+     * @return The distance between @p this and @p point
+     */
+    inline T dist(vec_t const& point) const { return std::sqrt(dist_squared(point)); }
+
+    /**
+     * @brief Compute the distance between two convex polygons
+     * @param [in] rhs
+     * @return The distance between @p this and @p rhs
+     */
+    inline T dist(convex_polygon const& rhs) const { return std::sqrt(dist_squared(rhs)); }
+
+    /**
+     * @brief Const access to the bounding box
+     * @return Const reference to the bounding box
+     */
+    inline aabb_t const& aabb() const { return m_aabb; }
+
+    /**
+     * @brief Const access to the underlying array of (counterclockwise) vertices
+     * @return Const reference to vertices
+     */
+    inline std::vector<vec_t> const& vertices() const { return m_vertices; }
+
+private:
+    // removes repeated vertices and reverses clockwise input
+    static std::vector<vec_t> normalize(std::vector<vec_t> const& vertices)
+    {
+        std::vector<vec_t> result;
+        result.reserve(vertices.size());
+        for (vec_t const& vertex : vertices)
+        {
+            if (result.empty() || result.back() != vertex)
+            {
+                result.push_back(vertex);
+            }
+        }
+        while (result.size() > 1 && result.back() == result.front())
+        {
+            result.pop_back();
+        }
+
+        T sum = math::constants<T>::zero;
+        for (size_t i = 1; i + 1 < result.size(); ++i)
+        {
+            sum += math::orientation(result[0], result[i], result[i + 1]);
+        }
+        if (sum < math::constants<T>::zero)
+        {
+            std::reverse(result.begin(), result.end());
+        }
+        return result;
+    }
+
+    static T boundary_dist_squared(std::vector<vec_t> const& vertices, vec_t const& point)
+    {
+        T d = math::constants<T>::pos_inf;
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            vec_t const& a = vertices[i];
+            vec_t const diff = vertices[(i + 1) % vertices.size()] - a;
+            T const length_squared = math::dot(diff, diff);
+            T const t = (length_squared == math::constants<T>::zero) ? math::constants<T>::zero
+                        : std::clamp(math::dot(point - a, diff) / length_squared, math::constants<T>::zero,
+                                     math::constants<T>::one);
+            d = std::min(d, math::dist_squared(point, a + t * diff));
+        }
+        return d;
+    }
+
+    // the index of the lowest vertex (breaking ties by x) which starts the edges in order of angle
+    static size_t bottom(std::vector<vec_t> const& vertices)
+    {
+        size_t index = 0;
+        for (size_t i = 1; i < vertices.size(); ++i)
+        {
+            vec_t const& v = vertices[i];
+            vec_t const& best = vertices[index];
+            index = (v.y < best.y || (v.y == best.y && v.x < best.x)) ? i : index;
+        }
+        return index;
+    }
+
+    // the vertices of this - rhs (the Minkowski sum of this and the reflection of rhs), merging the edges by angle
+    std::vector<vec_t> minkowski_difference(convex_polygon const& rhs) const
+    {
+        std::vector<vec_t> reflected;
+        reflected.reserve(rhs.m_vertices.size());
+        for (vec_t const& vertex : rhs.m_vertices)
+        {
+            reflected.push_back(-vertex);
+        }
+
+        std::array<std::vector<vec_t> const*, 2> const polygons = {&m_vertices, &reflected};
+        std::array<size_t, 2> const starts = {bottom(m_vertices), bottom(reflected)};
+        std::array<size_t, 2> const sizes = {m_vertices.size(), reflected.size()};
+        auto vertex = [&](size_t const p, size_t const i) -> vec_t const&
+        {
+            return (*polygons[p])[(starts[p] + i) % sizes[p]];
+        };
+
+        std::vector<vec_t> result;
+        result.reserve(sizes[0] + sizes[1]);
+        size_t i = 0;
+        size_t j = 0;
+        while (i < sizes[0] || j < sizes[1])
+        {
+            result.push_back(vertex(0, i) + vertex(1, j));
+            T const turn = math::cross(vertex(0, i + 1) - vertex(0, i), vertex(1, j + 1) - vertex(1, j));
+            bool const advance_i = j == sizes[1] || (i < sizes[0] && turn >= math::constants<T>::zero);
+            bool const advance_j = i == sizes[0] || (j < sizes[1] && turn <= math::constants<T>::zero);
+            i += advance_i ? 1 : 0;
+            j += advance_j ? 1 : 0;
+        }
+        return result;
+    }
+
+private:
+    std::vector<vec_t> m_vertices;
+    aabb_t m_aabb;
+};
+
+/**
+ * @brief Compute the square of the distance between a convex polygon and a vector
+ * @tparam T Number type (eg float)
+ * @param [in] shape
+ * @param [in] point
+ * @return The square of the distance between @p shape and @p point
+ */
+template <typename T>
+inline T dist_squared(convex_polygon<T> const& shape, math::vec2<T> const& point)
+{
+    return shape.dist_squared(point);
+}
+
+/**
+ * @brief Compute the square of the distance between a vector and a convex polygon
+ * @tparam T Number type (eg float)
+ * @param [in] point
+ * @param [in] shape
+ * @return The square of the distance between @p point and @p shape
+ */
+template <typename T>
+inline T dist_squared(math::vec2<T> const& point, convex_polygon<T> const& shape)
+{
+    return dist_squared(shape, point);
+}
+
+/**
+ * @brief Compute the square of the distance between two convex polygons
+ * @tparam T Number type (eg float)
+ * @param [in] lhs
+ * @param [in] rhs
+ * @return The square of the distance between @p lhs and @p rhs
+ */
+template <typename T>
+inline T dist_squared(convex_polygon<T> const& lhs, convex_polygon<T> const& rhs)
+{
+    return lhs.dist_squared(rhs);
+}
+
+/**
+ * @brief Compute the square of the distance between a convex polygon and an obb2
+ * @tparam T Number type (eg float)
+ * @param [in] shape
+ * @param [in] box
+ * @return The square of the distance between @p shape and @p box
+ */
+template <typename T>
+inline T dist_squared(convex_polygon<T> const& shape, obb2<T> const& box)
+{
+    return shape.dist_squared(box);
+}
+
+/**
+ * @brief Compute the square of the distance between an obb2 and a convex polygon
+ * @tparam T Number type (eg float)
+ * @param [in] box
+ * @param [in] shape
+ * @return The square of the distance between @p box and @p shape
+ */
+template <typename T>
+inline T dist_squared(obb2<T> const& box, convex_polygon<T> const& shape)
+{
+    return dist_squared(shape, box);
+}
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
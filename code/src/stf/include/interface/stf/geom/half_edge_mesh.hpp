@@ -0,0 +1,1003 @@
+#ifndef STF_GEOM_HALF_EDGE_MESH_HPP_HEADER_GUARD
+#define STF_GEOM_HALF_EDGE_MESH_HPP_HEADER_GUARD
+
+#include <cstdint>
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <vector>
+
+#include "stf/math/vector.hpp"
+
+/**
+ * @file half_edge_mesh.hpp
+ * @brief A file containing a templated half-edge mesh class
+ */
+
+namespace stf::geom
+{
+
+/// @cond DELETED
+namespace guts
+{
+
+// flat storage with stable handles -- erased slots are threaded onto an intrusive free list and reused by insert
+template <typename T>
+class pool final
+{
+public:
+    static constexpr uint32_t c_alive = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t c_end = c_alive - 1;
+
+public:
+    size_t size() const { return m_size; }
+    size_t slots() const { return m_values.size(); }
+
+    void reserve(size_t const capacity)
+    {
+        m_values.reserve(capacity);
+        m_links.reserve(capacity);
+    }
+
+    bool contains(uint32_t const handle) const { return handle < m_links.size() && m_links[handle] == c_alive; }
+
+    uint32_t insert(T const& value)
+    {
+        ++m_size;
+        if (m_free != c_end)
+        {
+            uint32_t const handle = m_free;
+            m_free = m_links[handle];
+            m_links[handle] = c_alive;
+            m_values[handle] = value;
+            return handle;
+        }
+        m_values.push_back(value);
+        m_links.push_back(c_alive);
+        return static_cast<uint32_t>(m_values.size() - 1);
+    }
+
+    void erase(uint32_t const handle)
+    {
+        if (contains(handle))
+        {
+            m_links[handle] = m_free;
+            m_free = handle;
+            --m_size;
+        }
+    }
+
+    T const& operator[](uint32_t const handle) const { return m_values[handle]; }
+    T& operator[](uint32_t const handle) { return m_values[handle]; }
+
+private:
+    std::vector<T> m_values;
+    // c_alive for live slots, otherwise the next slot in the free list
+    std::vector<uint32_t> m_links;
+    uint32_t m_free = c_end;
+    size_t m_size = 0;
+};
+
+// a flat open addressing table from directed edges (packed into 64 bits) to half-edges with a fixed capacity
+class edge_table final
+{
+public:
+    static constexpr uint64_t c_empty = std::numeric_limits<uint64_t>::max();
+    static constexpr uint32_t c_none = std::numeric_limits<uint32_t>::max();
+
+public:
+    explicit edge_table(size_t const capacity)
+        : m_mask(std::bit_ceil(std::max(static_cast<size_t>(8), 2 * capacity)) - 1)
+        , m_keys(m_mask + 1, c_empty)
+        , m_values(m_mask + 1, c_none)
+    {
+    }
+
+    uint32_t find(uint64_t const key) const
+    {
+        for (size_t slot = edge_table::home(key, m_mask); m_keys[slot] != c_empty; slot = (slot + 1) & m_mask)
+        {
+            if (m_keys[slot] == key)
+            {
+                return m_values[slot];
+            }
+        }
+        return c_none;
+    }
+
+    // the key must not already be in the table and the table must have fewer than capacity entries
+    void insert(uint64_t const key, uint32_t const value)
+    {
+        size_t slot = edge_table::home(key, m_mask);
+        while (m_keys[slot] != c_empty)
+        {
+            slot = (slot + 1) & m_mask;
+        }
+        m_keys[slot] = key;
+        m_values[slot] = value;
+    }
+
+private:
+    static inline size_t home(uint64_t const key, size_t const mask)
+    {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+private:
+    size_t m_mask;
+    std::vector<uint64_t> m_keys;
+    std::vector<uint32_t> m_values;
+};
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief A class representing a triangle mesh in R^3 with half-edge connectivity
+ *
+ * Each edge is stored as a pair of oppositely oriented half-edges. A half-edge stores its origin vertex, its twin, the
+ * next/previous half-edges around its face, and its face. Half-edges on the boundary of the mesh have no face and the
+ * next/previous pointers of boundary half-edges link the boundary loops. Each vertex references one outgoing half-edge
+ * (a boundary half-edge if the vertex is on the boundary) and each face references one of its half-edges, so all
+ * adjacency queries are O(1) and one-ring traversals are O(valence).
+ *
+ * The faces around a vertex usually form a single fan, but removing faces can leave a (non-manifold) vertex with more
+ * than one. So each vertex also links one outgoing half-edge of each of its fans into a ring (the boundary half-edge
+ * of the fan if it has one). Topology edits update the rings locally, so no edit ever scans the mesh.
+ *
+ * Vertices, half-edges, and faces are stored in flat arrays and referenced by handles. As with @ref ds::slot_map,
+ * handles remain valid until the element is removed. Removed slots are placed on a free list and reused by later
+ * insertions, so topology edits do not allocate once the arrays have grown to their working size.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+class half_edge_mesh final
+{
+public:
+    /**
+     * @brief Type alias for vector type
+     */
+    using vec_t = math::vec3<T>;
+
+    /**
+     * @brief Type alias for a handle to a vertex, half-edge, or face
+     */
+    using handle_t = uint32_t;
+
+    /**
+     * @brief Type alias for index type (of an indexed triangle list)
+     */
+    using index_t = uint32_t;
+
+    /**
+     * @brief A handle that does not reference any element (eg the face of a boundary half-edge)
+     */
+    static constexpr handle_t c_invalid = std::numeric_limits<handle_t>::max();
+
+public:
+    /**
+     * @brief Default constructor -- an empty mesh
+     */
+    half_edge_mesh() = default;
+
+    /**
+     * @brief Construct from an indexed triangle list
+     *
+     * Vertex i is assigned handle i and, if no triangles are skipped, triangle i is assigned face handle i.
+     * @param [in] vertices
+     * @param [in] indices Triplets of indices into @p vertices that define the triangles
+     * @note Triangles that are degenerate, reference a vertex that is out of range, or share a directed edge with a
+     * previous triangle (ie the edge would be non-manifold or inconsistently oriented) are skipped
+     */
+    half_edge_mesh(std::vector<vec_t> const& vertices, std::vector<index_t> const& indices)
+    {
+        m_vertices.reserve(vertices.size());
+        m_half_edges.reserve(2 * indices.size());
+        m_faces.reserve(indices.size() / 3);
+        for (vec_t const& position : vertices)
+        {
+            m_vertices.insert(vertex_t{position, c_invalid, 0});
+        }
+
+        // maps the directed edge (origin, target) to its half-edge
+        guts::edge_table directed(indices.size());
+        auto key = [](index_t const origin, index_t const target)
+        {
+            return (static_cast<uint64_t>(origin) << 32) | static_cast<uint64_t>(target);
+        };
+
+        for (size_t t = 0; t + 2 < indices.size(); t += 3)
+        {
+            std::array<index_t, 3> const v = {indices[t], indices[t + 1], indices[t + 2]};
+            bool valid = v[0] != v[1] && v[1] != v[2] && v[2] != v[0];
+            for (size_t k = 0; k < 3 && valid; ++k)
+            {
+                valid = v[k] < vertices.size();
+                valid = valid && directed.find(key(v[k], v[(k + 1) % 3])) == guts::edge_table::c_none;
+            }
+            if (!valid)
+            {
+                continue;
+            }
+
+            handle_t const f = m_faces.insert(face_t{c_invalid});
+            std::array<handle_t, 3> h;
+            for (size_t k = 0; k < 3; ++k)
+            {
+                h[k] = create_half_edge(v[k], f);
+                directed.insert(key(v[k], v[(k + 1) % 3]), h[k]);
+
+                // pair with the opposite half-edge if it already exists
+                handle_t const found = directed.find(key(v[(k + 1) % 3], v[k]));
+                if (found != guts::edge_table::c_none)
+                {
+                    m_half_edges[h[k]].twin = found;
+                    m_half_edges[found].twin = h[k];
+                }
+            }
+            link_face(f, h[0], h[1], h[2]);
+        }
+
+        // create the boundary half-edges and then link them into boundary loops
+        std::vector<handle_t> boundary;
+        size_t const interior = m_half_edges.slots();
+        for (handle_t h = 0; h < interior; ++h)
+        {
+            if (m_half_edges[h].twin == c_invalid)
+            {
+                handle_t const b = create_half_edge(origin(next(h)), c_invalid);
+                m_half_edges[b].twin = h;
+                m_half_edges[h].twin = b;
+                boundary.push_back(b);
+            }
+        }
+        for (handle_t const b : boundary)
+        {
+            relink_boundary(b);
+        }
+
+        // link one half-edge of each fan (its boundary half-edge if it has one) into the ring of its vertex
+        visit_vertices([&](handle_t const v) { m_vertices[v].half_edge = c_invalid; });
+        std::vector<bool> visited(m_half_edges.slots(), false);
+        for (handle_t start = 0; start < m_half_edges.slots(); ++start)
+        {
+            if (!visited[start])
+            {
+                handle_t representative = start;
+                for (handle_t h = start; !visited[h]; h = twin(prev(h)))
+                {
+                    visited[h] = true;
+                    representative = is_boundary(h) ? h : representative;
+                }
+                link_fan(representative);
+            }
+        }
+    }
+
+    /**
+     * @brief Compute the number of vertices
+     * @return The number of vertices in @p this
+     */
+    inline size_t vertex_count() const { return m_vertices.size(); }
+
+    /**
+     * @brief Compute the number of half-edges (including boundary half-edges)
+     * @return The number of half-edges in @p this
+     */
+    inline size_t half_edge_count() const { return m_half_edges.size(); }
+
+    /**
+     * @brief Compute the number of faces
+     * @return The number of faces in @p this
+     */
+    inline size_t face_count() const { return m_faces.size(); }
+
+    /**
+     * @brief Compute whether a handle references a vertex
+     * @param [in] v
+     * @return Whether or not @p v references a vertex of @p this
+     */
+    inline bool has_vertex(handle_t const v) const { return m_vertices.contains(v); }
+
+    /**
+     * @brief Compute whether a handle references a half-edge
+     * @param [in] h
+     * @return Whether or not @p h references a half-edge of @p this
+     */
+    inline bool has_half_edge(handle_t const h) const { return m_half_edges.contains(h); }
+
+    /**
+     * @brief Compute whether a handle references a face
+     * @param [in] f
+     * @return Whether or not @p f references a face of @p this
+     */
+    inline bool has_face(handle_t const f) const { return m_faces.contains(f); }
+
+    /**
+     * @brief Access the position of a vertex
+     * @param [in] v
+     * @return A const reference to the position of @p v
+     */
+    inline vec_t const& position(handle_t const v) const { return m_vertices[v].position; }
+
+    /**
+     * @brief Access the position of a vertex
+     * @param [in] v
+     * @return A reference to the position of @p v
+     */
+    inline vec_t& position(handle_t const v) { return m_vertices[v].position; }
+
+    /**
+     * @brief Compute an outgoing half-edge of a vertex
+     * @param [in] v
+     * @return An outgoing half-edge of @p v (a boundary half-edge if @p v is on the boundary) or @ref c_invalid if
+     * @p v is isolated
+     */
+    inline handle_t half_edge(handle_t const v) const { return m_vertices[v].half_edge; }
+
+    /**
+     * @brief Compute a half-edge of a face
+     * @param [in] f
+     * @return A half-edge of @p f
+     */
+    inline handle_t face_half_edge(handle_t const f) const { return m_faces[f].half_edge; }
+
+    /**
+     * @brief Compute the origin of a half-edge
+     * @param [in] h
+     * @return The vertex that @p h starts at
+     */
+    inline handle_t origin(handle_t const h) const { return m_half_edges[h].origin; }
+
+    /**
+     * @brief Compute the target of a half-edge
+     * @param [in] h
+     * @return The vertex that @p h ends at
+     */
+    inline handle_t target(handle_t const h) const { return origin(twin(h)); }
+
+    /**
+     * @brief Compute the twin of a half-edge
+     * @param [in] h
+     * @return The oppositely oriented half-edge of the same edge
+     */
+    inline handle_t twin(handle_t const h) const { return m_half_edges[h].twin; }
+
+    /**
+     * @brief Compute the next half-edge
+     * @param [in] h
+     * @return The half-edge after @p h around its face (or boundary loop)
+     */
+    inline handle_t next(handle_t const h) const { return m_half_edges[h].next; }
+
+    /**
+     * @brief Compute the previous half-edge
+     * @param [in] h
+     * @return The half-edge before @p h around its face (or boundary loop)
+     */
+    inline handle_t prev(handle_t const h) const { return m_half_edges[h].prev; }
+
+    /**
+     * @brief Compute the face of a half-edge
+     * @param [in] h
+     * @return The face to the left of @p h or @ref c_invalid if @p h is a boundary half-edge
+     */
+    inline handle_t face(handle_t const h) const { return m_half_edges[h].face; }
+
+    /**
+     * @brief Compute whether a half-edge is on the boundary
+     * @param [in] h
+     * @return Whether or not @p h has no face
+     */
+    inline bool is_boundary(handle_t const h) const { return face(h) == c_invalid; }
+
+    /**
+     * @brief Compute the vertices of a face
+     * @param [in] f
+     * @return The vertices of @p f in counterclockwise order
+     */
+    inline std::array<handle_t, 3> vertices(handle_t const f) const
+    {
+        handle_t const h = face_half_edge(f);
+        return {origin(h), origin(next(h)), origin(prev(h))};
+    }
+
+    /**
+     * @brief Visit the outgoing half-edges of a vertex
+     * @tparam visit_t Callable type with signature void(handle_t)
+     * @param [in] v
+     * @param [in] visit The callback invoked with each outgoing half-edge of @p v
+     * @note If @p v is non-manifold (the faces incident to @p v form more than one fan), only the fan containing
+     * @ref half_edge(v) is visited
+     */
+    template <typename visit_t>
+    void visit_outgoing(handle_t const v, visit_t&& visit) const
+    {
+        handle_t const start = half_edge(v);
+        if (start == c_invalid)
+        {
+            return;
+        }
+
+        handle_t h = start;
+        do
+        {
+            visit(h);
+            h = twin(prev(h));
+        } while (h != start);
+    }
+
+    /**
+     * @brief Visit one outgoing half-edge in each fan of faces around a vertex
+     * @tparam visit_t Callable type with signature void(handle_t)
+     * @param [in] v
+     * @param [in] visit The callback invoked with an outgoing half-edge of each fan (the boundary half-edge of the fan
+     * if it has one)
+     * @note A manifold vertex has exactly one fan (and an isolated vertex has none)
+     */
+    template <typename visit_t>
+    void visit_fans(handle_t const v, visit_t&& visit) const
+    {
+        handle_t const start = half_edge(v);
+        if (start == c_invalid)
+        {
+            return;
+        }
+
+        handle_t h = start;
+        do
+        {
+            visit(h);
+            h = fan_next(h);
+        } while (h != start);
+    }
+
+    /**
+     * @brief Compute the valence of a vertex
+     * @param [in] v
+     * @return The number of edges incident to @p v
+     */
+    size_t valence(handle_t const v) const { return m_vertices[v].degree; }
+
+    /**
+     * @brief Find the half-edge between two vertices
+     * @param [in] from
+     * @param [in] to
+     * @return The half-edge from @p from to @p to or @ref c_invalid if there is no such half-edge
+     */
+    handle_t find_half_edge(handle_t const from, handle_t const to) const
+    {
+        handle_t found = c_invalid;
+        visit_outgoing(from, [&](handle_t const h)
+        {
+            if (target(h) == to)
+            {
+                found = h;
+            }
+        });
+        return found;
+    }
+
+    /**
+     * @brief Visit the vertices in increasing handle order
+     * @tparam visit_t Callable type with signature void(handle_t)
+     * @param [in] visit The callback invoked with each vertex
+     */
+    template <typename visit_t>
+    void visit_vertices(visit_t&& visit) const
+    {
+        half_edge_mesh::visit_pool(m_vertices, visit);
+    }
+
+    /**
+     * @brief Visit the half-edges in increasing handle order
+     * @tparam visit_t Callable type with signature void(handle_t)
+     * @param [in] visit The callback invoked with each half-edge
+     */
+    template <typename visit_t>
+    void visit_half_edges(visit_t&& visit) const
+    {
+        half_edge_mesh::visit_pool(m_half_edges, visit);
+    }
+
+    /**
+     * @brief Visit the faces in increasing handle order
+     * @tparam visit_t Callable type with signature void(handle_t)
+     * @param [in] visit The callback invoked with each face
+     */
+    template <typename visit_t>
+    void visit_faces(visit_t&& visit) const
+    {
+        half_edge_mesh::visit_pool(m_faces, visit);
+    }
+
+    /**
+     * @brief Compute the boundary loops of the mesh
+     * @return The boundary half-edges of each boundary loop (in the order they are linked)
+     */
+    std::vector<std::vector<handle_t>> boundary_loops() const
+    {
+        std::vector<std::vector<handle_t>> loops;
+        std::vector<bool> visited(m_half_edges.slots(), false);
+        visit_half_edges([&](handle_t const start)
+        {
+            if (is_boundary(start) && !visited[start])
+            {
+                std::vector<handle_t>& loop = loops.emplace_back();
+                for (handle_t h = start; !visited[h]; h = next(h))
+                {
+                    visited[h] = true;
+                    loop.push_back(h);
+                }
+            }
+        });
+        return loops;
+    }
+
+    /**
+     * @brief Add a triangle to the mesh
+     *
+     * The triangle must attach to the mesh along existing boundary edges or at isolated vertices so that each of its
+     * vertices remains manifold. Existing boundary half-edges between the vertices become half-edges of the new face.
+     * @param [in] a
+     * @param [in] b
+     * @param [in] c
+     * @return The handle of the new face or @ref c_invalid if the face can not be added (in which case @p this is not
+     * modified)
+     */
+    handle_t add_face(handle_t const a, handle_t const b, handle_t const c)
+    {
+        std::array<handle_t, 3> const v = {a, b, c};
+        if (a == b || b == c || c == a)
+        {
+            return c_invalid;
+        }
+        for (handle_t const u : v)
+        {
+            // a vertex must either be isolated or on the boundary and manifold
+            if (!has_vertex(u))
+            {
+                return c_invalid;
+            }
+            if (half_edge(u) != c_invalid && (!is_boundary(half_edge(u)) || !is_manifold(u)))
+            {
+                return c_invalid;
+            }
+        }
+
+        std::array<handle_t, 3> existing;
+        for (size_t k = 0; k < 3; ++k)
+        {
+            existing[k] = find_half_edge(v[k], v[(k + 1) % 3]);
+            if (existing[k] != c_invalid && !is_boundary(existing[k]))
+            {
+                return c_invalid;
+            }
+        }
+        for (size_t k = 0; k < 3; ++k)
+        {
+            // a vertex that is not isolated must share an edge with the face (otherwise the vertex becomes a bowtie)
+            bool const shared = existing[k] != c_invalid || existing[(k + 2) % 3] != c_invalid;
+            if (half_edge(v[k]) != c_invalid && !shared)
+            {
+                return c_invalid;
+            }
+        }
+
+        // each vertex has at most one fan before and exactly one fan after, so the rings are reset below
+        std::array<handle_t, 3> const representatives = {half_edge(a), half_edge(b), half_edge(c)};
+
+        handle_t const f = m_faces.insert(face_t{c_invalid});
+        std::array<handle_t, 3> h;
+        for (size_t k = 0; k < 3; ++k)
+        {
+            if (existing[k] != c_invalid)
+            {
+                h[k] = existing[k];
+                m_half_edges[h[k]].face = f;
+            }
+            else
+            {
+                h[k] = create_half_edge(v[k], f);
+                handle_t const t = create_half_edge(v[(k + 1) % 3], c_invalid);
+                m_half_edges[h[k]].twin = t;
+                m_half_edges[t].twin = h[k];
+            }
+        }
+        link_face(f, h[0], h[1], h[2]);
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            // walk clockwise around the vertex to the incoming boundary half-edge of the fan containing the new face
+            handle_t out = h[k];
+            while (!is_boundary(twin(out)))
+            {
+                out = next(twin(out));
+                if (out == h[k])
+                {
+                    break;
+                }
+            }
+            if (is_boundary(twin(out)))
+            {
+                relink_boundary(twin(out));
+                m_vertices[v[k]].half_edge = next(twin(out));
+            }
+            else
+            {
+                // the fan is closed so the vertex is now interior
+                m_vertices[v[k]].half_edge = h[k];
+            }
+        }
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            handle_t const representative = half_edge(v[k]);
+            if (representatives[k] != c_invalid)
+            {
+                unlink_fan(representatives[k]);
+            }
+            m_vertices[v[k]].half_edge = c_invalid;
+            link_fan(representative);
+        }
+        return f;
+    }
+
+    /**
+     * @brief Remove a face from the mesh
+     *
+     * The half-edges of @p f become boundary half-edges. Edges with no remaining face and vertices with no remaining
+     * edges are removed as well.
+     * @param [in] f
+     * @note Removing a face can separate the faces around a vertex into more than one fan. The vertex is then
+     * non-manifold, @ref visit_outgoing only visits one of its fans, and @ref visit_fans visits each of them. Relinking
+     * the boundary costs O(valence) of the vertices of @p f and the rest of the update is O(1).
+     */
+    void remove_face(handle_t const f)
+    {
+        if (!has_face(f))
+        {
+            return;
+        }
+
+        handle_t const first = face_half_edge(f);
+        std::array<handle_t, 3> const h = {first, next(first), prev(first)};
+        std::array<handle_t, 3> const v = {origin(h[0]), origin(h[1]), origin(h[2])};
+        std::array<bool, 3> removed;
+        for (size_t k = 0; k < 3; ++k)
+        {
+            removed[k] = is_boundary(twin(h[k]));
+        }
+
+        // when the face is in the middle of the fan around a vertex, find the fan's representative and whether the
+        // fan is open (in which case removing the face splits it in two) before the face is removed
+        std::array<handle_t, 3> representatives = {c_invalid, c_invalid, c_invalid};
+        std::array<bool, 3> open = {false, false, false};
+        for (size_t k = 0; k < 3; ++k)
+        {
+            if (!removed[k] && !removed[(k + 2) % 3])
+            {
+                representatives[k] = fan_representative(h[k]);
+                open[k] = is_boundary(representatives[k]);
+            }
+        }
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            m_half_edges[h[k]].face = c_invalid;
+        }
+        m_faces.erase(f);
+
+        // update the fans around each vertex -- h[k] leaves v[k] and twin(h[k + 2]) is the boundary half-edge that
+        // leaves v[k] if the edge between them is removed
+        for (size_t k = 0; k < 3; ++k)
+        {
+            handle_t const incoming = twin(h[(k + 2) % 3]);
+            if (removed[k] && removed[(k + 2) % 3])
+            {
+                unlink_fan(incoming); // the fan was only this face
+            }
+            else if (removed[(k + 2) % 3])
+            {
+                replace_fan(incoming, h[k]); // the fan shrinks and h[k] is its new boundary half-edge
+            }
+            else if (!removed[k])
+            {
+                if (open[k])
+                {
+                    link_fan(h[k]); // the fan splits and h[k] starts a new one
+                }
+                else
+                {
+                    replace_fan(representatives[k], h[k]); // the fan opens at h[k]
+                }
+            }
+        }
+
+        // gather the boundary half-edges whose next half-edge changes
+        std::array<handle_t, 3> pending;
+        size_t count = 0;
+        for (size_t k = 0; k < 3; ++k)
+        {
+            if (!removed[k])
+            {
+                pending[count++] = h[k];
+            }
+            else if (!removed[(k + 1) % 3])
+            {
+                // the boundary half-edge that precedes the removed edge (unless it is also removed)
+                pending[count++] = prev(twin(h[k]));
+            }
+        }
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            if (removed[k])
+            {
+                --m_vertices[origin(h[k])].degree;
+                --m_vertices[target(h[k])].degree;
+                m_half_edges.erase(twin(h[k]));
+                m_half_edges.erase(h[k]);
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            relink_boundary(pending[i]);
+        }
+
+        for (handle_t const u : v)
+        {
+            if (valence(u) == 0)
+            {
+                m_vertices.erase(u);
+            }
+        }
+    }
+
+    /**
+     * @brief Flip an interior edge
+     *
+     * The edge between the two faces of @p h is replaced by the edge between the two vertices opposite to it. The
+     * half-edges and faces keep their handles.
+     * @param [in] h A half-edge of the edge to flip
+     * @return Whether or not the edge was flipped (boundary edges and flips that would duplicate an edge fail)
+     */
+    bool flip_edge(handle_t const h)
+    {
+        handle_t const t = twin(h);
+        if (is_boundary(h) || is_boundary(t))
+        {
+            return false;
+        }
+
+        // h: a -> b in (a, b, c) and t: b -> a in (b, a, d)
+        handle_t const h1 = next(h);
+        handle_t const h2 = prev(h);
+        handle_t const t1 = next(t);
+        handle_t const t2 = prev(t);
+        handle_t const a = origin(h);
+        handle_t const b = origin(t);
+        handle_t const c = origin(h2);
+        handle_t const d = origin(t2);
+        if (c == d || find_half_edge(c, d) != c_invalid)
+        {
+            return false;
+        }
+
+        handle_t const f0 = face(h);
+        handle_t const f1 = face(t);
+
+        // after flipping h: d -> c in (c, a, d) and t: c -> d in (d, b, c)
+        m_half_edges[h].origin = d;
+        m_half_edges[t].origin = c;
+        m_half_edges[t1].face = f0;
+        m_half_edges[h1].face = f1;
+        link_face(f0, h, h2, t1);
+        link_face(f1, t, t2, h1);
+
+        --m_vertices[a].degree;
+        --m_vertices[b].degree;
+        ++m_vertices[c].degree;
+        ++m_vertices[d].degree;
+        // h and t are interior, so they can only represent closed fans
+        if (fan_next(h) != c_invalid)
+        {
+            replace_fan(h, t1);
+        }
+        if (fan_next(t) != c_invalid)
+        {
+            replace_fan(t, h1);
+        }
+        return true;
+    }
+
+private:
+    struct vertex_t
+    {
+        vec_t position;
+        handle_t half_edge;
+        uint32_t degree;
+    };
+
+    struct half_edge_t
+    {
+        handle_t origin;
+        handle_t twin;
+        handle_t next;
+        handle_t prev;
+        handle_t face;
+        handle_t fan_next; // the ring of fans around the origin (c_invalid unless this half-edge represents its fan)
+        handle_t fan_prev;
+    };
+
+    struct face_t
+    {
+        handle_t half_edge;
+    };
+
+private:
+    template <typename pool_t, typename visit_t>
+    static void visit_pool(pool_t const& pool, visit_t& visit)
+    {
+        for (handle_t handle = 0; handle < pool.slots(); ++handle)
+        {
+            if (pool.contains(handle))
+            {
+                visit(handle);
+            }
+        }
+    }
+
+    handle_t create_half_edge(handle_t const v, handle_t const f)
+    {
+        ++m_vertices[v].degree;
+        if (m_vertices[v].half_edge == c_invalid)
+        {
+            handle_t const h = m_half_edges.insert(half_edge_t{v, c_invalid, c_invalid, c_invalid, f, c_invalid,
+                                                               c_invalid});
+            m_vertices[v].half_edge = h;
+            return h;
+        }
+        return m_half_edges.insert(half_edge_t{v, c_invalid, c_invalid, c_invalid, f, c_invalid, c_invalid});
+    }
+
+    void link(handle_t const from, handle_t const to)
+    {
+        m_half_edges[from].next = to;
+        m_half_edges[to].prev = from;
+    }
+
+    void link_face(handle_t const f, handle_t const h0, handle_t const h1, handle_t const h2)
+    {
+        link(h0, h1);
+        link(h1, h2);
+        link(h2, h0);
+        m_faces[f].half_edge = h0;
+    }
+
+    // links the incoming boundary half-edge b to the outgoing boundary half-edge at the other side of its fan. if that
+    // half-edge was linked from another boundary half-edge (possible at non-manifold vertices) then that half-edge is
+    // relinked as well.
+    void relink_boundary(handle_t b)
+    {
+        while (b != c_invalid)
+        {
+            handle_t h = twin(b);
+            while (!is_boundary(h))
+            {
+                h = twin(prev(h));
+            }
+
+            handle_t const displaced = prev(h);
+            link(b, h);
+            bool const relink = displaced != b && has_half_edge(displaced) && is_boundary(displaced) &&
+                                next(displaced) == h;
+            b = relink ? displaced : c_invalid;
+        }
+    }
+
+    inline handle_t fan_next(handle_t const h) const { return m_half_edges[h].fan_next; }
+
+    // whether the faces around v form at most one fan
+    inline bool is_manifold(handle_t const v) const
+    {
+        return half_edge(v) == c_invalid || fan_next(half_edge(v)) == half_edge(v);
+    }
+
+    // the half-edge that represents the fan containing the outgoing half-edge h
+    handle_t fan_representative(handle_t const h) const
+    {
+        handle_t const v = origin(h);
+        if (is_manifold(v))
+        {
+            return half_edge(v);
+        }
+
+        handle_t e = h;
+        while (fan_next(e) == c_invalid)
+        {
+            e = twin(prev(e));
+        }
+        return e;
+    }
+
+    // links h into the ring of fans around its origin, preferring a boundary representative for the vertex
+    void link_fan(handle_t const h)
+    {
+        handle_t const v = origin(h);
+        handle_t const at = half_edge(v);
+        if (at == c_invalid)
+        {
+            m_half_edges[h].fan_next = h;
+            m_half_edges[h].fan_prev = h;
+            m_vertices[v].half_edge = h;
+            return;
+        }
+
+        handle_t const after = fan_next(at);
+        m_half_edges[h].fan_prev = at;
+        m_half_edges[h].fan_next = after;
+        m_half_edges[at].fan_next = h;
+        m_half_edges[after].fan_prev = h;
+        if (is_boundary(h) && !is_boundary(half_edge(v)))
+        {
+            m_vertices[v].half_edge = h;
+        }
+    }
+
+    // unlinks h from the ring of fans around its origin, preferring a boundary representative for the vertex
+    void unlink_fan(handle_t const h)
+    {
+        handle_t const v = origin(h);
+        handle_t const after = fan_next(h);
+        handle_t const before = m_half_edges[h].fan_prev;
+        m_half_edges[h].fan_next = c_invalid;
+        m_half_edges[h].fan_prev = c_invalid;
+        if (after == h)
+        {
+            m_vertices[v].half_edge = c_invalid;
+            return;
+        }
+
+        m_half_edges[before].fan_next = after;
+        m_half_edges[after].fan_prev = before;
+        if (half_edge(v) == h)
+        {
+            handle_t e = after;
+            while (!is_boundary(e) && fan_next(e) != after)
+            {
+                e = fan_next(e);
+            }
+            m_vertices[v].half_edge = is_boundary(e) ? e : after;
+        }
+    }
+
+    // replaces the representative h of a fan with replacement (h may have already been moved to another origin)
+    void replace_fan(handle_t const h, handle_t const replacement)
+    {
+        handle_t const v = origin(replacement);
+        handle_t const after = fan_next(h);
+        handle_t const before = m_half_edges[h].fan_prev;
+        m_half_edges[h].fan_next = c_invalid;
+        m_half_edges[h].fan_prev = c_invalid;
+        m_half_edges[replacement].fan_next = (after == h) ? replacement : after;
+        m_half_edges[replacement].fan_prev = (before == h) ? replacement : before;
+        m_half_edges[m_half_edges[replacement].fan_next].fan_prev = replacement;
+        m_half_edges[m_half_edges[replacement].fan_prev].fan_next = replacement;
+        if (half_edge(v) == h || (is_boundary(replacement) && !is_boundary(half_edge(v))))
+        {
+            m_vertices[v].half_edge = replacement;
+        }
+    }
+
+private:
+    guts::pool<vertex_t> m_vertices;
+    guts::pool<half_edge_t> m_half_edges;
+    guts::pool<face_t> m_faces;
+};
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
@@ -282,6 +282,25 @@ inline T dist(math::vec2<T> const& point, holygon<T> const& shape)
     return dist(shape, point);
 }
 
+/// @cond DELETED
+namespace guts
+{
+
+// flattens the rings of a holygon into a single list (the hull followed by the holes)
+template <typename T>
+std::vector<polygon<T> const*> rings(holygon<T> const& holygon)
+{
+    std::vector<polygon<T> const*> rings = {&holygon.hull()};
+    for (polygon<T> const& hole : holygon.holes())
+    {
+        rings.push_back(&hole);
+    }
+    return rings;
+}
+
+} // namespace guts
+/// @endcond
+
 } // namespace stf::geom
 
 #endif
\ No newline at end of file
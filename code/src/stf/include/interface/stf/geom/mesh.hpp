@@ -0,0 +1,515 @@
+#ifndef STF_GEOM_MESH_HPP_HEADER_GUARD
+#define STF_GEOM_MESH_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "stf/alg/parallel.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/hypersphere.hpp"
+#include "stf/geom/triangle.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file mesh.hpp
+ * @brief A file containing a templated indexed triangle mesh class
+ */
+
+namespace stf::geom
+{
+
+/// @cond DELETED
+namespace guts
+{
+
+// hashes the integer coordinates of a grid cell
+struct cell_hash final
+{
+    size_t operator()(std::array<int64_t, 3> const& cell) const
+    {
+        // large primes from "Optimized Spatial Hashing for Collision Detection of Deformable Objects" by Teschner et al
+        uint64_t const h = static_cast<uint64_t>(cell[0]) * 73856093ull ^ static_cast<uint64_t>(cell[1]) * 19349663ull ^
+                           static_cast<uint64_t>(cell[2]) * 83492791ull;
+        return static_cast<size_t>(h);
+    }
+};
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief A class representing an indexed triangle mesh in R^3
+ *
+ * Stores a vertex buffer and an index buffer where each triplet of indices defines a triangle. Functions that do work
+ * proportional to the size of the mesh take a maximum thread count and split the work with @ref alg::parallel_for.
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+class mesh final
+{
+public:
+    /**
+     * @brief Type alias for vector type
+     */
+    using vec_t = math::vec3<T>;
+
+    /**
+     * @brief Type alias for index type
+     */
+    using index_t = uint32_t;
+
+    /**
+     * @brief Type alias for aabb type
+     */
+    using aabb_t = aabb3<T>;
+
+    /**
+     * @brief Type alias for sphere type
+     */
+    using sphere_t = sphere<T>;
+
+    /**
+     * @brief Type alias for triangle type
+     */
+    using triangle_t = triangle3<T>;
+
+public:
+    /**
+     * @brief Default constructor -- an empty mesh
+     */
+    mesh() = default;
+
+    /**
+     * @brief Construct from a vertex buffer and an index buffer
+     * @param [in] vertices
+     * @param [in] indices Triplets of indices into @p vertices that define the triangles
+     */
+    mesh(std::vector<vec_t> vertices, std::vector<index_t> indices)
+        : m_vertices(std::move(vertices))
+        , m_indices(std::move(indices))
+    {
+    }
+
+    /**
+     * @brief Getter for the vertex buffer
+     * @return The vertex buffer
+     */
+    inline std::vector<vec_t> const& vertices() const { return m_vertices; }
+
+    /**
+     * @brief Getter for the index buffer
+     * @return The index buffer
+     */
+    inline std::vector<index_t> const& indices() const { return m_indices; }
+
+    /**
+     * @brief Compute the number of vertices
+     * @return The number of vertices in @p this
+     */
+    inline size_t vertex_count() const { return m_vertices.size(); }
+
+    /**
+     * @brief Compute the number of triangles
+     * @return The number of triangles in @p this
+     */
+    inline size_t triangle_count() const { return m_indices.size() / 3; }
+
+    /**
+     * @brief Compute a triangle of the mesh
+     * @param [in] i The index of the triangle
+     * @return The @p i triangle
+     */
+    inline triangle_t triangle(size_t const i) const
+    {
+        return triangle_t(m_vertices[m_indices[3 * i]], m_vertices[m_indices[3 * i + 1]],
+                          m_vertices[m_indices[3 * i + 2]]);
+    }
+
+    /**
+     * @brief Merge vertices that are within a tolerance of each other
+     *
+     * Vertices are hashed (in parallel) by the grid cell (with side length @p tolerance) that contains them into a flat
+     * open addressing table and grouped into a run per cell by counting and scanning (without a global sort), so each
+     * vertex is only compared against the vertices in its cell and the 26 neighboring cells. Cells whose coordinates
+     * agree modulo 3 are never neighbors, so the cells are resolved in 27 phases that each process their cells in
+     * parallel. Within a phase, each vertex (in index order within its cell) merges into the first kept vertex within
+     * @p tolerance in the previously resolved neighborhood or is kept itself. The result does not depend on
+     * @p threads. Kept vertices retain their position and relative order, and triangles that become degenerate (with
+     * repeated indices) are removed. This takes O(n) expected time when each cell holds a bounded number of vertices.
+     * @param [in] tolerance The distance at which two vertices are merged (must be positive)
+     * @param [in] threads The maximum number of threads to use
+     * @return The number of vertices removed
+     */
+    size_t weld(T const tolerance, size_t const threads = 1)
+    {
+        T const inv_cell = math::constants<T>::one / tolerance;
+        T const tolerance_squared = tolerance * tolerance;
+        size_t const count = m_vertices.size();
+        constexpr index_t c_none = std::numeric_limits<index_t>::max();
+
+        // compute the cell that contains each vertex
+        using cell_t = std::array<int64_t, 3>;
+        std::vector<cell_t> cells(count);
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                for (size_t d = 0; d < 3; ++d)
+                {
+                    cells[v][d] = static_cast<int64_t>(std::floor(m_vertices[v][d] * inv_cell));
+                }
+            }
+        });
+
+        // insert each cell into a flat open addressing table (with room for every vertex to be in its own cell) -- a
+        // slot stores the first vertex that claimed it and slots are claimed concurrently with a compare-and-swap
+        size_t bits = 1;
+        while ((static_cast<size_t>(1) << bits) < 2 * count)
+        {
+            ++bits;
+        }
+        size_t const mask = (static_cast<size_t>(1) << bits) - 1;
+        auto home = [bits](cell_t const& cell)
+        {
+            return static_cast<size_t>((static_cast<uint64_t>(guts::cell_hash{}(cell)) * 0x9E3779B97F4A7C15ull) >>
+                                       (64 - bits));
+        };
+        std::vector<index_t> slots(mask + 1, c_none);
+        std::vector<index_t> homes(count);
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                size_t slot = home(cells[v]);
+                while (true)
+                {
+                    index_t expected = c_none;
+                    if (std::atomic_ref<index_t>(slots[slot])
+                            .compare_exchange_strong(expected, static_cast<index_t>(v), std::memory_order_relaxed) ||
+                        cells[expected] == cells[v])
+                    {
+                        break;
+                    }
+                    slot = (slot + 1) & mask;
+                }
+                homes[v] = static_cast<index_t>(slot);
+            }
+        });
+
+        // count the vertices in each cell and scan the counts so the vertices of the cell in slot s are
+        // members[firsts[s], firsts[s + 1]) -- each run is then sorted so the result is deterministic
+        std::vector<index_t> firsts(mask + 2, 0);
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                std::atomic_ref<index_t>(firsts[homes[v]]).fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        alg::parallel_exclusive_scan(firsts, threads);
+        std::vector<index_t> cursors(firsts.begin(), firsts.end() - 1);
+        std::vector<index_t> members(count);
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                members[std::atomic_ref<index_t>(cursors[homes[v]]).fetch_add(1, std::memory_order_relaxed)] =
+                    static_cast<index_t>(v);
+            }
+        });
+        alg::parallel_for(mask + 1, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t slot = begin; slot < end; ++slot)
+            {
+                std::sort(members.begin() + firsts[slot], members.begin() + firsts[slot + 1]);
+            }
+        });
+        auto run = [&](cell_t const& cell)
+        {
+            for (size_t slot = home(cell); slots[slot] != c_none; slot = (slot + 1) & mask)
+            {
+                if (cells[slots[slot]] == cell)
+                {
+                    return std::make_pair(firsts[slot], firsts[slot + 1]);
+                }
+            }
+            return std::make_pair(index_t(0), index_t(0));
+        };
+
+        // compute the phase of each occupied slot
+        constexpr uint8_t c_empty = 27;
+        std::vector<uint8_t> phases(mask + 1, c_empty);
+        alg::parallel_for(mask + 1, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t slot = begin; slot < end; ++slot)
+            {
+                if (slots[slot] != c_none)
+                {
+                    uint8_t phase = 0;
+                    for (int64_t const coord : cells[slots[slot]])
+                    {
+                        phase = static_cast<uint8_t>(3 * phase + ((coord % 3) + 3) % 3);
+                    }
+                    phases[slot] = phase;
+                }
+            }
+        });
+
+        // resolve each phase -- a cell only reads from neighboring cells (which belong to other phases) and writes to
+        // its own vertices, so the cells in a phase are independent
+        std::vector<index_t> matches(count, c_none);
+        for (uint8_t p = 0; p < c_empty; ++p)
+        {
+            alg::parallel_for(mask + 1, threads, [&](size_t const begin, size_t const end, size_t)
+            {
+                for (size_t slot = begin; slot < end; ++slot)
+                {
+                    if (phases[slot] != p)
+                    {
+                        continue;
+                    }
+
+                    for (index_t k = firsts[slot]; k < firsts[slot + 1]; ++k)
+                    {
+                        index_t const vertex = members[k];
+                        cell_t const& cell = cells[vertex];
+                        index_t match = c_none;
+                        for (int64_t dx = -1; dx <= 1 && match == c_none; ++dx)
+                        {
+                            for (int64_t dy = -1; dy <= 1 && match == c_none; ++dy)
+                            {
+                                for (int64_t dz = -1; dz <= 1 && match == c_none; ++dz)
+                                {
+                                    auto const [first, last] = run(cell_t{cell[0] + dx, cell[1] + dy, cell[2] + dz});
+                                    for (index_t j = first; j < last; ++j)
+                                    {
+                                        index_t const other = members[j];
+                                        if (matches[other] == other &&
+                                            (m_vertices[other] - m_vertices[vertex]).length_squared() <=
+                                                tolerance_squared)
+                                        {
+                                            match = other;
+                                            break;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        matches[vertex] = (match == c_none) ? vertex : match;
+                    }
+                }
+            });
+        }
+
+        // compact the kept vertices (in order) and then point each merged vertex at the new index of its match
+        std::vector<index_t> remap(count);
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                remap[v] = (matches[v] == v) ? 1 : 0;
+            }
+        });
+        std::vector<vec_t> kept(alg::parallel_exclusive_scan(remap, threads));
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                if (matches[v] == v)
+                {
+                    kept[remap[v]] = m_vertices[v];
+                }
+            }
+        });
+        alg::parallel_for(count, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                if (matches[v] != v)
+                {
+                    remap[v] = remap[matches[v]];
+                }
+            }
+        });
+
+        // remap the indices and remove degenerate triangles
+        size_t const triangles = triangle_count();
+        std::vector<index_t> offsets(triangles);
+        alg::parallel_for(triangles, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t t = begin; t < end; ++t)
+            {
+                for (size_t k = 3 * t; k < 3 * t + 3; ++k)
+                {
+                    m_indices[k] = remap[m_indices[k]];
+                }
+                offsets[t] = mesh::is_degenerate(m_indices.data() + 3 * t) ? 0 : 1;
+            }
+        });
+        std::vector<index_t> indices(3 * static_cast<size_t>(alg::parallel_exclusive_scan(offsets, threads)));
+        alg::parallel_for(triangles, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t t = begin; t < end; ++t)
+            {
+                if (!mesh::is_degenerate(m_indices.data() + 3 * t))
+                {
+                    std::copy_n(m_indices.begin() + 3 * t, 3, indices.begin() + 3 * offsets[t]);
+                }
+            }
+        });
+
+        size_t const removed = count - kept.size();
+        m_vertices = std::move(kept);
+        m_indices = std::move(indices);
+        return removed;
+    }
+
+    /**
+     * @brief Compute the face normals and vertex normals of the mesh
+     *
+     * Vertex normals are the normalized sum of the area-weighted normals of the incident triangles. The triangles
+     * incident to each vertex are gathered (in parallel, with atomic counters) into a compressed adjacency list and
+     * then each vertex sums its triangles in index order. So no thread needs a buffer the size of the mesh and the
+     * result does not depend on @p threads.
+     * @param [out] face_normals The unit normal of each triangle (resized to the number of triangles)
+     * @param [out] vertex_normals The unit normal of each vertex (resized to the number of vertices)
+     * @param [in] threads The maximum number of threads to use
+     * @note Degenerate triangles and unreferenced vertices are assigned the zero vector
+     */
+    void normals(std::vector<vec_t>& face_normals, std::vector<vec_t>& vertex_normals, size_t const threads = 1) const
+    {
+        size_t const triangles = triangle_count();
+        size_t const vertices = m_vertices.size();
+
+        // the length of the cross product is twice the area, so summing cross products weights by area
+        std::vector<vec_t> crosses(triangles);
+        std::vector<index_t> offsets(vertices, 0);
+        face_normals.resize(triangles);
+        alg::parallel_for(triangles, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t t = begin; t < end; ++t)
+            {
+                vec_t const& a = m_vertices[m_indices[3 * t]];
+                vec_t const& b = m_vertices[m_indices[3 * t + 1]];
+                vec_t const& c = m_vertices[m_indices[3 * t + 2]];
+                vec_t const cross = math::cross(b - a, c - a);
+                crosses[t] = cross;
+                face_normals[t] = mesh::normalize(cross);
+                for (size_t k = 3 * t; k < 3 * t + 3; ++k)
+                {
+                    std::atomic_ref<index_t>(offsets[m_indices[k]]).fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        // after the scan, offsets[v] is the beginning of the list for v and filling the lists advances it to the end
+        alg::parallel_exclusive_scan(offsets, threads);
+        std::vector<index_t> adjacency(3 * triangles);
+        alg::parallel_for(triangles, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t t = begin; t < end; ++t)
+            {
+                for (size_t k = 3 * t; k < 3 * t + 3; ++k)
+                {
+                    index_t const slot =
+                        std::atomic_ref<index_t>(offsets[m_indices[k]]).fetch_add(1, std::memory_order_relaxed);
+                    adjacency[slot] = static_cast<index_t>(t);
+                }
+            }
+        });
+
+        vertex_normals.resize(vertices);
+        alg::parallel_for(vertices, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                auto first = adjacency.begin() + ((v == 0) ? 0 : offsets[v - 1]);
+                auto last = adjacency.begin() + offsets[v];
+                std::sort(first, last);
+                vec_t sum(math::constants<T>::zero);
+                for (auto it = first; it != last; ++it)
+                {
+                    sum += crosses[*it];
+                }
+                vertex_normals[v] = mesh::normalize(sum);
+            }
+        });
+    }
+
+    /**
+     * @brief Compute an @ref aabb that minimally encompasses the vertices
+     * @param [in] threads The maximum number of threads to use
+     * @return The bounding box (or @ref aabb::nothing if there are no vertices)
+     */
+    aabb_t aabb(size_t const threads = 1) const
+    {
+        std::vector<aabb_t> boxes(std::max(threads, static_cast<size_t>(1)), aabb_t::nothing());
+        alg::parallel_for(m_vertices.size(), threads, [&](size_t const begin, size_t const end, size_t const thread)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                boxes[thread].fit(m_vertices[i]);
+            }
+        });
+
+        aabb_t box = aabb_t::nothing();
+        for (aabb_t const& b : boxes)
+        {
+            box.fit(b);
+        }
+        return box;
+    }
+
+    /**
+     * @brief Compute a sphere that encloses the vertices
+     * @param [in] threads The maximum number of threads to use
+     * @note The sphere is centered at the center of the bounding box, so it is not necessarily minimal
+     * @return The bounding sphere
+     */
+    sphere_t bounding_sphere(size_t const threads = 1) const
+    {
+        if (m_vertices.empty())
+        {
+            return sphere_t(vec_t(math::constants<T>::zero), math::constants<T>::zero);
+        }
+
+        vec_t const center = aabb(threads).center();
+        std::vector<T> radii(std::max(threads, static_cast<size_t>(1)), math::constants<T>::zero);
+        alg::parallel_for(m_vertices.size(), threads, [&](size_t const begin, size_t const end, size_t const thread)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                radii[thread] = std::max(radii[thread], (m_vertices[i] - center).length_squared());
+            }
+        });
+        return sphere_t(center, std::sqrt(*std::max_element(radii.begin(), radii.end())));
+    }
+
+private:
+    static inline bool is_degenerate(index_t const* triangle)
+    {
+        return triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0];
+    }
+
+    static inline vec_t normalize(vec_t const& v)
+    {
+        T const length = v.length();
+        return (length > math::constants<T>::zero) ? v / length : vec_t(math::constants<T>::zero);
+    }
+
+private:
+    std::vector<vec_t> m_vertices;
+    std::vector<index_t> m_indices;
+};
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
@@ -0,0 +1,190 @@
+#ifndef STF_GEOM_PREPARED_HOLYGON_HPP_HEADER_GUARD
+#define STF_GEOM_PREPARED_HOLYGON_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <vector>
+
+#include "stf/enums.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/geom/prepared_polygon.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/bvh.hpp"
+#include "stf/spatial/edge_bvh.hpp"
+
+/**
+ * @file prepared_holygon.hpp
+ * @brief A file containing a class that indexes a holygon for repeated containment and distance queries
+ */
+
+namespace stf::geom
+{
+
+/**
+ * @brief Class that indexes a @ref holygon for repeated containment and distance queries
+ *
+ * The hull and each hole are indexed by a @ref prepared_polygon and the bounding boxes of the holes are stored in a
+ * @ref spatial::bvh. A query only visits the holes whose bounding box contains the query point, so the cost of a query
+ * does not grow with the number of holes that are far from it (eg a land polygon with thousands of lakes). The edges of
+ * each ring are also stored in a @ref spatial::edge_bvh, so the distance to the boundary of the hull or a hole is a
+ * branch and bound search rather than a walk over every edge of the ring.
+ *
+ * The answers match @ref holygon::contains and @ref holygon::dist_squared (up to rounding for queries that are within
+ * an ulp of the boundary).
+ * @tparam T Number type (eg float)
+ * @note The holes are assumed to be disjoint and contained in the hull
+ */
+template <typename T>
+class prepared_holygon final
+{
+public:
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec2<T>;
+
+    /**
+     * @brief Type alias for an aabb
+     */
+    using aabb_t = geom::aabb2<T>;
+
+public:
+    /**
+     * @brief Construct from a @ref holygon
+     * @param [in] holygon
+     */
+    explicit prepared_holygon(holygon<T> const& holygon)
+        : m_holygon(holygon)
+        , m_hull(holygon.hull())
+        , m_holes(prepared_holygon::prepare(holygon.holes()))
+        , m_tree(prepared_holygon::bounds(holygon.holes()))
+        , m_rings(prepared_holygon::index(holygon))
+    {
+    }
+
+    /**
+     * @brief Compute whether or not a query point is contained in a @ref prepared_holygon
+     * @param [in] query The query point
+     * @param [in] type Whether the boundary is open or closed
+     * @return Whether or not @p this contains @p query
+     */
+    bool contains(vec_t const& query, boundary_types const type) const
+    {
+        if (!m_hull.aabb().contains(query))
+        {
+            return false;
+        }
+        return hole(query, complement(type)) == c_none && m_hull.contains(query, type);
+    }
+
+    /**
+     * @brief Compute the square of the distance from a @ref prepared_holygon to a point
+     * @param [in] point
+     * @return The square of the distance from @p this to @p point
+     */
+    T dist_squared(vec_t const& point) const
+    {
+        // a point in a hole is only as far as the boundary of that hole
+        size_t const i = hole(point, boundary_types::closed);
+        if (i != c_none)
+        {
+            return boundary_dist_squared(i + 1, point);
+        }
+
+        if (m_hull.contains(point, boundary_types::closed))
+        {
+            return math::constants<T>::zero;
+        }
+        return boundary_dist_squared(0, point);
+    }
+
+    /**
+     * @brief Compute the distance from a @ref prepared_holygon to a point
+     * @param [in] point
+     * @return The distance from @p this to @p point
+     */
+    inline T dist(vec_t const& point) const { return std::sqrt(dist_squared(point)); }
+
+    /**
+     * @brief Const access to the bounding box
+     * @return Const reference to the bounding box
+     */
+    inline aabb_t const& aabb() const { return m_hull.aabb(); }
+
+    /**
+     * @brief Const access to the indexed holygon
+     * @return Const reference to the holygon
+     */
+    inline holygon<T> const& shape() const { return m_holygon; }
+
+private:
+    static constexpr size_t c_none = static_cast<size_t>(-1);
+
+private:
+    static std::vector<prepared_polygon<T>> prepare(std::vector<polygon<T>> const& holes)
+    {
+        std::vector<prepared_polygon<T>> prepared;
+        prepared.reserve(holes.size());
+        for (polygon<T> const& hole : holes)
+        {
+            prepared.emplace_back(hole);
+        }
+        return prepared;
+    }
+
+    static std::vector<aabb_t> bounds(std::vector<polygon<T>> const& holes)
+    {
+        std::vector<aabb_t> boxes;
+        boxes.reserve(holes.size());
+        for (polygon<T> const& hole : holes)
+        {
+            boxes.push_back(hole.aabb());
+        }
+        return boxes;
+    }
+
+    static std::vector<spatial::edge_bvh<T, 2>> index(holygon<T> const& holygon)
+    {
+        std::vector<spatial::edge_bvh<T, 2>> rings;
+        for (polygon<T> const* ring : guts::rings(holygon))
+        {
+            rings.emplace_back(*ring);
+        }
+        return rings;
+    }
+
+    // the square of the distance to the boundary of a ring (the hull is ring 0 and hole i is ring i + 1)
+    T boundary_dist_squared(size_t const ring, vec_t const& point) const
+    {
+        auto const nearest = m_rings[ring].nearest(point);
+        return nearest ? nearest->dist_squared : math::constants<T>::pos_inf;
+    }
+
+    // the index of the hole that contains the query (or c_none). the holes are disjoint so we stop at the first one
+    size_t hole(vec_t const& query, boundary_types const type) const
+    {
+        size_t found = c_none;
+        m_tree.find(aabb_t(query, query), [&](size_t const i)
+        {
+            if (found == c_none && m_holes[i].contains(query, type))
+            {
+                found = i;
+            }
+        });
+        return found;
+    }
+
+private:
+    holygon<T> m_holygon;
+    prepared_polygon<T> m_hull;
+    std::vector<prepared_polygon<T>> m_holes;
+    spatial::bvh<T, 2> m_tree;
+    std::vector<spatial::edge_bvh<T, 2>> m_rings;
+};
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
@@ -0,0 +1,171 @@
+#ifndef STF_GEOM_PREPARED_POLYGON_HPP_HEADER_GUARD
+#define STF_GEOM_PREPARED_POLYGON_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "stf/enums.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/interval.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/interval_tree.hpp"
+
+/**
+ * @file prepared_polygon.hpp
+ * @brief A file containing a class that indexes the edges of a polygon for repeated point-in-polygon queries
+ */
+
+namespace stf::geom
+{
+
+/**
+ * @brief Class that indexes the edges of a @ref polygon (or @ref holygon) for repeated containment queries
+ *
+ * The edges are stored in an interval tree keyed on their y-ranges. A containment query casts a ray in +x, and only
+ * edges whose y-range contains the query can cross that ray. So a query costs O(log n + k) where k is the number of
+ * edges that straddle the horizontal line through the query, regardless of how the vertices are distributed. The
+ * edges are tested with orientation predicates, avoiding the divisions that @ref polygon::contains performs per edge.
+ *
+ * The answers match @ref polygon::contains and @ref holygon::contains, including the @ref boundary_types semantics
+ * (up to rounding for queries that are within an ulp of the boundary).
+ * @tparam T Number type (eg float)
+ * @note The holes of a @ref holygon are assumed to be disjoint and contained in the hull
+ */
+template <typename T>
+class prepared_polygon final
+{
+public:
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec2<T>;
+
+    /**
+     * @brief Type alias for an aabb
+     */
+    using aabb_t = geom::aabb2<T>;
+
+public:
+    /**
+     * @brief Construct from a @ref polygon
+     * @param [in] polygon
+     */
+    explicit prepared_polygon(polygon<T> const& polygon)
+        : prepared_polygon(polygon.aabb(), prepared_polygon::entries({&polygon}))
+    {
+    }
+
+    /**
+     * @brief Construct from a @ref holygon
+     * @param [in] holygon
+     */
+    explicit prepared_polygon(holygon<T> const& holygon)
+        : prepared_polygon(holygon.aabb(), prepared_polygon::entries(guts::rings(holygon)))
+    {
+    }
+
+    /**
+     * @brief Compute whether or not a query point is contained in a @ref prepared_polygon
+     * @param [in] query The query point
+     * @param [in] type Whether the boundary is open or closed
+     * @return Whether or not @p this contains @p query
+     */
+    bool contains(vec_t const& query, boundary_types const type) const
+    {
+        if (m_edge_count == 0 || !m_aabb.contains(query))
+        {
+            return false;
+        }
+
+        // we shoot a ray out from the query in +x and count the number of edges that are crossed
+        bool inside = false;
+        for (entry_t const& entry : m_edges.find(query.y))
+        {
+            vec_t const& a = entry.value.a;
+            vec_t const& b = entry.value.b;
+            T const orientation = math::orientation(a, b, query);
+            if (orientation == math::constants<T>::zero)
+            {
+                // the query is on the line through the edge (and within its y-range), so it is on the boundary if it
+                // is also within the x-range of the edge
+                if (std::min(a.x, b.x) <= query.x && query.x <= std::max(a.x, b.x))
+                {
+                    return type == boundary_types::closed;
+                }
+            }
+            else if ((a.y > query.y) != (b.y > query.y))
+            {
+                // the ray crosses the edge if the query is on the left of the edge when the edge is directed upwards
+                inside ^= (orientation > math::constants<T>::zero) == (b.y > a.y);
+            }
+        }
+        return inside;
+    }
+
+    /**
+     * @brief Const access to the bounding box
+     * @return Const reference to the bounding box
+     */
+    inline aabb_t const& aabb() const { return m_aabb; }
+
+    /**
+     * @brief Compute the number of edges in a @ref prepared_polygon
+     * @return The number of edges
+     */
+    inline size_t edge_count() const { return m_edge_count; }
+
+private:
+    struct edge_t final
+    {
+        vec_t a;
+        vec_t b;
+
+        inline bool operator==(edge_t const& rhs) const { return a == rhs.a && b == rhs.b; }
+    };
+
+    using tree_t = spatial::interval_tree<T, edge_t>;
+    using entry_t = typename tree_t::entry_t;
+
+private:
+    prepared_polygon(aabb_t const& aabb, std::vector<entry_t>&& entries)
+        : m_aabb(aabb)
+        , m_edge_count(entries.size())
+        , m_edges(std::move(entries))
+    {
+    }
+
+    // malformed polygons contain nothing, so they do not contribute edges
+    static std::vector<entry_t> entries(std::vector<polygon<T> const*> const& rings)
+    {
+        std::vector<entry_t> entries;
+        if (rings.front()->is_empty())
+        {
+            return entries;
+        }
+
+        for (polygon<T> const* ring : rings)
+        {
+            size_t const size = ring->size();
+            for (size_t i = 0; i < size; ++i)
+            {
+                vec_t const& a = (*ring)[i];
+                vec_t const& b = (*ring)[(i + 1) % size];
+                entries.push_back(entry_t(math::interval<T>(std::min(a.y, b.y), std::max(a.y, b.y)), edge_t{a, b}));
+            }
+        }
+        return entries;
+    }
+
+private:
+    aabb_t m_aabb;
+    size_t m_edge_count;
+    tree_t m_edges;
+};
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
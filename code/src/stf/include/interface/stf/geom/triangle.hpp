@@ -0,0 +1,492 @@
+#ifndef STF_GEOM_TRIANGLE_HPP_HEADER_GUARD
+#define STF_GEOM_TRIANGLE_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <span>
+
+#include "stf/geom/aabb.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file triangle.hpp
+ * @brief A file containing a templated triangle class along with associated functions
+ */
+
+namespace stf::geom
+{
+
+/**
+ * @brief A class to represent triangles in R^n
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ */
+template <typename T, size_t N>
+struct triangle final
+{
+
+    /**
+     * @brief Type alias for vector type
+     */
+    using vec_t = math::vec<T, N>;
+
+    /**
+     * @brief Type alias for aabb type
+     */
+    using aabb_t = geom::aabb<T, N>;
+
+public:
+    /**
+     * @brief The first vertex of the triangle
+     */
+    vec_t a;
+
+    /**
+     * @brief The second vertex of the triangle
+     */
+    vec_t b;
+
+    /**
+     * @brief The third vertex of the triangle
+     */
+    vec_t c;
+
+    /**
+     * @brief Default constructor -- all vertices are the origin
+     */
+    triangle()
+        : triangle(vec_t(math::constants<T>::zero), vec_t(math::constants<T>::zero), vec_t(math::constants<T>::zero))
+    {
+    }
+
+    /**
+     * @brief Construct from three points
+     * @param [in] _a
+     * @param [in] _b
+     * @param [in] _c
+     */
+    triangle(vec_t const& _a, vec_t const& _b, vec_t const& _c) : a(_a), b(_b), c(_c) {}
+
+    /**
+     * @brief Compute the area of a @ref triangle
+     * @return The area of @p this
+     */
+    T area() const
+    {
+        // the squared norm of the wedge product of the edges is |u|^2 |v|^2 - (u . v)^2 (in any dimension)
+        vec_t const u = b - a;
+        vec_t const v = c - a;
+        T const uv = math::dot(u, v);
+        T const wedge = u.length_squared() * v.length_squared() - uv * uv;
+        return math::constants<T>::half * std::sqrt(std::max(wedge, math::constants<T>::zero));
+    }
+
+    /**
+     * @brief Compute the unit normal of a @ref triangle (oriented by the right-hand rule)
+     * @note The triangle is assumed to be non-degenerate
+     * @return The unit normal of @p this
+     */
+    vec_t normal() const
+        requires(N == 3)
+    {
+        return math::normalized(math::cross(b - a, c - a));
+    }
+
+    /**
+     * @brief Compute the barycentric coordinates of a point with respect to a @ref triangle
+     * @param [in] point
+     * @note If @p point is not in the plane of @p this, the coordinates of its projection onto the plane are returned
+     * @note The triangle is assumed to be non-degenerate
+     * @return The weights (u, v, w) such that u * a + v * b + w * c is (the projection of) @p point
+     */
+    math::vec3<T> barycentric(vec_t const& point) const
+    {
+        vec_t const v0 = b - a;
+        vec_t const v1 = c - a;
+        vec_t const v2 = point - a;
+        T const d00 = math::dot(v0, v0);
+        T const d01 = math::dot(v0, v1);
+        T const d11 = math::dot(v1, v1);
+        T const d20 = math::dot(v2, v0);
+        T const d21 = math::dot(v2, v1);
+        T const inv_denom = math::constants<T>::one / (d00 * d11 - d01 * d01);
+        T const v = (d11 * d20 - d01 * d21) * inv_denom;
+        T const w = (d00 * d21 - d01 * d20) * inv_denom;
+        return math::vec3<T>(math::constants<T>::one - v - w, v, w);
+    }
+
+    /**
+     * @brief Compute the point of a @ref triangle that is closest to a query point
+     * @param [in] point
+     * @return The point of @p this that is closest to @p point
+     */
+    vec_t closest_point(vec_t const& point) const
+    {
+        // classify the point against the voronoi regions of the vertices, edges, and face (see Real-Time Collision
+        // Detection by Ericson, section 5.1.5)
+        T const zero = math::constants<T>::zero;
+        vec_t const ab = b - a;
+        vec_t const ac = c - a;
+
+        vec_t const ap = point - a;
+        T const d1 = math::dot(ab, ap);
+        T const d2 = math::dot(ac, ap);
+        if (d1 <= zero && d2 <= zero)
+        {
+            return a;
+        }
+
+        vec_t const bp = point - b;
+        T const d3 = math::dot(ab, bp);
+        T const d4 = math::dot(ac, bp);
+        if (d3 >= zero && d4 <= d3)
+        {
+            return b;
+        }
+
+        T const vc = d1 * d4 - d3 * d2;
+        if (vc <= zero && d1 >= zero && d3 <= zero)
+        {
+            return a + (d1 / (d1 - d3)) * ab;
+        }
+
+        vec_t const cp = point - c;
+        T const d5 = math::dot(ab, cp);
+        T const d6 = math::dot(ac, cp);
+        if (d6 >= zero && d5 <= d6)
+        {
+            return c;
+        }
+
+        T const vb = d5 * d2 - d1 * d6;
+        if (vb <= zero && d2 >= zero && d6 <= zero)
+        {
+            return a + (d2 / (d2 - d6)) * ac;
+        }
+
+        T const va = d3 * d6 - d5 * d4;
+        if (va <= zero && d4 - d3 >= zero && d5 - d6 >= zero)
+        {
+            return b + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b);
+        }
+
+        T const inv_denom = math::constants<T>::one / (va + vb + vc);
+        return a + (vb * inv_denom) * ab + (vc * inv_denom) * ac;
+    }
+
+    /**
+     * @brief Compute the square of the distance between a triangle and a vector
+     * @param [in] point
+     * @return The square of the distance between @p this and @p point
+     */
+    inline T dist_squared(vec_t const& point) const { return (point - closest_point(point)).length_squared(); }
+
+    /**
+     * @brief Compute the distance between a triangle and a vector
+     * @param [in] point
+     * @return The distance between @p this and @p point
+     */
+    inline T dist(vec_t const& point) const { return std::sqrt(dist_squared(point)); }
+
+    /**
+     * @brief Compute an @ref aabb that minimally encompasses the triangle
+     * @return The bounding box
+     */
+    inline aabb_t aabb() const
+    {
+        aabb_t box = aabb_t::nothing();
+        box.fit(a);
+        box.fit(b);
+        box.fit(c);
+        return box;
+    }
+
+    /**
+     * @brief Compute whether or not a triangle intersects an aabb
+     *
+     * Uses the separating axis theorem with the 13 axes described by Akenine-Moller in "Fast 3D Triangle-Box Overlap
+     * Testing": the 3 box face normals, the triangle normal, and the 9 cross products of the box axes and the triangle
+     * edges.
+     * @param [in] box
+     * @return Whether or not @p this intersects @p box
+     */
+    bool intersects(aabb_t const& box) const
+        requires(N == 3)
+    {
+        // the box face normals are checked by comparing bounds
+        if (!aabb().intersects(box))
+        {
+            return false;
+        }
+
+        // translate so that the box is centered at the origin
+        vec_t const center = box.center();
+        vec_t const h = math::constants<T>::half * box.diagonal();
+        vec_t const v0 = a - center;
+        vec_t const v1 = b - center;
+        vec_t const v2 = c - center;
+
+        // the triangle normal
+        vec_t const n = math::cross(v1 - v0, v2 - v0);
+        T const r = h.x * std::abs(n.x) + h.y * std::abs(n.y) + h.z * std::abs(n.z);
+        if (std::abs(math::dot(n, v0)) > r)
+        {
+            return false;
+        }
+
+        // the cross products of the box axes and the edges. for the box axis e_i, the axis e_i x f has zero component
+        // i, so both the projections and the radius only depend on the other two components
+        vec_t const edges[3] = {v1 - v0, v2 - v1, v0 - v2};
+        for (vec_t const& f : edges)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                vec_t axis(math::constants<T>::zero);
+                axis[(i + 1) % 3] = -f[(i + 2) % 3];
+                axis[(i + 2) % 3] = f[(i + 1) % 3];
+
+                T const p0 = math::dot(v0, axis);
+                T const p1 = math::dot(v1, axis);
+                T const p2 = math::dot(v2, axis);
+                T const radius = h.x * std::abs(axis.x) + h.y * std::abs(axis.y) + h.z * std::abs(axis.z);
+                if (std::min({p0, p1, p2}) > radius || std::max({p0, p1, p2}) < -radius)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true; // fallthrough to return true
+    }
+};
+
+/// @cond DELETED
+/**
+ * @brief Delete invalid triangle specialization
+ */
+template <typename T>
+struct triangle<T, 0>
+{
+    triangle() = delete;
+};
+/**
+ * @brief Delete invalid triangle specialization
+ */
+template <typename T>
+struct triangle<T, 1>
+{
+    triangle() = delete;
+};
+/// @endcond
+
+/**
+ * @brief Type alias for a 2D @ref triangle
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+using triangle2 = triangle<T, 2>;
+
+/**
+ * @brief Type alias for a 3D @ref triangle
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+using triangle3 = triangle<T, 3>;
+
+/**
+ * @brief Compute the square of the distance between a triangle and a vector
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] tri
+ * @param [in] point
+ * @return The square of the distance between @p tri and @p point
+ */
+template <typename T, size_t N>
+inline T dist_squared(triangle<T, N> const& tri, math::vec<T, N> const& point)
+{
+    return tri.dist_squared(point);
+}
+
+/**
+ * @brief Compute the square of the distance between a vector and a triangle
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] point
+ * @param [in] tri
+ * @return The square of the distance between @p point and @p tri
+ */
+template <typename T, size_t N>
+inline T dist_squared(math::vec<T, N> const& point, triangle<T, N> const& tri)
+{
+    return dist_squared(tri, point);
+}
+
+/**
+ * @brief Compute the distance between a triangle and a vector
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] tri
+ * @param [in] point
+ * @return The distance between @p tri and @p point
+ */
+template <typename T, size_t N>
+inline T dist(triangle<T, N> const& tri, math::vec<T, N> const& point)
+{
+    return tri.dist(point);
+}
+
+/**
+ * @brief Compute the distance between a vector and a triangle
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] point
+ * @param [in] tri
+ * @return The distance between @p point and @p tri
+ */
+template <typename T, size_t N>
+inline T dist(math::vec<T, N> const& point, triangle<T, N> const& tri)
+{
+    return dist(tri, point);
+}
+
+/**
+ * @brief Construct a triangle from an indexed vertex buffer
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] i The index of the triangle
+ * @return The triangle with vertices @p vertices[@p indices[3i, 3i + 3)]
+ */
+template <typename T, size_t N>
+inline triangle<T, N> triangle_at(std::span<math::vec<T, N> const> const vertices,
+                                  std::span<uint32_t const> const indices, size_t const i)
+{
+    return triangle<T, N>(vertices[indices[3 * i]], vertices[indices[3 * i + 1]], vertices[indices[3 * i + 2]]);
+}
+
+/**
+ * @brief Compute the area of every triangle in an indexed vertex buffer
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [out] out The area of each triangle (must have at least indices.size() / 3 entries)
+ */
+template <typename T, size_t N>
+void areas(std::span<math::vec<T, N> const> const vertices, std::span<uint32_t const> const indices,
+           std::span<T> const out)
+{
+    for (size_t i = 0; i < indices.size() / 3; ++i)
+    {
+        out[i] = triangle_at<T, N>(vertices, indices, i).area();
+    }
+}
+
+/**
+ * @brief Compute the unit normal of every triangle in an indexed vertex buffer
+ * @tparam T Number type (eg float)
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [out] out The normal of each triangle (must have at least indices.size() / 3 entries)
+ */
+template <typename T>
+void normals(std::span<math::vec3<T> const> const vertices, std::span<uint32_t const> const indices,
+             std::span<math::vec3<T>> const out)
+{
+    for (size_t i = 0; i < indices.size() / 3; ++i)
+    {
+        out[i] = triangle_at<T, 3>(vertices, indices, i).normal();
+    }
+}
+
+/**
+ * @brief Compute the barycentric coordinates of a point with respect to every triangle in an indexed vertex buffer
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] points The query point for each triangle (must have at least indices.size() / 3 entries)
+ * @param [out] out The barycentric coordinates of each point (must have at least indices.size() / 3 entries)
+ */
+template <typename T, size_t N>
+void barycentrics(std::span<math::vec<T, N> const> const vertices, std::span<uint32_t const> const indices,
+                  std::span<math::vec<T, N> const> const points, std::span<math::vec3<T>> const out)
+{
+    for (size_t i = 0; i < indices.size() / 3; ++i)
+    {
+        out[i] = triangle_at<T, N>(vertices, indices, i).barycentric(points[i]);
+    }
+}
+
+/**
+ * @brief Compute the point of every triangle in an indexed vertex buffer that is closest to a query point
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] point The query point
+ * @param [out] out The closest point of each triangle (must have at least indices.size() / 3 entries)
+ */
+template <typename T, size_t N>
+void closest_points(std::span<math::vec<T, N> const> const vertices, std::span<uint32_t const> const indices,
+                    math::vec<T, N> const& point, std::span<math::vec<T, N>> const out)
+{
+    for (size_t i = 0; i < indices.size() / 3; ++i)
+    {
+        out[i] = triangle_at<T, N>(vertices, indices, i).closest_point(point);
+    }
+}
+
+/**
+ * @brief Compute the square of the distance between a query point and every triangle in an indexed vertex buffer
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] point The query point
+ * @param [out] out The square of the distance to each triangle (must have at least indices.size() / 3 entries)
+ * @return The index of the triangle closest to @p point (or 0 if there are no triangles)
+ */
+template <typename T, size_t N>
+size_t dists_squared(std::span<math::vec<T, N> const> const vertices, std::span<uint32_t const> const indices,
+                     math::vec<T, N> const& point, std::span<T> const out)
+{
+    size_t closest = 0;
+    for (size_t i = 0; i < indices.size() / 3; ++i)
+    {
+        out[i] = triangle_at<T, N>(vertices, indices, i).dist_squared(point);
+        closest = (out[i] < out[closest]) ? i : closest;
+    }
+    return closest;
+}
+
+/**
+ * @brief Find the triangles in an indexed vertex buffer that intersect an aabb
+ * @tparam T Number type (eg float)
+ * @param [in] vertices The vertex positions
+ * @param [in] indices Triplets of indices into @p vertices that define the triangles
+ * @param [in] box The query aabb
+ * @param [out] out The indices of the triangles that intersect @p box (in increasing order)
+ * @note @p out must have at least indices.size() / 3 entries
+ * @return The number of indices written to @p out
+ */
+template <typename T>
+size_t intersecting(std::span<math::vec3<T> const> const vertices, std::span<uint32_t const> const indices,
+                    aabb3<T> const& box, std::span<size_t> const out)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < indices.size() / 3; ++i)
+    {
+        out[count] = i;
+        count += triangle_at<T, 3>(vertices, indices, i).intersects(box) ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace stf::geom
+
+#endif
\ No newline at end of file
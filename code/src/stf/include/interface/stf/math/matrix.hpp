@@ -1091,6 +1091,7 @@ inline mtx4<T> perspective(T const fov_y, T const aspect, T const near_plane, T
     result[2][2] = far_plane / (near_plane - far_plane);
     result[2][3] = near_plane * far_plane / (near_plane - far_plane);
     result[3][2] = -1;
+    result[3][3] = 0;
     return result;
 }
 
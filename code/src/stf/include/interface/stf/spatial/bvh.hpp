@@ -0,0 +1,392 @@
+#ifndef STF_SPATIAL_BVH_HPP_HEADER_GUARD
+#define STF_SPATIAL_BVH_HPP_HEADER_GUARD
+
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "stf/geom/aabb.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+
+/**
+ * @file bvh.hpp
+ * @brief A file containing a class that implements a bounding volume hierarchy
+ */
+
+namespace stf::spatial
+{
+
+/**
+ * @brief A fixed-capacity stack for the depth-first traversal of a @ref bvh
+ *
+ * A bvh is split at the median so its depth is at most one more than log2 of the number of primitives (which are
+ * indexed with 32 bits). A depth-first traversal that pushes both children of a node holds at most one pending node
+ * per level (plus the node being expanded), so the capacity is never exceeded and traversals do not allocate.
+ * @tparam value_t The type stored for each pending node (eg a node index along with a bound)
+ */
+template <typename value_t>
+class traversal_stack final
+{
+public:
+    /**
+     * @brief The maximum number of values on the stack
+     */
+    static constexpr size_t c_capacity = 64;
+
+public:
+    /**
+     * @brief Construct a stack that contains a single value
+     * @param [in] value
+     */
+    explicit traversal_stack(value_t const& value) { push(value); }
+
+    /**
+     * @brief Compute whether or not the stack is empty
+     * @return Whether or not @p this is empty
+     */
+    inline bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Push a value onto the stack
+     * @param [in] value
+     */
+    inline void push(value_t const& value) { m_values[m_size++] = value; }
+
+    /**
+     * @brief Pop the top value off of the stack
+     * @return The value that was on top of the stack
+     */
+    inline value_t pop() { return m_values[--m_size]; }
+
+private:
+    std::array<value_t, c_capacity> m_values;
+    size_t m_size = 0;
+};
+
+/**
+ * @brief A class that implements a bounding volume hierarchy (bvh) of aabbs
+ *
+ * The hierarchy is built over the bounds of a set of primitives (identified by their index in the input) by
+ * recursively splitting the primitives at the median centroid along the longest axis of the centroid bounds. Nodes are
+ * stored in a flat array in depth-first order: the left child of an interior node immediately follows the node and
+ * the node stores the index of its right child. Leaves store a contiguous range of primitive indices.
+ *
+ * The hierarchy satisfies the @ref alg::aabb_hierarchy concept (for N = 3), with the root at index @ref root().
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ */
+template <typename T, size_t N>
+class bvh final
+{
+public:
+    /**
+     * @brief Type alias for an aabb
+     */
+    using aabb_t = geom::aabb<T, N>;
+
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec<T, N>;
+
+    /**
+     * @brief A node in the hierarchy
+     */
+    struct node_t
+    {
+        /**
+         * @brief The bounds of all primitives in the subtree rooted at this node
+         */
+        aabb_t bounds;
+
+        /**
+         * @brief The index of the first primitive (for leaves) or the index of the right child (for interior nodes)
+         */
+        uint32_t first;
+
+        /**
+         * @brief The number of primitives in the leaf (0 for interior nodes)
+         */
+        uint32_t count;
+
+        /**
+         * @brief Compute whether or not the node is a leaf
+         * @return Whether or not @p this is a leaf
+         */
+        inline bool is_leaf() const { return count > 0; }
+    };
+
+    /**
+     * @brief A (possibly empty) range of child node indices
+     */
+    struct children_t
+    {
+        /**
+         * @brief The child indices
+         */
+        std::array<size_t, 2> indices;
+
+        /**
+         * @brief The number of children (either 0 or 2)
+         */
+        size_t count;
+
+        /**
+         * @brief Return the beginning of the range
+         * @return The beginning of the range
+         */
+        inline size_t const* begin() const { return indices.data(); }
+
+        /**
+         * @brief Return the end of the range
+         * @return The end of the range
+         */
+        inline size_t const* end() const { return indices.data() + count; }
+    };
+
+public:
+    /**
+     * @brief Construct a bvh from the bounds of a set of primitives
+     * @param [in] boxes The bounds of the primitives (primitive i has bounds @p boxes[i])
+     * @param [in] leaf_size The maximum number of primitives stored in a leaf
+     */
+    explicit bvh(std::vector<aabb_t> const& boxes, size_t const leaf_size = 4)
+        : m_leaf_size(std::max(leaf_size, static_cast<size_t>(1)))
+    {
+        m_indices.resize(boxes.size());
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            m_indices[i] = static_cast<uint32_t>(i);
+        }
+
+        if (!boxes.empty())
+        {
+            std::vector<vec_t> centroids;
+            centroids.reserve(boxes.size());
+            for (aabb_t const& box : boxes)
+            {
+                centroids.push_back(box.center());
+            }
+
+            m_nodes.reserve(2 * (boxes.size() / m_leaf_size) + 1);
+            build(boxes, centroids, 0, boxes.size());
+        }
+    }
+
+    /**
+     * @brief Compute whether or not the hierarchy is empty
+     * @return Whether or not @p this contains any primitives
+     */
+    inline bool empty() const { return m_nodes.empty(); }
+
+    /**
+     * @brief Getter for the index of the root node
+     * @note Only valid when the hierarchy is not empty
+     * @return The index of the root node
+     */
+    inline size_t root() const { return 0; }
+
+    /**
+     * @brief Getter for the nodes of the hierarchy
+     * @return The nodes in depth-first order
+     */
+    inline std::vector<node_t> const& nodes() const { return m_nodes; }
+
+    /**
+     * @brief Getter for a node of the hierarchy
+     * @param [in] node The index of the node
+     * @return The node at index @p node
+     */
+    inline node_t const& node(size_t const node) const { return m_nodes[node]; }
+
+    /**
+     * @brief Getter for the bounds of a node
+     * @param [in] node The index of the node
+     * @return The bounds of the node at index @p node
+     */
+    inline aabb_t const& bounds(size_t const node) const { return m_nodes[node].bounds; }
+
+    /**
+     * @brief Compute the children of a node
+     * @param [in] node The index of the node
+     * @return The range of child indices (empty for leaves)
+     */
+    children_t children(size_t const node) const
+    {
+        node_t const& n = m_nodes[node];
+        return n.is_leaf() ? children_t{{0, 0}, 0} : children_t{{node + 1, n.first}, 2};
+    }
+
+    /**
+     * @brief Getter for a primitive index stored in a leaf
+     * @param [in] i The position in the leaf ranges (in [node.first, node.first + node.count) for some leaf)
+     * @return The index of the primitive in the input to the constructor
+     */
+    inline size_t primitive(size_t const i) const { return m_indices[i]; }
+
+    /**
+     * @brief Find the primitives whose bounds intersect a query aabb
+     * @tparam callable_t Callable with the signature void(size_t primitive)
+     * @param [in] query The query aabb
+     * @param [in] visit The callable invoked for every primitive whose bounds intersect @p query
+     */
+    template <typename callable_t>
+    void find(aabb_t const& query, callable_t&& visit) const
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        traversal_stack<size_t> stack(root());
+        while (!stack.empty())
+        {
+            size_t const index = stack.pop();
+
+            node_t const& n = m_nodes[index];
+            if (n.bounds.intersects(query))
+            {
+                if (n.is_leaf())
+                {
+                    for (size_t i = n.first; i < n.first + n.count; ++i)
+                    {
+                        if (m_boxes[i].intersects(query))
+                        {
+                            visit(primitive(i));
+                        }
+                    }
+                }
+                else
+                {
+                    stack.push(n.first);
+                    stack.push(index + 1);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Find the primitive nearest to a query point with a branch and bound traversal
+     *
+     * Children are visited nearest-first and subtrees whose bounds are farther from @p point than the nearest
+     * primitive found so far are skipped.
+     * @tparam callable_t Callable with the signature T(size_t primitive) that returns the square of the distance from
+     * @p point to a primitive
+     * @param [in] point The query point
+     * @param [in] dist_squared The callable that computes the squared distance to a single primitive
+     * @param [in] max_dist_squared The square of the largest distance to consider
+     * @return The (possibly empty) pair of the nearest primitive and the square of its distance from @p point
+     */
+    template <typename callable_t>
+    std::optional<std::pair<size_t, T>> nearest(vec_t const& point, callable_t&& dist_squared,
+                                                T max_dist_squared = math::constants<T>::pos_inf) const
+    {
+        if (empty())
+        {
+            return std::nullopt;
+        }
+
+        std::optional<std::pair<size_t, T>> best;
+        traversal_stack<std::pair<size_t, T>> stack({root(), m_nodes[root()].bounds.dist_squared(point)});
+        while (!stack.empty())
+        {
+            auto const [index, bound] = stack.pop();
+            if (bound > max_dist_squared) // a nearer primitive was found after this node was pushed
+            {
+                continue;
+            }
+
+            node_t const& n = m_nodes[index];
+            if (n.is_leaf())
+            {
+                for (size_t i = n.first; i < n.first + n.count; ++i)
+                {
+                    if (m_boxes[i].dist_squared(point) <= max_dist_squared)
+                    {
+                        T const d = dist_squared(primitive(i));
+                        if (d <= max_dist_squared && (!best || d < best->second))
+                        {
+                            best = std::make_pair(primitive(i), d);
+                            max_dist_squared = d;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // push the farther child first so that the nearer child is visited first
+                size_t const left = index + 1;
+                size_t const right = n.first;
+                T const l = m_nodes[left].bounds.dist_squared(point);
+                T const r = m_nodes[right].bounds.dist_squared(point);
+                bool const left_first = l <= r;
+                stack.push(left_first ? std::make_pair(right, r) : std::make_pair(left, l));
+                stack.push(left_first ? std::make_pair(left, l) : std::make_pair(right, r));
+            }
+        }
+        return best;
+    }
+
+private:
+    // build the subtree over the primitives in m_indices[begin, end) and return the index of its root
+    size_t build(std::vector<aabb_t> const& boxes, std::vector<vec_t> const& centroids, size_t const begin,
+                 size_t const end)
+    {
+        size_t const index = m_nodes.size();
+        m_nodes.push_back(node_t{aabb_t::nothing(), 0, 0});
+
+        aabb_t bounds = aabb_t::nothing();
+        aabb_t centroid_bounds = aabb_t::nothing();
+        for (size_t i = begin; i < end; ++i)
+        {
+            bounds.fit(boxes[m_indices[i]]);
+            centroid_bounds.fit(centroids[m_indices[i]]);
+        }
+        m_nodes[index].bounds = bounds;
+
+        // find the longest axis of the centroid bounds
+        vec_t const diagonal = centroid_bounds.diagonal();
+        size_t axis = 0;
+        for (size_t d = 1; d < N; ++d)
+        {
+            axis = (diagonal[d] > diagonal[axis]) ? d : axis;
+        }
+
+        // make a leaf if there are few primitives
+        if (end - begin <= m_leaf_size)
+        {
+            m_nodes[index].first = static_cast<uint32_t>(begin);
+            m_nodes[index].count = static_cast<uint32_t>(end - begin);
+            for (size_t i = begin; i < end; ++i)
+            {
+                m_boxes.push_back(boxes[m_indices[i]]);
+            }
+            return index;
+        }
+
+        // split at the median centroid
+        size_t const mid = begin + (end - begin) / 2;
+        auto less = [&](uint32_t const lhs, uint32_t const rhs) { return centroids[lhs][axis] < centroids[rhs][axis]; };
+        std::nth_element(m_indices.begin() + begin, m_indices.begin() + mid, m_indices.begin() + end, less);
+
+        build(boxes, centroids, begin, mid);
+        size_t const right = build(boxes, centroids, mid, end);
+        m_nodes[index].first = static_cast<uint32_t>(right);
+        return index;
+    }
+
+private:
+    size_t m_leaf_size;
+    std::vector<node_t> m_nodes;
+    std::vector<uint32_t> m_indices; // primitive indices ordered so that each leaf is a contiguous range
+    std::vector<aabb_t> m_boxes;     // primitive bounds in the same order as m_indices
+};
+
+} // namespace stf::spatial
+
+#endif
\ No newline at end of file
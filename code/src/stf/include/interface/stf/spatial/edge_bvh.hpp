@@ -0,0 +1,226 @@
+#ifndef STF_SPATIAL_EDGE_BVH_HPP_HEADER_GUARD
+#define STF_SPATIAL_EDGE_BVH_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "stf/geom/aabb.hpp"
+#include "stf/geom/holygon.hpp"
+#include "stf/geom/polygon.hpp"
+#include "stf/geom/polyline.hpp"
+#include "stf/geom/segment.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/math/vector.hpp"
+#include "stf/spatial/bvh.hpp"
+
+/**
+ * @file edge_bvh.hpp
+ * @brief A file containing a class that indexes the edges of polylines and polygons for nearest edge queries
+ */
+
+namespace stf::spatial
+{
+
+/**
+ * @brief A class that stores the edges of a polyline (or the rings of a polygon) in a @ref bvh
+ *
+ * A nearest edge query is a branch and bound traversal of the hierarchy, so it only computes the distance to the edges
+ * whose bounds are nearer than the nearest edge found so far. For long polylines and queries near the geometry this is
+ * O(log n) rather than the O(n) of @ref geom::polyline::dist_squared.
+ *
+ * Edges are numbered in the order of the input: edge i of a polyline or polygon starts at vertex i, and the edges of
+ * a holygon are the edges of the hull followed by the edges of each hole.
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ */
+template <typename T, size_t N>
+class edge_bvh final
+{
+public:
+    /**
+     * @brief Type alias for a vector
+     */
+    using vec_t = math::vec<T, N>;
+
+    /**
+     * @brief Type alias for a segment
+     */
+    using segment_t = geom::segment<T, N>;
+
+    /**
+     * @brief Type alias for an aabb
+     */
+    using aabb_t = geom::aabb<T, N>;
+
+    /**
+     * @brief The result of a nearest edge query
+     */
+    struct nearest_t
+    {
+        /**
+         * @brief The square of the distance from the query to the nearest edge
+         */
+        T dist_squared;
+
+        /**
+         * @brief The point on the nearest edge that is closest to the query
+         */
+        vec_t point;
+
+        /**
+         * @brief The index of the nearest edge
+         */
+        size_t edge;
+    };
+
+public:
+    /**
+     * @brief Construct from a set of edges
+     * @param [in] edges
+     * @param [in] leaf_size The maximum number of edges stored in a leaf of the hierarchy
+     */
+    explicit edge_bvh(std::vector<segment_t> const& edges, size_t const leaf_size = 4)
+        : m_edges(edges)
+        , m_tree(edge_bvh::bounds(edges), leaf_size)
+    {
+    }
+
+    /**
+     * @brief Construct from the edges of a @ref geom::polyline
+     * @param [in] polyline
+     * @param [in] leaf_size The maximum number of edges stored in a leaf of the hierarchy
+     */
+    explicit edge_bvh(geom::polyline<T, N> const& polyline, size_t const leaf_size = 4)
+        : edge_bvh(edge_bvh::edges(polyline), leaf_size)
+    {
+    }
+
+    /**
+     * @brief Construct from the edges of a @ref geom::polygon
+     * @param [in] polygon
+     * @param [in] leaf_size The maximum number of edges stored in a leaf of the hierarchy
+     */
+    explicit edge_bvh(geom::polygon<T> const& polygon, size_t const leaf_size = 4)
+        requires(N == 2)
+        : edge_bvh(edge_bvh::edges({&polygon}), leaf_size)
+    {
+    }
+
+    /**
+     * @brief Construct from the edges of a @ref geom::holygon
+     * @param [in] holygon
+     * @param [in] leaf_size The maximum number of edges stored in a leaf of the hierarchy
+     */
+    explicit edge_bvh(geom::holygon<T> const& holygon, size_t const leaf_size = 4)
+        requires(N == 2)
+        : edge_bvh(edge_bvh::edges(geom::guts::rings(holygon)), leaf_size)
+    {
+    }
+
+    /**
+     * @brief Find the edge nearest to a query point
+     * @param [in] point The query point
+     * @param [in] max_dist_squared The square of the largest distance to consider
+     * @return The (possibly empty) nearest edge within sqrt(@p max_dist_squared) of @p point
+     */
+    std::optional<nearest_t> nearest(vec_t const& point, T const max_dist_squared = math::constants<T>::pos_inf) const
+    {
+        auto dist_squared = [&](size_t const i) { return math::dist_squared(point, closest(m_edges[i], point)); };
+        if (auto const found = m_tree.nearest(point, dist_squared, max_dist_squared))
+        {
+            return nearest_t{found->second, closest(m_edges[found->first], point), found->first};
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Access an edge
+     * @param [in] i The index of the edge
+     * @return Const reference to edge @p i
+     */
+    inline segment_t const& edge(size_t const i) const { return m_edges[i]; }
+
+    /**
+     * @brief Compute the number of edges
+     * @return The number of edges
+     */
+    inline size_t size() const { return m_edges.size(); }
+
+    /**
+     * @brief Const access to the hierarchy over the edge bounds
+     * @return Const reference to the hierarchy
+     */
+    inline bvh<T, N> const& tree() const { return m_tree; }
+
+private:
+    // the point on an edge that is closest to a query point (robust to edges with coincident endpoints)
+    static vec_t closest(segment_t const& edge, vec_t const& point)
+    {
+        vec_t const delta = edge.delta();
+        T const length_squared = math::dot(delta, delta);
+        if (length_squared == math::constants<T>::zero)
+        {
+            return edge.a;
+        }
+        T const t = std::clamp(math::dot(point - edge.a, delta) / length_squared, math::constants<T>::zero,
+                               math::constants<T>::one);
+        return edge.a + t * delta;
+    }
+
+    static std::vector<aabb_t> bounds(std::vector<segment_t> const& edges)
+    {
+        std::vector<aabb_t> boxes;
+        boxes.reserve(edges.size());
+        for (segment_t const& edge : edges)
+        {
+            boxes.push_back(edge.aabb());
+        }
+        return boxes;
+    }
+
+    static std::vector<segment_t> edges(geom::polyline<T, N> const& polyline)
+    {
+        std::vector<segment_t> edges;
+        for (size_t i = 0; i + 1 < polyline.size(); ++i)
+        {
+            edges.push_back(polyline.edge(i));
+        }
+        return edges;
+    }
+
+    static std::vector<segment_t> edges(std::vector<geom::polygon<T> const*> const& rings)
+    {
+        std::vector<segment_t> edges;
+        for (geom::polygon<T> const* ring : rings)
+        {
+            for (size_t i = 0; i < ring->size(); ++i)
+            {
+                edges.push_back(ring->edge(i));
+            }
+        }
+        return edges;
+    }
+
+private:
+    std::vector<segment_t> m_edges;
+    bvh<T, N> m_tree;
+};
+
+/**
+ * @brief Type alias for a 2D edge bvh
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+using edge_bvh2 = edge_bvh<T, 2>;
+
+/**
+ * @brief Type alias for a 3D edge bvh
+ * @tparam T Number type (eg float)
+ */
+template <typename T>
+using edge_bvh3 = edge_bvh<T, 3>;
+
+} // namespace stf::spatial
+
+#endif
\ No newline at end of file
@@ -0,0 +1,287 @@
+#ifndef STF_SPATIAL_SEPARATING_AXIS_CACHE_HPP_HEADER_GUARD
+#define STF_SPATIAL_SEPARATING_AXIS_CACHE_HPP_HEADER_GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "stf/geom/obb.hpp"
+#include "stf/math/constants.hpp"
+#include "stf/spatial/sweep_and_prune.hpp"
+
+/**
+ * @file separating_axis_cache.hpp
+ * @brief A file containing a temporally coherent cache of separating axes for obb pair tests
+ */
+
+namespace stf::spatial
+{
+
+/// @cond DELETED
+namespace guts
+{
+
+// an open-addressing hash map from 64-bit keys to bytes. the table uses linear probing and stores keys and values in
+// the same slot so that a lookup touches a single cache line in the common case.
+class byte_map final
+{
+public:
+    static constexpr uint64_t c_empty = std::numeric_limits<uint64_t>::max();
+
+    size_t size() const { return m_size; }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_size = 0;
+    }
+
+    // returns a reference to the value for key, inserting fallback if key is not present
+    uint8_t& find_or_insert(uint64_t const key, uint8_t const fallback)
+    {
+        if (2 * (m_size + 1) > m_slots.size())
+        {
+            grow();
+        }
+
+        size_t const mask = m_slots.size() - 1;
+        size_t slot = hash(key) & mask;
+        while (m_slots[slot].key != c_empty)
+        {
+            if (m_slots[slot].key == key)
+            {
+                return m_slots[slot].value;
+            }
+            slot = (slot + 1) & mask;
+        }
+        ++m_size;
+        m_slots[slot] = {key, fallback};
+        return m_slots[slot].value;
+    }
+
+private:
+    struct slot_t final
+    {
+        uint64_t key;
+        uint8_t value;
+    };
+
+    static size_t hash(uint64_t const key) { return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32); }
+
+    void grow()
+    {
+        std::vector<slot_t> slots(std::max(static_cast<size_t>(64), 2 * m_slots.size()), slot_t{c_empty, 0});
+        size_t const mask = slots.size() - 1;
+        for (slot_t const& entry : m_slots)
+        {
+            if (entry.key != c_empty)
+            {
+                size_t slot = hash(entry.key) & mask;
+                while (slots[slot].key != c_empty)
+                {
+                    slot = (slot + 1) & mask;
+                }
+                slots[slot] = entry;
+            }
+        }
+        m_slots = std::move(slots);
+    }
+
+private:
+    std::vector<slot_t> m_slots;
+    size_t m_size = 0;
+};
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief A class that accelerates repeated intersection tests between pairs of 3D obbs
+ *
+ * The separating axis test for two 3D obbs considers 15 candidate axes: the 3 face normals of each box and the 9 cross
+ * products of their edge directions. When the boxes move coherently between frames, the axis that separated a pair in
+ * the previous frame usually still separates it. This class records which candidate axis last separated each pair
+ * (identified by a key) and tests that axis first. Each axis is tested by comparing the distance between the projected
+ * centers against the sum of the projected radii, and the answer matches @ref geom::intersects (up to rounding when
+ * the boxes are just touching).
+ *
+ * A query is a hit if the cached axis separated the pair and a miss otherwise (including queries for pairs that
+ * intersect or that have no cached axis). The counters accumulate until @ref reset_counters is called.
+ * @tparam T Number type (eg float)
+ * @note Entries are never evicted automatically, so call @ref clear when the set of tracked pairs changes wholesale
+ */
+template <typename T>
+class separating_axis_cache final
+{
+public:
+    /**
+     * @brief Type alias for obb type
+     */
+    using obb_t = geom::obb3<T>;
+
+    /**
+     * @brief Type alias for vector type
+     */
+    using vec_t = math::vec3<T>;
+
+    /**
+     * @brief Type alias for the key that identifies a pair
+     */
+    using key_t = uint64_t;
+
+    /**
+     * @brief The number of candidate axes for a pair of 3D obbs
+     */
+    static constexpr uint8_t c_num_axes = 15;
+
+public:
+    /**
+     * @brief Compute the key for a pair of indices
+     * @param [in] pair
+     * @return The key identifying @p pair
+     */
+    static inline key_t key(index_pair const& pair)
+    {
+        return (static_cast<key_t>(pair.first) << 32) | static_cast<key_t>(pair.second);
+    }
+
+    /**
+     * @brief Compute a candidate separating axis for a pair of obbs
+     *
+     * Axes 0-2 are the basis of @p lhs, axes 3-5 are the basis of @p rhs, and axis 6 + 3 * i + j is the cross product
+     * of basis vector i of @p lhs with basis vector j of @p rhs.
+     * @param [in] index The index of the axis (less than @ref c_num_axes)
+     * @param [in] lhs
+     * @param [in] rhs
+     * @return The candidate axis (which may be the zero vector if edges are parallel)
+     */
+    static inline vec_t axis(uint8_t const index, obb_t const& lhs, obb_t const& rhs)
+    {
+        if (index < 3)
+        {
+            return lhs.basis()[index];
+        }
+        else if (index < 6)
+        {
+            return rhs.basis()[index - 3];
+        }
+        uint8_t const edges = index - 6;
+        return math::cross(lhs.basis()[edges / 3], rhs.basis()[edges % 3]);
+    }
+
+    /**
+     * @brief Compute whether or not two obbs intersect, testing the cached separating axis of the pair first
+     * @param [in] key The key identifying the pair (see @ref key)
+     * @param [in] lhs
+     * @param [in] rhs
+     * @return Whether or not @p lhs intersects @p rhs
+     */
+    bool intersects(key_t const key, obb_t const& lhs, obb_t const& rhs)
+    {
+        uint8_t& cached = m_axes.find_or_insert(key, c_num_axes);
+        if (cached < c_num_axes && separates(cached, lhs, rhs))
+        {
+            ++m_hits;
+            return false;
+        }
+
+        ++m_misses;
+        for (uint8_t i = 0; i < c_num_axes; ++i)
+        {
+            if (i != cached && separates(i, lhs, rhs))
+            {
+                cached = i;
+                return false;
+            }
+        }
+        cached = c_num_axes;
+        return true;
+    }
+
+    /**
+     * @brief Compute which candidate pairs (eg from a broadphase) of obbs intersect
+     *
+     * Each pair is keyed by its indices, so the same pair is recognized across frames regardless of its position in
+     * @p candidates.
+     * @param [in] boxes The obbs
+     * @param [in] candidates Pairs of indices into @p boxes
+     * @param [out] intersecting The candidate pairs that intersect (cleared first, in the order of @p candidates)
+     */
+    void intersecting_pairs(std::span<obb_t const> const boxes, std::span<index_pair const> const candidates,
+                            std::vector<index_pair>& intersecting)
+    {
+        intersecting.clear();
+        for (index_pair const& pair : candidates)
+        {
+            if (intersects(key(pair), boxes[pair.first], boxes[pair.second]))
+            {
+                intersecting.push_back(pair);
+            }
+        }
+    }
+
+    /**
+     * @brief Getter for the number of queries resolved by their cached axis
+     * @return The number of hits since the counters were last reset
+     */
+    inline size_t hits() const { return m_hits; }
+
+    /**
+     * @brief Getter for the number of queries not resolved by their cached axis
+     * @return The number of misses since the counters were last reset
+     */
+    inline size_t misses() const { return m_misses; }
+
+    /**
+     * @brief Reset the hit and miss counters to zero
+     */
+    inline void reset_counters()
+    {
+        m_hits = 0;
+        m_misses = 0;
+    }
+
+    /**
+     * @brief Compute the number of pairs in the cache
+     * @return The number of pairs that have been queried since the cache was last cleared
+     */
+    inline size_t size() const { return m_axes.size(); }
+
+    /**
+     * @brief Remove all pairs from the cache (the counters are unchanged)
+     */
+    inline void clear() { m_axes.clear(); }
+
+private:
+    // an axis separates the boxes if the distance between the projected centers exceeds the sum of the projected radii
+    static inline bool separates(uint8_t const index, obb_t const& lhs, obb_t const& rhs)
+    {
+        vec_t const candidate = axis(index, lhs, rhs);
+        T const distance = std::abs(math::dot(rhs.center() - lhs.center(), candidate));
+        return distance > radius(lhs, candidate) + radius(rhs, candidate);
+    }
+
+    static inline T radius(obb_t const& box, vec_t const& axis)
+    {
+        T radius = math::constants<T>::zero;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            radius += box.half_extents()[i] * std::abs(math::dot(box.basis()[i], axis));
+        }
+        return radius;
+    }
+
+private:
+    guts::byte_map m_axes;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+};
+
+} // namespace stf::spatial
+
+#endif
\ No newline at end of file
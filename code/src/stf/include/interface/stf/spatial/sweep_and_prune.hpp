@@ -0,0 +1,448 @@
+#ifndef STF_SPATIAL_SWEEP_AND_PRUNE_HPP_HEADER_GUARD
+#define STF_SPATIAL_SWEEP_AND_PRUNE_HPP_HEADER_GUARD
+
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "stf/alg/parallel.hpp"
+#include "stf/geom/aabb.hpp"
+#include "stf/math/constants.hpp"
+
+/**
+ * @file sweep_and_prune.hpp
+ * @brief A file containing broadphase collision detection via sweep and prune
+ */
+
+namespace stf::spatial
+{
+
+/**
+ * @brief Type alias for a pair of box indices (with first < second)
+ */
+using index_pair = std::pair<uint32_t, uint32_t>;
+
+/// @cond DELETED
+namespace guts
+{
+
+// an open-addressing hash set of index pairs that stores the pairs contiguously. the table uses linear probing with
+// backward shift deletion so erasing does not leave tombstones. memory is only allocated when the table grows.
+class pair_set final
+{
+public:
+    std::vector<index_pair> const& pairs() const { return m_pairs; }
+
+    void clear()
+    {
+        m_pairs.clear();
+        std::fill(m_slots.begin(), m_slots.end(), c_empty);
+    }
+
+    void insert(index_pair const& pair)
+    {
+        if (2 * (m_pairs.size() + 1) > m_slots.size())
+        {
+            grow();
+        }
+
+        size_t const mask = m_slots.size() - 1;
+        size_t slot = hash(pair) & mask;
+        while (m_slots[slot] != c_empty)
+        {
+            if (m_pairs[m_slots[slot]] == pair)
+            {
+                return;
+            }
+            slot = (slot + 1) & mask;
+        }
+        m_slots[slot] = static_cast<uint32_t>(m_pairs.size());
+        m_pairs.push_back(pair);
+    }
+
+    void erase(index_pair const& pair)
+    {
+        size_t const slot = find(pair);
+        if (slot == c_missing)
+        {
+            return;
+        }
+
+        // move the last pair into the erased position of the flat buffer
+        uint32_t const index = m_slots[slot];
+        uint32_t const last = static_cast<uint32_t>(m_pairs.size() - 1);
+        if (index != last)
+        {
+            m_slots[find(m_pairs[last])] = index;
+            m_pairs[index] = m_pairs[last];
+        }
+        m_pairs.pop_back();
+
+        // shift subsequent entries of the probe sequence back into the hole
+        size_t const mask = m_slots.size() - 1;
+        size_t hole = slot;
+        size_t next = (hole + 1) & mask;
+        while (m_slots[next] != c_empty)
+        {
+            size_t const home = hash(m_pairs[m_slots[next]]) & mask;
+            // the entry can fill the hole if its home is not cyclically in (hole, next]
+            if (((next - home) & mask) >= ((next - hole) & mask))
+            {
+                m_slots[hole] = m_slots[next];
+                hole = next;
+            }
+            next = (next + 1) & mask;
+        }
+        m_slots[hole] = c_empty;
+    }
+
+private:
+    static constexpr uint32_t c_empty = std::numeric_limits<uint32_t>::max();
+    static constexpr size_t c_missing = std::numeric_limits<size_t>::max();
+
+    static size_t hash(index_pair const& pair)
+    {
+        uint64_t const key = (static_cast<uint64_t>(pair.first) << 32) | static_cast<uint64_t>(pair.second);
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    size_t find(index_pair const& pair) const
+    {
+        if (m_slots.empty())
+        {
+            return c_missing;
+        }
+
+        size_t const mask = m_slots.size() - 1;
+        for (size_t slot = hash(pair) & mask; m_slots[slot] != c_empty; slot = (slot + 1) & mask)
+        {
+            if (m_pairs[m_slots[slot]] == pair)
+            {
+                return slot;
+            }
+        }
+        return c_missing;
+    }
+
+    void grow()
+    {
+        m_slots.assign(std::max(static_cast<size_t>(64), 2 * m_slots.size()), c_empty);
+        size_t const mask = m_slots.size() - 1;
+        for (size_t i = 0; i < m_pairs.size(); ++i)
+        {
+            size_t slot = hash(m_pairs[i]) & mask;
+            while (m_slots[slot] != c_empty)
+            {
+                slot = (slot + 1) & mask;
+            }
+            m_slots[slot] = static_cast<uint32_t>(i);
+        }
+    }
+
+private:
+    std::vector<index_pair> m_pairs;
+    std::vector<uint32_t> m_slots;
+};
+
+template <typename T, size_t N>
+size_t widest_axis(std::span<geom::aabb<T, N> const> const boxes)
+{
+    // choose the axis along which the box centers have the greatest variance so the sweep prunes the most pairs
+    std::array<T, N> sum = {};
+    std::array<T, N> sum_squared = {};
+    for (geom::aabb<T, N> const& box : boxes)
+    {
+        for (size_t d = 0; d < N; ++d)
+        {
+            T const center = box.min[d] + box.max[d];
+            sum[d] += center;
+            sum_squared[d] += center * center;
+        }
+    }
+
+    size_t axis = 0;
+    T variance = math::constants<T>::neg_inf;
+    for (size_t d = 0; d < N; ++d)
+    {
+        T const n = static_cast<T>(boxes.size());
+        T const v = sum_squared[d] - sum[d] * sum[d] / n;
+        if (v > variance)
+        {
+            variance = v;
+            axis = d;
+        }
+    }
+    return axis;
+}
+
+} // namespace guts
+/// @endcond
+
+/**
+ * @brief Compute all pairs of intersecting boxes with a (non-incremental) sweep and prune
+ *
+ * The boxes are sorted by their minimum along the axis with the greatest spread of box centers. Each box is then
+ * tested against the boxes that start before it ends along that axis. The sweep is split across threads and each
+ * thread writes to its own buffer before the buffers are concatenated into @p pairs.
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ * @param [in] boxes
+ * @param [out] pairs The pairs of indices of intersecting boxes (cleared before writing)
+ * @param [in] threads The maximum number of threads to use
+ * @note The pairs are written in the same order regardless of @p threads
+ */
+template <typename T, size_t N>
+void overlapping_pairs(std::span<geom::aabb<T, N> const> const boxes, std::vector<index_pair>& pairs,
+                       size_t const threads = 1)
+{
+    pairs.clear();
+    if (boxes.size() < 2)
+    {
+        return;
+    }
+
+    size_t const axis = guts::widest_axis<T, N>(boxes);
+    std::vector<uint32_t> order(boxes.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    std::sort(order.begin(), order.end(),
+              [&](uint32_t const lhs, uint32_t const rhs) { return boxes[lhs].min[axis] < boxes[rhs].min[axis]; });
+
+    // copy the boxes in sorted order so the sweep reads memory sequentially
+    std::vector<geom::aabb<T, N>> sorted;
+    sorted.reserve(order.size());
+    for (uint32_t const i : order)
+    {
+        sorted.push_back(boxes[i]);
+    }
+
+    size_t const chunks = std::clamp(threads, static_cast<size_t>(1), order.size());
+    std::vector<std::vector<index_pair>> buffers(chunks - 1);
+    alg::parallel_for(order.size(), chunks, [&](size_t const begin, size_t const end, size_t const thread)
+    {
+        std::vector<index_pair>& buffer = (thread == 0) ? pairs : buffers[thread - 1];
+        for (size_t i = begin; i < end; ++i)
+        {
+            geom::aabb<T, N> const& box = sorted[i];
+            for (size_t j = i + 1; j < sorted.size() && sorted[j].min[axis] <= box.max[axis]; ++j)
+            {
+                // the boxes overlap along the sweep axis so only test the other axes (without branching per axis)
+                bool overlap = true;
+                for (size_t d = 0; d < N; ++d)
+                {
+                    overlap &= (d == axis) | ((sorted[j].min[d] <= box.max[d]) & (box.min[d] <= sorted[j].max[d]));
+                }
+                if (overlap)
+                {
+                    buffer.emplace_back(std::min(order[i], order[j]), std::max(order[i], order[j]));
+                }
+            }
+        }
+    });
+
+    for (std::vector<index_pair> const& buffer : buffers)
+    {
+        pairs.insert(pairs.end(), buffer.begin(), buffer.end());
+    }
+}
+
+/**
+ * @brief A class that implements incremental sweep and prune over a set of moving boxes
+ *
+ * The class stores the sorted endpoints of the boxes along each axis and the set of intersecting pairs. Each call to
+ * @ref update re-sorts the endpoints with insertion sort. When boxes move a small amount between updates the endpoints
+ * are nearly sorted, so an update takes O(n + s) time where s is the number of endpoint swaps. Each swap between the
+ * minimum of one box and the maximum of another means the boxes began or stopped overlapping along that axis, and the
+ * persistent pair set is updated accordingly.
+ *
+ * The axes are independent, so with more than one thread each axis is sorted concurrently. The swaps on each axis are
+ * recorded as pair events in a per-axis buffer and then applied to the pair set in axis order, so the result does not
+ * depend on the number of threads (and at most N threads are used by an update).
+ *
+ * Boxes are identified by their index in the span passed to @ref update. The intersecting pairs are stored in a flat
+ * buffer and memory is only allocated when the number of boxes or pairs grows beyond any previous update.
+ * @tparam T Number type (eg float)
+ * @tparam N Dimension
+ */
+template <typename T, size_t N>
+class sweep_and_prune final
+{
+public:
+    /**
+     * @brief Type alias for aabb type
+     */
+    using aabb_t = geom::aabb<T, N>;
+
+public:
+    /**
+     * @brief Default constructor -- no boxes
+     */
+    sweep_and_prune() = default;
+
+    /**
+     * @brief Construct from a set of boxes
+     * @param [in] boxes
+     * @param [in] threads The maximum number of threads to use
+     */
+    explicit sweep_and_prune(std::span<aabb_t const> const boxes, size_t const threads = 1) { update(boxes, threads); }
+
+    /**
+     * @brief Update the boxes and the set of intersecting pairs
+     * @param [in] boxes The current boxes (if the number of boxes changed then the structure is rebuilt)
+     * @param [in] threads The maximum number of threads to use
+     */
+    void update(std::span<aabb_t const> const boxes, size_t const threads = 1)
+    {
+        if (boxes.size() != m_boxes.size())
+        {
+            rebuild(boxes, threads);
+            return;
+        }
+
+        std::copy(boxes.begin(), boxes.end(), m_boxes.begin());
+        alg::parallel_for(N, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t d = begin; d < end; ++d)
+            {
+                sort(d);
+            }
+        });
+
+        for (std::vector<event_t> const& events : m_events)
+        {
+            for (event_t const& event : events)
+            {
+                if (event.overlap)
+                {
+                    m_pairs.insert(event.pair);
+                }
+                else
+                {
+                    m_pairs.erase(event.pair);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Access the intersecting pairs
+     * @return The pairs of indices of intersecting boxes (in no particular order)
+     */
+    std::vector<index_pair> const& pairs() const { return m_pairs.pairs(); }
+
+    /**
+     * @brief Compute the number of boxes
+     * @return The number of boxes
+     */
+    size_t size() const { return m_boxes.size(); }
+
+private:
+    struct endpoint_t
+    {
+        T value;
+        // the box index shifted left by one with the low bit set for the maximum of the box
+        uint32_t data;
+
+        inline uint32_t box() const { return data >> 1; }
+        inline bool is_max() const { return (data & 1) != 0; }
+
+        // minimums precede maximums with equal values so that touching boxes overlap (matching aabb::intersects)
+        inline bool operator<(endpoint_t const& rhs) const
+        {
+            return value < rhs.value || (value == rhs.value && (data & 1) < (rhs.data & 1));
+        }
+    };
+
+    // a pair of boxes that started (or stopped) overlapping when the endpoints along an axis were re-sorted
+    struct event_t
+    {
+        index_pair pair;
+        bool overlap;
+    };
+
+private:
+    static inline index_pair pair(uint32_t const a, uint32_t const b) { return {std::min(a, b), std::max(a, b)}; }
+
+    // re-sort the endpoints along axis d with insertion sort, recording the pair events (only reads shared state)
+    void sort(size_t const d)
+    {
+        std::vector<endpoint_t>& endpoints = m_endpoints[d];
+        std::vector<event_t>& events = m_events[d];
+        events.clear();
+        for (endpoint_t& endpoint : endpoints)
+        {
+            aabb_t const& box = m_boxes[endpoint.box()];
+            endpoint.value = endpoint.is_max() ? box.max[d] : box.min[d];
+        }
+
+        for (size_t i = 1; i < endpoints.size(); ++i)
+        {
+            endpoint_t const moving = endpoints[i];
+            size_t j = i;
+            for (; j > 0 && moving < endpoints[j - 1]; --j)
+            {
+                endpoint_t const& passed = endpoints[j - 1];
+                if (!moving.is_max() && passed.is_max())
+                {
+                    // the boxes started overlapping along this axis
+                    if (m_boxes[moving.box()].intersects(m_boxes[passed.box()]))
+                    {
+                        events.push_back(event_t{sweep_and_prune::pair(moving.box(), passed.box()), true});
+                    }
+                }
+                else if (moving.is_max() && !passed.is_max())
+                {
+                    // the boxes stopped overlapping along this axis
+                    events.push_back(event_t{sweep_and_prune::pair(moving.box(), passed.box()), false});
+                }
+                endpoints[j] = passed;
+            }
+            endpoints[j] = moving;
+        }
+    }
+
+    void rebuild(std::span<aabb_t const> const boxes, size_t const threads)
+    {
+        m_boxes.assign(boxes.begin(), boxes.end());
+        alg::parallel_for(N, threads, [&](size_t const begin, size_t const end, size_t)
+        {
+            for (size_t d = begin; d < end; ++d)
+            {
+                std::vector<endpoint_t>& endpoints = m_endpoints[d];
+                endpoints.clear();
+                for (size_t i = 0; i < boxes.size(); ++i)
+                {
+                    uint32_t const data = static_cast<uint32_t>(i) << 1;
+                    endpoints.push_back(endpoint_t{boxes[i].min[d], data});
+                    endpoints.push_back(endpoint_t{boxes[i].max[d], data | 1});
+                }
+                std::sort(endpoints.begin(), endpoints.end());
+            }
+        });
+
+        m_pairs.clear();
+        std::vector<index_pair> pairs;
+        overlapping_pairs<T, N>(boxes, pairs, threads);
+        for (index_pair const& p : pairs)
+        {
+            m_pairs.insert(p);
+        }
+    }
+
+private:
+    std::vector<aabb_t> m_boxes;
+    std::array<std::vector<endpoint_t>, N> m_endpoints;
+    std::array<std::vector<event_t>, N> m_events;
+    guts::pair_set m_pairs;
+};
+
+} // namespace stf::spatial
+
+#endif
\ No newline at end of file
@@ -4,14 +4,23 @@
 #include <cstdint>
 
 #include "stf/cam/frustum.hpp"
+#include "stf/cam/occlusion.hpp"
+#include "stf/cam/prepared_frustum.hpp"
 #include "stf/cam/scamera.hpp"
 #include "stf/geom/aabb.hpp"
+#include "stf/geom/cone.hpp"
+#include "stf/geom/convex_polygon.hpp"
+#include "stf/geom/half_edge_mesh.hpp"
 #include "stf/geom/holygon.hpp"
+#include "stf/geom/mesh.hpp"
 #include "stf/geom/obb.hpp"
 #include "stf/geom/polygon.hpp"
 #include "stf/geom/polyline.hpp"
+#include "stf/geom/prepared_holygon.hpp"
+#include "stf/geom/prepared_polygon.hpp"
 #include "stf/geom/ray.hpp"
 #include "stf/geom/segment.hpp"
+#include "stf/geom/triangle.hpp"
 #include "stf/geom/hyperplane.hpp"
 #include "stf/geom/hypersphere.hpp"
 #include "stf/math/constants.hpp"
@@ -123,6 +132,26 @@ struct instantiate_types
      */
     using segment3 = geom::segment3<T>;
 
+    /**
+     * @brief Type alias for triangle2
+     */
+    using triangle2 = geom::triangle2<T>;
+
+    /**
+     * @brief Type alias for triangle3
+     */
+    using triangle3 = geom::triangle3<T>;
+
+    /**
+     * @brief Type alias for mesh
+     */
+    using mesh = geom::mesh<T>;
+
+    /**
+     * @brief Type alias for half_edge_mesh
+     */
+    using half_edge_mesh = geom::half_edge_mesh<T>;
+
     /**
      * @brief Type alias for ray2
      */
@@ -148,6 +177,11 @@ struct instantiate_types
      */
     using sphere = geom::sphere<T>;
 
+    /**
+     * @brief Type alias for cone
+     */
+    using cone = geom::cone<T>;
+
     /**
      * @brief Type alias for polyline2
      */
@@ -158,11 +192,26 @@ struct instantiate_types
      */
     using polygon = geom::polygon<T>;
 
+    /**
+     * @brief Type alias for convex_polygon
+     */
+    using convex_polygon = geom::convex_polygon<T>;
+
     /**
      * @brief Type alias for holygon
      */
     using holygon = geom::holygon<T>;
 
+    /**
+     * @brief Type alias for prepared_holygon
+     */
+    using prepared_holygon = geom::prepared_holygon<T>;
+
+    /**
+     * @brief Type alias for prepared_polygon
+     */
+    using prepared_polygon = geom::prepared_polygon<T>;
+
     /**
      * @brief Type alias for scamera
      */
@@ -172,6 +221,16 @@ struct instantiate_types
      * @brief Type alias for frustum
      */
     using frustum = cam::frustum<T>;
+
+    /**
+     * @brief Type alias for prepared_frustum
+     */
+    using prepared_frustum = cam::prepared_frustum<T>;
+
+    /**
+     * @brief Type alias for occlusion_buffer
+     */
+    using occlusion_buffer = cam::occlusion_buffer<T>;
 };
 
 /**
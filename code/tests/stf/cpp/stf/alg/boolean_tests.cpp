@@ -0,0 +1,104 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/boolean.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+static stfd::holygon square(stfd::vec2 const& min, stfd::vec2 const& max)
+{
+    return stfd::holygon(stfd::polygon({min, stfd::vec2(max.x, min.y), max, stfd::vec2(min.x, max.y)}));
+}
+
+TEST(boolean, areas)
+{
+    stfd::holygon const a = square(stfd::vec2(0), stfd::vec2(2));
+    stfd::holygon const b = square(stfd::vec2(1), stfd::vec2(3));
+    stfd::holygon const clockwise(stfd::polygon({stfd::vec2(1), stfd::vec2(1, 3), stfd::vec2(3), stfd::vec2(3, 1)}));
+    stfd::holygon const big = square(stfd::vec2(0), stfd::vec2(4));
+    stfd::holygon const ring(big.hull(), {square(stfd::vec2(1), stfd::vec2(3)).hull()});
+    stfd::holygon const adjacent = square(stfd::vec2(2, 0), stfd::vec2(4, 2));
+    stfd::holygon const corner = square(stfd::vec2(2), stfd::vec2(4));
+    stfd::holygon const offset = square(stfd::vec2(1, 2), stfd::vec2(3, 4));
+    std::vector<scaffolding::alg::boolean::areas<double>> tests = {
+        // overlapping squares
+        {{a}, {b}, boolean_types::unite, 1, 0, 7},
+        {{a}, {b}, boolean_types::intersect, 1, 0, 1},
+        {{a}, {b}, boolean_types::subtract, 1, 0, 3},
+        {{a}, {b}, boolean_types::exclusive_or, 2, 0, 6},
+        {{a}, {clockwise}, boolean_types::unite, 1, 0, 7},
+        {{a}, {clockwise}, boolean_types::intersect, 1, 0, 1},
+        // squares that share an edge, part of an edge, or a vertex
+        {{a}, {adjacent}, boolean_types::unite, 1, 0, 8},
+        {{a}, {adjacent}, boolean_types::intersect, 0, 0, 0},
+        {{a}, {offset}, boolean_types::unite, 1, 0, 8},
+        {{a}, {corner}, boolean_types::unite, 2, 0, 8},
+        {{a}, {corner}, boolean_types::intersect, 0, 0, 0},
+        // holes
+        {{big}, {b}, boolean_types::subtract, 1, 1, 12},
+        {{big}, {b}, boolean_types::exclusive_or, 1, 1, 12},
+        {{ring}, {b}, boolean_types::unite, 1, 0, 16},
+        {{ring}, {b}, boolean_types::intersect, 0, 0, 0},
+        {{ring}, {a}, boolean_types::intersect, 1, 0, 3},
+        {{ring}, {square(stfd::vec2(1.5), stfd::vec2(2.5))}, boolean_types::unite, 2, 1, 13},
+        // many polygons in a single operand are merged
+        {{a, b, adjacent}, {}, boolean_types::unite, 1, 0, 10},
+        {{a, a}, {}, boolean_types::unite, 1, 0, 4},
+        {{a, b}, {adjacent}, boolean_types::subtract, 1, 0, 6},
+        // empty operands
+        {{}, {}, boolean_types::unite, 0, 0, 0},
+        {{a}, {}, boolean_types::intersect, 0, 0, 0},
+        {{}, {a}, boolean_types::subtract, 0, 0, 0},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(boolean, simplified)
+{
+    stfd::holygon const a = square(stfd::vec2(0), stfd::vec2(2));
+    stfd::holygon const adjacent = square(stfd::vec2(2, 0), stfd::vec2(4, 2));
+    std::vector<stfd::holygon> const merged = boolean(a, adjacent, boolean_types::unite);
+    ASSERT_EQ(1, merged.size());
+    ASSERT_EQ(4, merged.front().hull().size());
+}
+
+TEST(boolean, side_by_side)
+{
+    // a grid of features that each only overlap a single feature in the other operand
+    size_t const n = 32;
+    std::vector<stfd::holygon> lhs;
+    std::vector<stfd::holygon> rhs;
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            stfd::vec2 const min(2.0 * static_cast<double>(i), 2.0 * static_cast<double>(j));
+            lhs.push_back(square(min, min + stfd::vec2(1)));
+            rhs.push_back(square(min + stfd::vec2(0.5), min + stfd::vec2(1.5)));
+        }
+    }
+    std::vector<scaffolding::alg::boolean::areas<double>> tests = {
+        {lhs, rhs, boolean_types::unite, n * n, 0, 1.75 * n * n},
+        {lhs, rhs, boolean_types::intersect, n * n, 0, 0.25 * n * n},
+        {lhs, rhs, boolean_types::exclusive_or, 2 * n * n, 0, 1.5 * n * n},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(boolean, random)
+{
+    std::vector<scaffolding::alg::boolean::random<double>> tests = {
+        {0, 1, 8, 500},
+        {1, 4, 16, 500},
+        {2, 8, 32, 300},
+        {3, 16, 16, 300},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
@@ -72,4 +72,133 @@ TEST(clipping, polyline)
     scaffolding::verify(tests);
 }
 
+TEST(clipping, polygon)
+{
+    stfd::aabb2 box(stfd::vec2(1), stfd::vec2(3));
+    std::vector<scaffolding::alg::clipping::fill<double, stfd::polygon>> tests = {
+        // polygons entirely in the box
+        {box,
+         stfd::polygon({stfd::vec2(1), stfd::vec2(2, 1), stfd::vec2(2)}),
+         {{stfd::vec2(1), stfd::vec2(2, 1), stfd::vec2(2)}}},
+        // polygons that partially intersect the box
+        {box,
+         stfd::polygon({stfd::vec2(0), stfd::vec2(2, 0), stfd::vec2(2), stfd::vec2(0, 2)}),
+         {{stfd::vec2(1), stfd::vec2(2, 1), stfd::vec2(2), stfd::vec2(1, 2)}}},
+        {box,
+         stfd::polygon({stfd::vec2(0), stfd::vec2(4, 0), stfd::vec2(4), stfd::vec2(0, 4)}),
+         {{stfd::vec2(1), stfd::vec2(3, 1), stfd::vec2(3), stfd::vec2(1, 3)}}},
+        {box,
+         stfd::polygon({stfd::vec2(2, 0), stfd::vec2(4, 2), stfd::vec2(2, 4), stfd::vec2(0, 2)}),
+         {{stfd::vec2(1), stfd::vec2(3, 1), stfd::vec2(3), stfd::vec2(1, 3)}}},
+        {box,
+         stfd::polygon({stfd::vec2(2, 2), stfd::vec2(4, 2), stfd::vec2(2, 4)}),
+         {{stfd::vec2(2, 2), stfd::vec2(3, 2), stfd::vec2(3), stfd::vec2(2, 3)}}},
+        // polygons that touch the box at a single point
+        {box, stfd::polygon({stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1)}), {}},
+        // polygons entirely outside the box
+        {box, stfd::polygon({stfd::vec2(4), stfd::vec2(5, 4), stfd::vec2(5)}), {}},
+        {box, stfd::polygon({stfd::vec2(0, 1.5), stfd::vec2(1.5, 0), stfd::vec2(0, 0)}), {}},
+        {box, stfd::polygon(), {}},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(clipping, holygon)
+{
+    stfd::aabb2 box(stfd::vec2(1), stfd::vec2(3));
+    stfd::polygon hull({stfd::vec2(0), stfd::vec2(4, 0), stfd::vec2(4), stfd::vec2(0, 4)});
+    std::vector<scaffolding::alg::clipping::fill<double, stfd::holygon>> tests = {
+        {box, stfd::holygon(hull), {{stfd::vec2(1), stfd::vec2(3, 1), stfd::vec2(3), stfd::vec2(1, 3)}}},
+        {box,
+         stfd::holygon(hull, {stfd::polygon({stfd::vec2(1.5), stfd::vec2(1.5, 2.5), stfd::vec2(2.5)})}),
+         {{stfd::vec2(1), stfd::vec2(3, 1), stfd::vec2(3), stfd::vec2(1, 3)},
+          {stfd::vec2(1.5), stfd::vec2(1.5, 2.5), stfd::vec2(2.5)}}},
+        {box,
+         stfd::holygon(hull, {stfd::polygon({stfd::vec2(0.5), stfd::vec2(0.5, 2), stfd::vec2(2, 0.5)}),
+                              stfd::polygon({stfd::vec2(3.5), stfd::vec2(3.5, 3.75), stfd::vec2(3.75, 3.5)})}),
+         {{stfd::vec2(1), stfd::vec2(3, 1), stfd::vec2(3), stfd::vec2(1, 3)},
+          {stfd::vec2(1), stfd::vec2(1, 1.5), stfd::vec2(1.5, 1)}}},
+        {box, stfd::holygon(stfd::polygon({stfd::vec2(4), stfd::vec2(5, 4), stfd::vec2(5)})), {}},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(clipping, tiled)
+{
+    std::vector<scaffolding::alg::clipping::tiled<double>> tests = {
+        {0, 16, 1},
+        {1, 64, 4},
+        {2, 500, 7},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(clipping, homogeneous)
+{
+    // the identity maps the cube [-1, 1]^3 to itself
+    stfd::mtx4 const identity = stfd::mtx4::identity();
+    depth_range_types const cube = depth_range_types::neg_one_to_one;
+
+    // camera with the eye at the origin that looks along the +y axis
+    stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                         stfd::constants::pi_halves);
+    stfd::mtx4 const view_proj = camera.perspective() * camera.view();
+    depth_range_types const depth = depth_range_types::zero_to_one;
+
+    std::vector<scaffolding::alg::clipping::homogeneous<double>> tests = {
+        // segments entirely inside the view volume
+        {identity, cube, stfd::segment3(stfd::vec3(-0.5, 0, 0), stfd::vec3(0.5, 0, 0)), true,
+         stfd::segment3(stfd::vec3(-0.5, 0, 0), stfd::vec3(0.5, 0, 0))},
+        {view_proj, depth, stfd::segment3(stfd::vec3(0, 2, 0), stfd::vec3(1, 50, 1)), true,
+         stfd::segment3(stfd::vec3(0, 2, 0), stfd::vec3(1, 50, 1))},
+        // segments that cross the boundary of the view volume
+        {identity, cube, stfd::segment3(stfd::vec3(-2, 0, 0), stfd::vec3(2, 0, 0)), true,
+         stfd::segment3(stfd::vec3(-1, 0, 0), stfd::vec3(1, 0, 0))},
+        {identity, cube, stfd::segment3(stfd::vec3(0), stfd::vec3(0, 0, 3)), true,
+         stfd::segment3(stfd::vec3(0), stfd::vec3(0, 0, 1))},
+        {identity, cube, stfd::segment3(stfd::vec3(1.5, 0, 0), stfd::vec3(0, 1.5, 0)), true,
+         stfd::segment3(stfd::vec3(1, 0.5, 0), stfd::vec3(0.5, 1, 0))},
+        {view_proj, depth, stfd::segment3(stfd::vec3(0, 50, 0), stfd::vec3(0, 150, 0)), true,
+         stfd::segment3(stfd::vec3(0, 50, 0), stfd::vec3(0, 100, 0))},
+        {view_proj, depth, stfd::segment3(stfd::vec3(-100, 10, 0), stfd::vec3(100, 10, 0)), true,
+         stfd::segment3(stfd::vec3(-10, 10, 0), stfd::vec3(10, 10, 0))},
+        // segments that cross the plane w = 0 (through the eye)
+        {view_proj, depth, stfd::segment3(stfd::vec3(0, -5, 0), stfd::vec3(0, 50, 0)), true,
+         stfd::segment3(stfd::vec3(0, 1, 0), stfd::vec3(0, 50, 0))},
+        // segments entirely outside the view volume
+        {identity, cube, stfd::segment3(stfd::vec3(2), stfd::vec3(3)), false, stfd::segment3()},
+        {identity, cube, stfd::segment3(stfd::vec3(2.5, 0, 0), stfd::vec3(0, 2.5, 0)), false, stfd::segment3()},
+        {view_proj, depth, stfd::segment3(stfd::vec3(0, -5, 0), stfd::vec3(0, -50, 0)), false, stfd::segment3()},
+        {view_proj, depth, stfd::segment3(stfd::vec3(-5, -5, 0), stfd::vec3(5, -5, 0)), false, stfd::segment3()},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(clipping, view_volume)
+{
+    // camera with the eye at (10, -20, 5) that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(10, -20, 5), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0,
+                         1.5, stfd::constants::pi_fourths);
+    // camera with the eye at the origin that looks along the -z axis with vec3(1, 1, 0) defining the up direction
+    stfd::scamera rotated(stfd::vec3(0), stfd::constants::pi_fourths, stfd::constants::pi, 0.5, 1000.0, 1.0,
+                          stfd::constants::pi_halves);
+
+    // perspective projection that maps depth to [-1, 1]
+    auto perspective = [](stfd::scamera const& cam)
+    {
+        stfd::mtx4 result = cam.perspective();
+        result[2][2] = (cam.farp + cam.nearp) / (cam.nearp - cam.farp);
+        result[2][3] = 2.0 * cam.farp * cam.nearp / (cam.nearp - cam.farp);
+        return result;
+    };
+
+    std::vector<scaffolding::alg::clipping::view_volume<double>> tests = {
+        {0, 50, 16, camera.perspective() * camera.view(), depth_range_types::zero_to_one},
+        {1, 50, 16, rotated.perspective() * rotated.view(), depth_range_types::zero_to_one},
+        {2, 200, 64, perspective(camera) * camera.view(), depth_range_types::neg_one_to_one},
+        {3, 200, 64, perspective(rotated) * rotated.view(), depth_range_types::neg_one_to_one},
+    };
+    scaffolding::verify(tests);
+}
+
 } // namespace stf::alg
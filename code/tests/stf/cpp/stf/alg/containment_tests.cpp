@@ -0,0 +1,55 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/containment.hpp>
+
+#include "stf/scaffolding/alg/containment.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(containment, classify)
+{
+    using enum containment_types;
+
+    {
+        stfd::polygon square({stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(0, 1)});
+        stfd::polygon triangle({stfd::vec2(0), stfd::vec2(1), stfd::vec2(2, 0)});
+        std::vector<stfd::vec2> points = {stfd::vec2(0.5), stfd::vec2(0), stfd::vec2(0.5, 1), stfd::vec2(-1, 0),
+                                          stfd::vec2(1), stfd::vec2(1, 0.5), stfd::vec2(0, 1), stfd::vec2(1.5, 0.25)};
+        std::vector<scaffolding::alg::containment::classify<double, stfd::polygon>> tests = {
+            {square, points, {inside, boundary, boundary, outside, boundary, boundary, boundary, outside}},
+            {triangle, points, {boundary, boundary, outside, outside, boundary, inside, outside, inside}},
+            {stfd::polygon(), points, {outside, outside, outside, outside, outside, outside, outside, outside}},
+            {square, {}, {}},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::polygon hull({stfd::vec2(0), stfd::vec2(4, 0), stfd::vec2(4), stfd::vec2(0, 4)});
+        stfd::polygon hole({stfd::vec2(1), stfd::vec2(1, 3), stfd::vec2(3), stfd::vec2(3, 1)});
+        stfd::holygon holygon(hull, {hole});
+        std::vector<stfd::vec2> points = {stfd::vec2(0.5), stfd::vec2(2), stfd::vec2(1, 2), stfd::vec2(4, 2),
+                                          stfd::vec2(5, 2), stfd::vec2(3.5, 2)};
+        std::vector<scaffolding::alg::containment::classify<double, stfd::holygon>> tests = {
+            {holygon, points, {inside, outside, boundary, boundary, outside, inside}},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(containment, classify_random)
+{
+    std::vector<scaffolding::alg::containment::random<double>> tests = {
+        {0, 16, 4, 1000, 1},
+        {1, 200, 12, 500, 1},
+        {2, 64, 30, 2000, 4},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/culling.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(culling, hierarchy)
+{
+    // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                         stfd::constants::pi_halves);
+    stfd::frustum frustum(camera);
+
+    // a root with four children. the last child has two children of its own
+    scaffolding::alg::culling::tree<double> tree;
+    tree.boxes = {
+        stfd::aabb3(stfd::vec3(-600), stfd::vec3(600)),    // 0: root
+        stfd::aabb3(stfd::vec3(-10, 50, -10), 20),         // 1: inside
+        stfd::aabb3(stfd::vec3(-10, 200, -10), 20),        // 2: outside the far plane
+        stfd::aabb3(stfd::vec3(-10, 90, -10), 20),         // 3: crosses the far plane
+        stfd::aabb3(stfd::vec3(-20, 10, -5), stfd::vec3(500, 30, 5)), // 4: crosses the right plane
+        stfd::aabb3(stfd::vec3(-5, 15, -2), 4),            // 5: inside
+        stfd::aabb3(stfd::vec3(400, 15, -2), 4),           // 6: outside the right plane
+    };
+    tree.kids = {{1, 2, 3, 4}, {}, {}, {}, {5, 6}, {}, {}};
+
+    std::vector<scaffolding::alg::culling::hierarchy<double>> tests = {
+        {frustum,
+         tree,
+         {
+             {1, intersection_types::inside},
+             {3, intersection_types::intersecting},
+             {5, intersection_types::inside},
+         },
+         {{2, 1}, {6, 3}}},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
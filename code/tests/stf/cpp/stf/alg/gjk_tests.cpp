@@ -0,0 +1,157 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/gjk.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(gjk, distance)
+{
+    {
+        std::vector<scaffolding::alg::gjk::distance<double, stfd::sphere, stfd::sphere>> tests = {
+            {stfd::sphere(stfd::vec3(0), 1), stfd::sphere(stfd::vec3(5, 0, 0), 2), false, 2},
+            {stfd::sphere(stfd::vec3(0), 1), stfd::sphere(stfd::vec3(1, 1, 1), 1), true, 0},
+            {stfd::sphere(stfd::vec3(1, 2, 3), 0.5), stfd::sphere(stfd::vec3(1, 2, -3), 0.5), false, 5},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::gjk::distance<double, stfd::aabb3, stfd::sphere>> tests = {
+            {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::sphere(stfd::vec3(3, 0.5, 0.5), 1), false, 1},
+            {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::sphere(stfd::vec3(2, 2, 0.5), 0.5), false,
+             std::sqrt(2.0) - 0.5},
+            {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::sphere(stfd::vec3(0.5), 0.1), true, 0},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::segment3 segment(stfd::vec3(0, 3, 0), stfd::vec3(10, 3, 0));
+        std::vector<scaffolding::alg::gjk::distance<double, capsule<double>, stfd::sphere>> tests = {
+            {{segment, 0.5}, stfd::sphere(stfd::vec3(0), 1), false, 1.5},
+            {{segment, 0.5}, stfd::sphere(stfd::vec3(5, 0, 0), 1), false, 1.5},
+            {{segment, 0.5}, stfd::sphere(stfd::vec3(12, 3, 0), 1), false, 0.5},
+            {{segment, 0.5}, stfd::sphere(stfd::vec3(5, 1, 0), 1.6), true, 0},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::triangle3 triangle(stfd::vec3(0), stfd::vec3(1, 0, 0), stfd::vec3(0, 1, 0));
+        std::vector<scaffolding::alg::gjk::distance<double, stfd::triangle3, stfd::segment3>> tests = {
+            {triangle, stfd::segment3(stfd::vec3(0.2, 0.2, 1), stfd::vec3(0.2, 0.2, 3)), false, 1},
+            {triangle, stfd::segment3(stfd::vec3(0.2, 0.2, -1), stfd::vec3(0.2, 0.2, 3)), true, 0},
+            {triangle, stfd::segment3(stfd::vec3(2, 2, -1), stfd::vec3(2, 2, 1)), false, 1.5 * std::sqrt(2.0)},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<stfd::vec3> const points = {stfd::vec3(0), stfd::vec3(1, 0, 0), stfd::vec3(0, 1, 0),
+                                                stfd::vec3(0, 0, 1)};
+        std::vector<scaffolding::alg::gjk::distance<double, convex_points<double>, stfd::sphere>> tests = {
+            {{points}, stfd::sphere(stfd::vec3(2, 0, 0), 0.5), false, 0.5},
+            {{points}, stfd::sphere(stfd::vec3(1), 0.1), false, (2.0 / std::sqrt(3.0)) - 0.1},
+            {{points}, stfd::sphere(stfd::vec3(0.2), 0.1), true, 0},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::cone cone(stfd::vec3(0), stfd::vec3(0, 0, 1), 2, stfd::constants::pi_fourths);
+        std::vector<scaffolding::alg::gjk::distance<double, stfd::cone, stfd::sphere>> tests = {
+            {cone, stfd::sphere(stfd::vec3(0, 0, -2), 1), false, 1},
+            {cone, stfd::sphere(stfd::vec3(0, 0, 4), 1), false, 1},
+            {cone, stfd::sphere(stfd::vec3(0, 0, 1), 0.1), true, 0},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+        stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                             stfd::constants::pi_halves);
+        stfd::frustum frustum(camera);
+        std::vector<scaffolding::alg::gjk::distance<double, stfd::frustum, stfd::aabb3>> tests = {
+            {frustum, stfd::aabb3(stfd::vec3(-5, -10, -5), stfd::vec3(5, -5, 5)), false, 6},
+            {frustum, stfd::aabb3(stfd::vec3(-5, 50, -5), stfd::vec3(5, 60, 5)), true, 0},
+            {frustum, stfd::aabb3(stfd::vec3(-5, 110, -5), stfd::vec3(5, 120, 5)), false, 10},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(gjk, penetration)
+{
+    {
+        std::vector<scaffolding::alg::gjk::penetration<double, stfd::sphere, stfd::sphere>> tests = {
+            {stfd::sphere(stfd::vec3(0), 1), stfd::sphere(stfd::vec3(1.5, 0, 0), 1), 0.5, stfd::vec3(1, 0, 0)},
+            {stfd::sphere(stfd::vec3(0, 0, 1), 1), stfd::sphere(stfd::vec3(0), 2), 2, stfd::vec3(0, 0, -1)},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::gjk::penetration<double, stfd::aabb3, stfd::aabb3>> tests = {
+            {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::aabb3(stfd::vec3(0.8, 0.5, 0.3), stfd::vec3(2)), 0.2,
+             stfd::vec3(1, 0, 0)},
+            {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::aabb3(stfd::vec3(-1, -1, -1), stfd::vec3(2, 2, 0.1)),
+             0.1, stfd::vec3(0, 0, -1)},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::gjk::penetration<double, stfd::aabb3, stfd::sphere>> tests = {
+            {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::sphere(stfd::vec3(0.5, 0.5, 1.2), 0.5), 0.3,
+             stfd::vec3(0, 0, 1)},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::segment3 segment(stfd::vec3(-2, 0.5, 1.1), stfd::vec3(2, 0.5, 1.1));
+        std::vector<scaffolding::alg::gjk::penetration<double, capsule<double>, stfd::aabb3>> tests = {
+            {{segment, 0.3}, stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), 0.2, stfd::vec3(0, 0, -1)},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(gjk, random_obbs)
+{
+    std::vector<scaffolding::alg::gjk::random_obbs<double>> tests = {
+        {0, 200},
+        {1, 200},
+        {2, 200},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(gjk, random_aabbs)
+{
+    std::vector<scaffolding::alg::gjk::random_aabbs<double>> tests = {
+        {0, 200},
+        {1, 200},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(gjk, warm_start)
+{
+    stfd::mtx3 rotation = math::rotate(math::normalized(stfd::vec3(1, 2, 3)), 0.7).prefix();
+    stfd::obb3 obb(stfd::vec3(0), rotation, stfd::vec3(1, 2, 3));
+    std::vector<scaffolding::alg::gjk::warm_start<double>> tests = {
+        {obb, stfd::sphere(stfd::vec3(-10, 1, 0), 1), stfd::vec3(0.1, 0, 0), 200},
+        {obb, stfd::sphere(stfd::vec3(0, -10, 0.5), 0.5), stfd::vec3(0, 0.05, 0.01), 400},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
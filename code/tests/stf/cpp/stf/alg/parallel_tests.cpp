@@ -0,0 +1,37 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/parallel.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(parallel, parallel_for)
+{
+    std::vector<scaffolding::alg::parallel::parallel_for> tests = {
+        {0, 4}, {1, 4}, {3, 4}, {10, 0}, {10, 1}, {10, 3}, {10, 4}, {1000, 7},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(parallel, parallel_sort)
+{
+    std::vector<scaffolding::alg::parallel::parallel_sort> tests = {
+        {0, 4}, {1, 4}, {3, 4}, {10, 1}, {10, 3}, {1000, 4}, {1000, 7}, {5000, 16},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(parallel, parallel_exclusive_scan)
+{
+    std::vector<scaffolding::alg::parallel::parallel_exclusive_scan> tests = {
+        {0, 4}, {1, 4}, {3, 4}, {10, 1}, {10, 3}, {1000, 7},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
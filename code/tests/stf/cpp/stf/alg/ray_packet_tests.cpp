@@ -0,0 +1,120 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/ray_packet.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(ray_packet, aabb)
+{
+    stff::aabb3 box(stff::vec3(0), 1.f);
+    std::vector<stff::ray3> rays = {
+        stff::ray3(stff::vec3(-1, 0.5, 0.5), stff::vec3(1, 0, 0)),
+        stff::ray3(stff::vec3(2, 0.5, 0.5), stff::vec3(-1, 0, 0)),
+        stff::ray3(stff::vec3(-1, 0.5, 0.5), stff::vec3(2, 0, 0)),
+        stff::ray3(stff::vec3(0.5, 0.5, 0.5), stff::vec3(1, 0, 0)),
+        stff::ray3(stff::vec3(-1, 0.5, 0.5), stff::vec3(-1, 0, 0)),
+        stff::ray3(stff::vec3(-1, 2, 0.5), stff::vec3(1, 0, 0)),
+        stff::ray3(stff::vec3(-1, 1, 1), stff::vec3(1, 0, 0)),
+        stff::ray3(stff::vec3(-1, -1, -1), stff::vec3(1, 1, 1)),
+    };
+    std::vector<stff::ray3> partial(rays.begin(), rays.begin() + 3);
+
+    std::vector<scaffolding::alg::ray_packet::aabb<float, 4>> tests4 = {
+        {{}, box},
+        {partial, box},
+        {std::vector<stff::ray3>(rays.begin(), rays.begin() + 4), box},
+        {std::vector<stff::ray3>(rays.begin() + 4, rays.end()), box},
+    };
+    scaffolding::verify(tests4);
+
+    std::vector<scaffolding::alg::ray_packet::aabb<float, 8>> tests8 = {
+        {partial, box},
+        {rays, box},
+    };
+    scaffolding::verify(tests8);
+}
+
+TEST(ray_packet, watertight)
+{
+    std::vector<scaffolding::alg::ray_packet::watertight<float, 4>> tests4 = {
+        {0, 200}, {1, 200},
+    };
+    scaffolding::verify(tests4);
+
+    std::vector<scaffolding::alg::ray_packet::watertight<float, 8>> tests8 = {
+        {2, 200}, {3, 200},
+    };
+    scaffolding::verify(tests8);
+
+    std::vector<scaffolding::alg::ray_packet::watertight<double, 4>> tests_double = {
+        {4, 200},
+    };
+    scaffolding::verify(tests_double);
+}
+
+TEST(ray_packet, mesh)
+{
+    // a bumpy 8x8 grid of quads (split into triangles) with a second flat grid below it
+    std::vector<stff::vec3> vertices;
+    std::vector<uint32_t> indices;
+    for (float z : {0.f, -3.f})
+    {
+        size_t const base = vertices.size();
+        for (int j = 0; j <= 8; ++j)
+        {
+            for (int i = 0; i <= 8; ++i)
+            {
+                float const height = (z == 0.f) ? 0.25f * static_cast<float>((i * 7 + j * 3) % 5) : z;
+                vertices.push_back(stff::vec3(static_cast<float>(i), static_cast<float>(j), height));
+            }
+        }
+        for (size_t j = 0; j < 8; ++j)
+        {
+            for (size_t i = 0; i < 8; ++i)
+            {
+                size_t const v = base + j * 9 + i;
+                for (size_t index : {v, v + 1, v + 10, v, v + 10, v + 9})
+                {
+                    indices.push_back(static_cast<uint32_t>(index));
+                }
+            }
+        }
+    }
+
+    // coherent rays from above, a few of which miss the grid
+    std::vector<stff::ray3> down;
+    std::vector<stff::ray3> up;
+    std::vector<stff::ray3> mixed;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        float const x = 0.37f + 1.13f * static_cast<float>(i);
+        float const y = 5.21f - 0.71f * static_cast<float>(i);
+        down.push_back(stff::ray3(stff::vec3(x, y, 10), stff::vec3(0.13f, -0.07f, -1)));
+        up.push_back(stff::ray3(stff::vec3(x, y, -1), stff::vec3(0, 0, 1)));
+        mixed.push_back(stff::ray3(stff::vec3(x, y, (i % 2 == 0) ? 10.f : -10.f), stff::vec3(0.3f, 0.1f, -1)));
+    }
+
+    std::vector<scaffolding::alg::ray_packet::mesh<float, 4>> tests4 = {
+        {down, {}, {}},
+        {std::vector<stff::ray3>(down.begin(), down.begin() + 4), vertices, indices},
+        {std::vector<stff::ray3>(down.begin() + 4, down.end()), vertices, indices},
+        {std::vector<stff::ray3>(up.begin(), up.begin() + 3), vertices, indices},
+        {std::vector<stff::ray3>(mixed.begin(), mixed.begin() + 4), vertices, indices},
+    };
+    scaffolding::verify(tests4);
+
+    std::vector<scaffolding::alg::ray_packet::mesh<float, 8>> tests8 = {
+        {down, vertices, indices},
+        {up, vertices, indices},
+        {mixed, vertices, indices},
+    };
+    scaffolding::verify(tests8);
+}
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/raycast.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(raycast, aabb)
+{
+    stff::aabb3 box(stff::vec3(0), 1.f);
+    std::vector<scaffolding::alg::raycast::cast<float, stff::aabb3>> tests = {
+        {stff::ray3(stff::vec3(-1, 0.5, 0.5), stff::vec3(1, 0, 0)), box, 1.f},
+        {stff::ray3(stff::vec3(2, 0.5, 0.5), stff::vec3(-1, 0, 0)), box, 1.f},
+        {stff::ray3(stff::vec3(-1, 0.5, 0.5), stff::vec3(2, 0, 0)), box, 0.5f},
+        {stff::ray3(stff::vec3(0.5, 0.5, 0.5), stff::vec3(1, 0, 0)), box, 0.f}, // origin inside
+        {stff::ray3(stff::vec3(-1, 0.5, 0.5), stff::vec3(-1, 0, 0)), box, std::nullopt}, // pointing away
+        {stff::ray3(stff::vec3(-1, 2, 0.5), stff::vec3(1, 0, 0)), box, std::nullopt},   // parallel miss
+        {stff::ray3(stff::vec3(-1, 0, 0), stff::vec3(1, 0, 0)), box, 1.f},             // along an edge
+        {stff::ray3(stff::vec3(-1, 1, 1), stff::vec3(1, 0, 0)), box, 1.f},             // along an edge
+        {stff::ray3(stff::vec3(-1, -1, 0.5), stff::vec3(1, 1, 0)), box, 1.f},          // through an edge
+        {stff::ray3(stff::vec3(-1, -1, -1), stff::vec3(1, 1, 1)), box, 1.f},           // through a vertex
+        {stff::ray3(stff::vec3(-1, -0.5, 0.5), stff::vec3(1, 1, 0)), box, 1.f},
+        {stff::ray3(stff::vec3(-1, 1.5, 0.5), stff::vec3(1, 1, 0)), box, std::nullopt},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(raycast, triangle)
+{
+    stff::vec3 a(0, 0, 0);
+    stff::vec3 b(1, 0, 0);
+    stff::vec3 c(0, 1, 0);
+    std::vector<scaffolding::alg::raycast::triangle<float>> tests = {
+        {stff::ray3(stff::vec3(0.25, 0.25, 1), stff::vec3(0, 0, -1)), a, b, c, 1.f},
+        {stff::ray3(stff::vec3(0.25, 0.25, -1), stff::vec3(0, 0, 1)), a, b, c, 1.f},   // back face
+        {stff::ray3(stff::vec3(0.25, 0.25, 2), stff::vec3(0, 0, -4)), a, b, c, 0.5f},
+        {stff::ray3(stff::vec3(0.25, 0.25, 1), stff::vec3(0, 0, 1)), a, b, c, std::nullopt}, // pointing away
+        {stff::ray3(stff::vec3(1, 1, 1), stff::vec3(0, 0, -1)), a, b, c, std::nullopt},
+        {stff::ray3(stff::vec3(0, 0, 1), stff::vec3(0, 0, -1)), a, b, c, 1.f},         // through a vertex
+        {stff::ray3(stff::vec3(0.5, 0, 1), stff::vec3(0, 0, -1)), a, b, c, 1.f},       // through an edge
+        {stff::ray3(stff::vec3(0.5, 0.5, 1), stff::vec3(0, 0, -1)), a, b, c, 1.f},     // through the hypotenuse
+        {stff::ray3(stff::vec3(-1, 0.25, 0.25), stff::vec3(1, 0, -0.25)), a, b, c, 1.f},
+        {stff::ray3(stff::vec3(-1, 0.25, 0), stff::vec3(1, 0, 0)), a, b, c, std::nullopt}, // coplanar
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(raycast, obb)
+{
+    stff::obb3 box(stff::vec3(0), stf::math::rotate(stff::vec3(0, 0, 1), stff::constants::pi_fourths).prefix(),
+                   stff::vec3(1, 1, 1));
+    float const diagonal = std::sqrt(2.f);
+    std::vector<scaffolding::alg::raycast::cast<float, stff::obb3>> tests = {
+        {stff::ray3(stff::vec3(-5, 0, 0), stff::vec3(1, 0, 0)), box, 5.f - diagonal},
+        {stff::ray3(stff::vec3(0, -5, 0.5), stff::vec3(0, 1, 0)), box, 5.f - diagonal},
+        {stff::ray3(stff::vec3(0, 0, 5), stff::vec3(0, 0, -1)), box, 4.f},
+        {stff::ray3(stff::vec3(0, 0, 0), stff::vec3(0, 0, -1)), box, 0.f},
+        {stff::ray3(stff::vec3(-5, 1.5, 0), stff::vec3(1, 0, 0)), box, std::nullopt},
+        {stff::ray3(stff::vec3(-5, 0, 0), stff::vec3(-1, 0, 0)), box, std::nullopt},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(raycast, sphere)
+{
+    stff::sphere sphere(stff::vec3(0, 0, 0), 1.f);
+    std::vector<scaffolding::alg::raycast::cast<float, stff::sphere>> tests = {
+        {stff::ray3(stff::vec3(-5, 0, 0), stff::vec3(1, 0, 0)), sphere, 4.f},
+        {stff::ray3(stff::vec3(-5, 0, 0), stff::vec3(2, 0, 0)), sphere, 2.f},
+        {stff::ray3(stff::vec3(-5, 1, 0), stff::vec3(1, 0, 0)), sphere, 5.f}, // tangent
+        {stff::ray3(stff::vec3(0.5, 0, 0), stff::vec3(1, 0, 0)), sphere, 0.f}, // origin inside
+        {stff::ray3(stff::vec3(-5, 0, 0), stff::vec3(-1, 0, 0)), sphere, std::nullopt},
+        {stff::ray3(stff::vec3(-5, 1.5, 0), stff::vec3(1, 0, 0)), sphere, std::nullopt},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(raycast, plane)
+{
+    stff::plane plane(stff::vec3(0, 0, 1), stff::vec3(0, 0, 1));
+    std::vector<scaffolding::alg::raycast::cast<float, stff::plane>> tests = {
+        {stff::ray3(stff::vec3(0, 0, 5), stff::vec3(0, 0, -1)), plane, 4.f},
+        {stff::ray3(stff::vec3(0, 0, 5), stff::vec3(1, 1, -2)), plane, 2.f},
+        {stff::ray3(stff::vec3(0, 0, -3), stff::vec3(0, 0, 1)), plane, 4.f},         // from below
+        {stff::ray3(stff::vec3(3, 4, 1), stff::vec3(1, 0, 0)), plane, 0.f},          // origin on the plane
+        {stff::ray3(stff::vec3(0, 0, 5), stff::vec3(0, 0, 1)), plane, std::nullopt}, // pointing away
+        {stff::ray3(stff::vec3(0, 0, 5), stff::vec3(1, 0, 0)), plane, std::nullopt}, // parallel
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(raycast, batch)
+{
+    {
+        std::vector<scaffolding::alg::raycast::batch<float, stff::plane>> tests = {
+            {1, 1000, stff::plane(stff::vec3(0), stff::vec3(0, 0, 1)), stff::constants::pos_inf},
+            {2, 1000, stff::plane(stff::vec3(1, 2, 0), stff::vec3(1, 1, 0)), 2.f},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::raycast::batch<float, stff::sphere>> tests = {
+            {3, 1000, stff::sphere(stff::vec3(0), 1.f), stff::constants::pos_inf},
+            {4, 1000, stff::sphere(stff::vec3(1, 0, -1), 2.f), 1.f},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::raycast::batch<double, stfd::aabb3>> tests = {
+            {5, 1000, stfd::aabb3(stfd::vec3(-1), stfd::vec3(1)), stfd::constants::pos_inf},
+            {6, 1000, stfd::aabb3(stfd::vec3(0, -2, -1), stfd::vec3(2, 2, 0.5)), 1.0},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(raycast, mesh)
+{
+    // two 4x4 grids of quads (split into triangles) at z = 0 and z = -2
+    std::vector<stff::vec3> vertices;
+    std::vector<uint32_t> indices;
+    for (float z : {0.f, -2.f})
+    {
+        size_t const base = vertices.size();
+        for (int j = 0; j <= 4; ++j)
+        {
+            for (int i = 0; i <= 4; ++i)
+            {
+                vertices.push_back(stff::vec3(static_cast<float>(i), static_cast<float>(j), z));
+            }
+        }
+        for (size_t j = 0; j < 4; ++j)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                size_t const v = base + j * 5 + i;
+                for (size_t index : {v, v + 1, v + 6, v, v + 6, v + 5})
+                {
+                    indices.push_back(static_cast<uint32_t>(index));
+                }
+            }
+        }
+    }
+
+    std::vector<scaffolding::alg::raycast::mesh<float>> tests = {
+        {{}, {}, stff::ray3(stff::vec3(0.5, 0.5, 5), stff::vec3(0, 0, -1)), std::nullopt},
+        {vertices, indices, stff::ray3(stff::vec3(0.7, 0.2, 5), stff::vec3(0, 0, -1)), 5.f},
+        {vertices, indices, stff::ray3(stff::vec3(0.7, 0.2, -5), stff::vec3(0, 0, 1)), 3.f},
+        {vertices, indices, stff::ray3(stff::vec3(2.3, 3.6, -1), stff::vec3(0, 0, -1)), 1.f},
+        {vertices, indices, stff::ray3(stff::vec3(1, 1, 5), stff::vec3(0, 0, -1)), 5.f},      // shared vertex
+        {vertices, indices, stff::ray3(stff::vec3(2, 1.5, 5), stff::vec3(0, 0, -1)), 5.f},    // shared edge
+        {vertices, indices, stff::ray3(stff::vec3(2.5, 2.5, 5), stff::vec3(0, 0, -1)), 5.f},  // shared diagonal
+        {vertices, indices, stff::ray3(stff::vec3(-1, -1, 1), stff::vec3(1, 1, -1)), 1.f},    // corner of the grid
+        {vertices, indices, stff::ray3(stff::vec3(10, 10, 5), stff::vec3(0, 0, -1)), std::nullopt},
+        {vertices, indices, stff::ray3(stff::vec3(0.5, 0.5, 5), stff::vec3(0, 0, 1)), std::nullopt},
+        {vertices, indices, stff::ray3(stff::vec3(0, 0, 5), stff::vec3(1, 1, -1)), std::nullopt},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
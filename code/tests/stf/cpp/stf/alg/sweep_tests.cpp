@@ -0,0 +1,155 @@
+#include <cmath>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/alg/sweep.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::alg
+{
+
+TEST(sweep, sphere_plane)
+{
+    stfd::plane plane(stfd::vec3(0), stfd::vec3(0, 0, 1));
+    std::vector<scaffolding::alg::sweep::impact<double, stfd::sphere, stfd::plane>> tests = {
+        {stfd::sphere(stfd::vec3(0, 0, 5), 1), stfd::vec3(0, 0, -8), plane, 0.5},
+        {stfd::sphere(stfd::vec3(0, 0, -5), 1), stfd::vec3(3, 0, 8), plane, 0.5},
+        {stfd::sphere(stfd::vec3(0, 0, 5), 1), stfd::vec3(0, 0, -2), plane, std::nullopt},
+        {stfd::sphere(stfd::vec3(0, 0, 5), 1), stfd::vec3(0, 0, 8), plane, std::nullopt},
+        {stfd::sphere(stfd::vec3(0, 0, 5), 1), stfd::vec3(8, 0, 0), plane, std::nullopt},
+        {stfd::sphere(stfd::vec3(0, 0, 0.5), 1), stfd::vec3(0, 0, 8), plane, 0},
+        // a fast sphere that tunnels through the plane between discrete checks
+        {stfd::sphere(stfd::vec3(0, 0, 2), 0.1), stfd::vec3(0, 0, -4), plane, 0.475},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep, sphere_sphere)
+{
+    std::vector<scaffolding::alg::sweep::impact<double, stfd::sphere, stfd::sphere>> tests = {
+        {stfd::sphere(stfd::vec3(-5, 0, 0), 1), stfd::vec3(10, 0, 0), stfd::sphere(stfd::vec3(0), 1), 0.3},
+        {stfd::sphere(stfd::vec3(-5, 3, 0), 1), stfd::vec3(10, 0, 0), stfd::sphere(stfd::vec3(0), 1), std::nullopt},
+        {stfd::sphere(stfd::vec3(-5, 0, 0), 1), stfd::vec3(2, 0, 0), stfd::sphere(stfd::vec3(0), 1), std::nullopt},
+        {stfd::sphere(stfd::vec3(0.5, 0, 0), 1), stfd::vec3(2, 0, 0), stfd::sphere(stfd::vec3(0), 1), 0},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep, sphere_aabb)
+{
+    stfd::aabb3 box(stfd::vec3(0), stfd::vec3(1));
+    std::vector<scaffolding::alg::sweep::impact<double, stfd::sphere, stfd::aabb3>> tests = {
+        // faces
+        {stfd::sphere(stfd::vec3(-2, 0.5, 0.5), 0.5), stfd::vec3(4, 0, 0), box, 0.375},
+        {stfd::sphere(stfd::vec3(0.5, 0.5, 3), 0.5), stfd::vec3(0, 0, -10), box, 0.15},
+        {stfd::sphere(stfd::vec3(-2, 0.5, 0.5), 0.5), stfd::vec3(1, 0, 0), box, std::nullopt},
+        // edges
+        {stfd::sphere(stfd::vec3(-2, -0.25, 0.5), 0.5), stfd::vec3(4, 0, 0), box, (2 - std::sqrt(0.1875)) / 4},
+        {stfd::sphere(stfd::vec3(-2, -0.6, 0.5), 0.5), stfd::vec3(4, 0, 0), box, std::nullopt},
+        // corners
+        {stfd::sphere(stfd::vec3(-3), 0.5), stfd::vec3(4), box, 0.75 - 0.5 / (4 * std::sqrt(3.0))},
+        {stfd::sphere(stfd::vec3(-2, -0.45, -0.45), 0.5), stfd::vec3(4, 0, 0), box, std::nullopt},
+        // already overlapping
+        {stfd::sphere(stfd::vec3(1.2, 0.5, 0.5), 0.5), stfd::vec3(4, 0, 0), box, 0},
+        {stfd::sphere(stfd::vec3(1.2, 1.2, 0.5), 0.5), stfd::vec3(0), box, 0},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep, sphere_triangle)
+{
+    stfd::triangle3 triangle(stfd::vec3(0), stfd::vec3(2, 0, 0), stfd::vec3(0, 2, 0));
+    std::vector<scaffolding::alg::sweep::impact<double, stfd::sphere, stfd::triangle3>> tests = {
+        // face
+        {stfd::sphere(stfd::vec3(0.5, 0.5, 3), 1), stfd::vec3(0, 0, -4), triangle, 0.5},
+        {stfd::sphere(stfd::vec3(0.5, 0.5, -3), 1), stfd::vec3(0, 0, 4), triangle, 0.5},
+        // edge
+        {stfd::sphere(stfd::vec3(1, -0.3, 3), 0.5), stfd::vec3(0, 0, -6), triangle, 2.6 / 6},
+        {stfd::sphere(stfd::vec3(3, 3, 0), 0.5), stfd::vec3(-2, -2, 0), triangle, 1 - std::sqrt(2.0) / 8},
+        // vertex
+        {stfd::sphere(stfd::vec3(-3, -3, 0), 1), stfd::vec3(6, 6, 0), triangle, 0.5 - 1 / std::sqrt(72.0)},
+        // misses
+        {stfd::sphere(stfd::vec3(3, 3, 3), 1), stfd::vec3(0, 0, -6), triangle, std::nullopt},
+        {stfd::sphere(stfd::vec3(0.5, 0.5, 3), 1), stfd::vec3(5, 0, 0), triangle, std::nullopt},
+        // closer to the plane than the radius but beside the triangle and moving away
+        {stfd::sphere(stfd::vec3(2.5, 0.2, 0.5), 1), stfd::vec3(4, 0, -1),
+         stfd::triangle3(stfd::vec3(0), stfd::vec3(1, 0, 0), stfd::vec3(0, 1, 0)), std::nullopt},
+        // already overlapping
+        {stfd::sphere(stfd::vec3(0.5, 0.5, 0.5), 1), stfd::vec3(5, 0, 0), triangle, 0},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep, aabb_aabb)
+{
+    stfd::aabb3 box(stfd::vec3(0), stfd::vec3(1));
+    std::vector<scaffolding::alg::sweep::impact<double, stfd::aabb3, stfd::aabb3>> tests = {
+        {stfd::aabb3(stfd::vec3(-3, 0, 0), stfd::vec3(-2, 1, 1)), stfd::vec3(4, 0, 0), box, 0.5},
+        {stfd::aabb3(stfd::vec3(-3, 2, 0), stfd::vec3(-2, 3, 1)), stfd::vec3(4, -2, 0), box, 0.5},
+        {stfd::aabb3(stfd::vec3(-3, 2, 0), stfd::vec3(-2, 3, 1)), stfd::vec3(4, 0, 0), box, std::nullopt},
+        {stfd::aabb3(stfd::vec3(-3, 0, 0), stfd::vec3(-2, 1, 1)), stfd::vec3(-4, 0, 0), box, std::nullopt},
+        {stfd::aabb3(stfd::vec3(-3, 0, 0), stfd::vec3(-2, 1, 1)), stfd::vec3(1, 0, 0), box, std::nullopt},
+        {stfd::aabb3(stfd::vec3(0.5), stfd::vec3(2)), stfd::vec3(4, 0, 0), box, 0},
+        // a thin box that a fast box passes through within a single frame
+        {stfd::aabb3(stfd::vec3(-10, 0, 0), stfd::vec3(-9, 1, 1)), stfd::vec3(20, 0, 0),
+         stfd::aabb3(stfd::vec3(0), stfd::vec3(0.01, 1, 1)), 0.45},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep, random)
+{
+    {
+        std::vector<scaffolding::alg::sweep::random<double, stfd::sphere, stfd::sphere>> tests = {{0, 100}, {1, 100}};
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::sweep::random<double, stfd::sphere, stfd::aabb3>> tests = {{0, 100}, {1, 100}};
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::sweep::random<double, stfd::sphere, stfd::triangle3>> tests = {
+            {0, 100},
+            {1, 100},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::sweep::random<double, stfd::aabb3, stfd::aabb3>> tests = {{0, 100}, {1, 100}};
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(sweep, batch)
+{
+    {
+        std::vector<scaffolding::alg::sweep::batch<double, stfd::sphere>> tests = {
+            {
+                {stfd::sphere(stfd::vec3(0), 1), stfd::sphere(stfd::vec3(5, 0, 0), 1),
+                 stfd::sphere(stfd::vec3(0, 5, 0), 0.5), stfd::sphere(stfd::vec3(1.5, 0, 0), 1)},
+                {stfd::vec3(2, 0, 0), stfd::vec3(-2, 0, 0), stfd::vec3(0, 0, 3), stfd::vec3(0)},
+            },
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        std::vector<scaffolding::alg::sweep::batch<double, stfd::aabb3>> tests = {
+            {
+                {stfd::aabb3(stfd::vec3(0), stfd::vec3(1)), stfd::aabb3(stfd::vec3(3, 0, 0), stfd::vec3(4, 1, 1)),
+                 stfd::aabb3(stfd::vec3(0, 3, 0), stfd::vec3(1, 4, 1)), stfd::aabb3(stfd::vec3(0.5), stfd::vec3(2))},
+                {stfd::vec3(1, 0, 0), stfd::vec3(-1, 0, 0), stfd::vec3(0, -3, 0), stfd::vec3(0, 0, 5)},
+            },
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+} // namespace stf::alg
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/tiling.hpp>
+
+#include "stf/scaffolding/alg/tiling.hpp"
+
+namespace stf::alg
+{
+
+TEST(tiling, polygons)
+{
+    tile_grid<double> const grid{stfd::vec2(0), stfd::vec2(1), 0, 2, 2};
+    tile_grid<double> const buffered{stfd::vec2(0), stfd::vec2(1), 0.25, 2, 2};
+    stfd::polygon const square({stfd::vec2(0.5), stfd::vec2(1.5, 0.5), stfd::vec2(1.5), stfd::vec2(0.5, 1.5)});
+    stfd::polygon const triangle({stfd::vec2(0), stfd::vec2(2, 0), stfd::vec2(0, 2)});
+    stfd::polygon const outside({stfd::vec2(3), stfd::vec2(4, 3), stfd::vec2(4)});
+    std::vector<scaffolding::alg::tiling::polygons<double>> tests = {
+        {grid, {}, {{}, {}, {}, {}}},
+        {grid, {outside}, {{}, {}, {}, {}}},
+        {grid, {square}, {{0.25}, {0.25}, {0.25}, {0.25}}},
+        {grid, {square, outside, triangle}, {{0.25, 1}, {0.25, 0.5}, {0.25, 0.5}, {0.25}}},
+        {buffered, {square}, {{0.5625}, {0.5625}, {0.5625}, {0.5625}}},
+        {buffered, {triangle}, {{1.4375}, {0.78125}, {0.78125}, {0.125}}},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(tiling, random)
+{
+    std::vector<scaffolding::alg::tiling::random<double>> tests = {
+        {0, 1, 16, 1, 1, 0, 1},
+        {1, 10, 8, 4, 4, 0, 2},
+        {2, 50, 32, 5, 3, 0.2, 4},
+        {3, 100, 64, 8, 8, 0.1, 8},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::alg
\ No newline at end of file
@@ -33,6 +33,33 @@ TEST(frustum, contains)
     scaffolding::verify(tests);
 }
 
+TEST(frustum, from_matrix)
+{
+    // camera with the eye at (10, -20, 5) that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(10, -20, 5), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0,
+                         1.5, stfd::constants::pi_fourths);
+    // camera with the eye at the origin that looks along the -z axis with vec3(1, 1, 0) defining the up direction
+    stfd::scamera rotated(stfd::vec3(0), stfd::constants::pi_fourths, stfd::constants::pi, 0.5, 1000.0, 1.0,
+                          stfd::constants::pi_halves);
+
+    // perspective projection that maps depth to [-1, 1]
+    auto perspective = [](stfd::scamera const& cam)
+    {
+        stfd::mtx4 result = cam.perspective();
+        result[2][2] = (cam.farp + cam.nearp) / (cam.nearp - cam.farp);
+        result[2][3] = 2.0 * cam.farp * cam.nearp / (cam.nearp - cam.farp);
+        return result;
+    };
+
+    std::vector<scaffolding::cam::frustum::from_matrix<double>> tests = {
+        {camera, camera.perspective() * camera.view(), depth_range_types::zero_to_one},
+        {rotated, rotated.perspective() * rotated.view(), depth_range_types::zero_to_one},
+        {camera, perspective(camera) * camera.view(), depth_range_types::neg_one_to_one},
+        {rotated, perspective(rotated) * rotated.view(), depth_range_types::neg_one_to_one},
+    };
+    scaffolding::verify(tests);
+}
+
 TEST(frustum, intersects_fast)
 {
     // true intersections
@@ -71,6 +98,74 @@ TEST(frustum, intersects_fast)
     }
 }
 
+TEST(frustum, sphere)
+{
+    // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                         stfd::constants::pi_halves);
+    stfd::frustum frustum(camera);
+
+    std::vector<scaffolding::cam::frustum::sphere<double>> tests = {
+        {frustum, stfd::sphere(stfd::vec3(0, 50, 0), 10), true, true, true},
+        {frustum, stfd::sphere(stfd::vec3(0, 50, 0), 60), false, true, true},     // crosses every plane
+        {frustum, stfd::sphere(stfd::vec3(0, -10, 0), 5), false, false, false},   // behind the near plane
+        {frustum, stfd::sphere(stfd::vec3(0, -10, 0), 12), false, true, true},    // crosses the near plane
+        {frustum, stfd::sphere(stfd::vec3(0, 150, 0), 49), false, false, false},  // beyond the far plane
+        {frustum, stfd::sphere(stfd::vec3(80, 50, 0), 40), false, true, true},    // crosses the right plane
+        {frustum, stfd::sphere(stfd::vec3(140, 50, 0), 40), false, false, false}, // outside the right plane
+        // beyond the far top right corner but not excluded by any single plane
+        {frustum, stfd::sphere(stfd::vec3(115, 115, 115), 20), false, true, false},
+        // beyond the far right edge but not excluded by any single plane
+        {frustum, stfd::sphere(stfd::vec3(115, 115, 0), 15), false, true, false},
+        {frustum, stfd::sphere(stfd::vec3(115, 115, 0), 22), false, true, true},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(frustum, cone)
+{
+    // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                         stfd::constants::pi_halves);
+    stfd::frustum frustum(camera);
+
+    std::vector<scaffolding::cam::frustum::cone<double>> tests = {
+        {frustum, stfd::cone(stfd::vec3(0, 50, 0), stfd::vec3(0, 1, 0), 10, 0.3), true},     // inside
+        {frustum, stfd::cone(stfd::vec3(0, -10, 0), stfd::vec3(0, -1, 0), 5, 0.5), false},   // behind the eye
+        {frustum, stfd::cone(stfd::vec3(0, -10, 0), stfd::vec3(0, 1, 0), 20, 0.5), true},    // crosses the near plane
+        {frustum, stfd::cone(stfd::vec3(200, 50, 0), stfd::vec3(-1, 0, 0), 50, 0.3), false}, // outside the right plane
+        {frustum, stfd::cone(stfd::vec3(200, 50, 0), stfd::vec3(-1, 0, 0), 200, 0.3), true}, // crosses the right plane
+        // the apex is outside the right plane but the base is wide enough to cross it
+        {frustum, stfd::cone(stfd::vec3(200, 50, 0), stfd::vec3(0, 0, 1), 100, 1.2), true},
+        {frustum, stfd::cone(stfd::vec3(200, 50, 0), stfd::vec3(0, 0, 1), 100, 0.5), false},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(frustum, classify)
+{
+    // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                         stfd::constants::pi_halves);
+    stfd::frustum frustum(camera);
+
+    uint32_t all = stfd::frustum::c_all_planes;
+    uint32_t near_far = 0x3; // only the near and far planes
+    std::vector<scaffolding::cam::frustum::classify<double>> tests = {
+        {frustum, stfd::aabb3(stfd::vec3(-10, 50, -10), 20), all, intersection_types::inside, 0x0, 0},
+        {frustum, stfd::aabb3(stfd::vec3(-10, 90, -10), 20), all, intersection_types::intersecting, 0x2, 0},
+        {frustum, stfd::aabb3(stfd::vec3(-1, 0, -1), 2), all, intersection_types::intersecting, 0x3D, 0},
+        {frustum, stfd::aabb3(stfd::vec3(-10, -30, -10), 20), all, intersection_types::outside, 0x0, 0},
+        {frustum, stfd::aabb3(stfd::vec3(-10, 200, -10), 20), all, intersection_types::outside, 0x0, 1},
+        {frustum, stfd::aabb3(stfd::vec3(500, 10, -5), 10), all, intersection_types::outside, 0x0, 3},
+        {frustum, stfd::aabb3(stfd::vec3(-5, 10, 500), 10), all, intersection_types::outside, 0x0, 4},
+        // planes that are not in the mask are not tested
+        {frustum, stfd::aabb3(stfd::vec3(500, 10, -5), 10), near_far, intersection_types::inside, 0x0, 0},
+        {frustum, stfd::aabb3(stfd::vec3(-10, 200, -10), 20), near_far, intersection_types::outside, 0x0, 1},
+    };
+    scaffolding::verify(tests);
+}
+
 TEST(frustum, intersects)
 {
     {
@@ -0,0 +1,63 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/cam/occlusion.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::cam
+{
+
+TEST(occlusion_buffer, occluded)
+{
+    // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+    stff::scamera camera(stff::vec3(0), stff::constants::pi_halves, stff::constants::pi_halves, 1.f, 100.f, 4.f / 3.f,
+                         stff::constants::pi_halves);
+
+    // a wall at y = 20 that covers the entire view
+    std::vector<stff::vec3> wall = {
+        stff::vec3(-50, 20, -50),
+        stff::vec3(50, 20, -50),
+        stff::vec3(50, 20, 50),
+        stff::vec3(-50, 20, 50),
+    };
+
+    // a small square at y = 20
+    std::vector<stff::vec3> square = {
+        stff::vec3(-5, 20, -5),
+        stff::vec3(5, 20, -5),
+        stff::vec3(5, 20, 5),
+        stff::vec3(-5, 20, 5),
+    };
+
+    // a square that crosses the near plane
+    std::vector<stff::vec3> crossing = {
+        stff::vec3(-50, -10, -50),
+        stff::vec3(50, -10, -50),
+        stff::vec3(50, 50, 50),
+        stff::vec3(-50, 50, 50),
+    };
+
+    std::vector<uint32_t> quad = {0, 1, 2, 0, 2, 3};
+    std::vector<uint32_t> reversed = {0, 2, 1, 0, 3, 2};
+
+    std::vector<scaffolding::cam::occlusion::occluded<float>> tests = {
+        {camera, {}, {}, stff::aabb3(stff::vec3(-2, 50, -2), 4), false},
+        {camera, wall, quad, stff::aabb3(stff::vec3(-2, 50, -2), 4), true},
+        {camera, wall, reversed, stff::aabb3(stff::vec3(-2, 50, -2), 4), true},              // winding doesn't matter
+        {camera, wall, quad, stff::aabb3(stff::vec3(-40, 50, -30), 60), true},               // large box
+        {camera, wall, quad, stff::aabb3(stff::vec3(-2, 10, -2), 4), false},                 // in front of the wall
+        {camera, wall, quad, stff::aabb3(stff::vec3(-2, 15, -2), stff::vec3(2, 25, 2)), false}, // crosses the wall
+        {camera, wall, quad, stff::aabb3(stff::vec3(-2, -10, -2), stff::vec3(2, 60, 2)), false}, // crosses near plane
+        {camera, wall, quad, stff::aabb3(stff::vec3(-2, -10, -2), 4), false},                // behind the camera
+        {camera, square, quad, stff::aabb3(stff::vec3(-2, 50, -2), 4), true},
+        {camera, square, quad, stff::aabb3(stff::vec3(-20, 50, -2), stff::vec3(20, 54, 2)), false}, // wider than square
+        {camera, square, quad, stff::aabb3(stff::vec3(-2, 50, 20), 4), false},               // above the square
+        {camera, crossing, quad, stff::aabb3(stff::vec3(-2, 50, -2), 4), false},             // occluder is skipped
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::cam
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/cam/prepared_frustum.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::cam
+{
+
+TEST(prepared_frustum, intersects)
+{
+    {
+        // camera with the eye at the origin that looks along the +y axis with the +z axis is the up vector
+        stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0, 1.0,
+                             stfd::constants::pi_halves);
+        stfd::frustum frustum(camera);
+
+        stfd::mtx3 rotation = math::rotate(math::normalized(stfd::vec3(1, 1, 1)), stfd::constants::pi_fourths).prefix();
+        std::vector<scaffolding::cam::prepared_frustum::intersects<double>> tests = {
+            {frustum, stfd::obb3(stfd::aabb3(stfd::vec3(-10, 50, -10), 20)), true},
+            {frustum, stfd::obb3(stfd::aabb3(stfd::vec3(-10, 90, -10), 20)), true},   // crosses the far plane
+            {frustum, stfd::obb3(stfd::aabb3(stfd::vec3(-1, 0, -1), 2)), true},       // crosses the near plane
+            {frustum, stfd::obb3(stfd::aabb3(stfd::vec3(110, 90, -50), 100)), false}, // entirely outside the frustum
+            // rotated boxes
+            {frustum, stfd::obb3(stfd::vec3(0, 50, 0), rotation, stfd::vec3(5)), true},   // inside the frustum
+            {frustum, stfd::obb3(stfd::vec3(0, 200, 0), rotation, stfd::vec3(5)), false}, // beyond the far plane
+            {frustum, stfd::obb3(stfd::vec3(0, -10, 0), rotation, stfd::vec3(5)), false}, // behind the eye
+            {frustum, stfd::obb3(stfd::vec3(-55, 50, 0), rotation, stfd::vec3(8)), true}, // crosses the left plane
+        };
+        scaffolding::verify(tests);
+    }
+
+    // a false positive of frustum::intersects_fast that is separated by the cross product of two edges
+    {
+        // camera with the eye at the origin that looks along the -z axis with vec3(1, 1, 0) defining the up direction
+        stfd::scamera camera(stfd::vec3(0), stfd::constants::pi_fourths, stfd::constants::pi, 1.0, 100.0, 1.0,
+                             stfd::constants::pi_halves);
+        stfd::frustum frustum(camera);
+
+        std::vector<scaffolding::cam::prepared_frustum::intersects<double>> tests = {
+            {frustum, stfd::obb3(stfd::aabb3(stfd::vec3(-500, 50, -10), stfd::vec3(500, 550, 10))), false},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(prepared_frustum, cull)
+{
+    // camera with the eye at (10, -20, 5) that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(10, -20, 5), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0,
+                         1.5, stfd::constants::pi_fourths);
+    stfd::frustum frustum(camera);
+
+    // a grid of rotated boxes, some of which intersect the frustum
+    std::vector<stfd::obb3> boxes;
+    for (int i = -5; i <= 5; ++i)
+    {
+        for (int j = -2; j <= 10; ++j)
+        {
+            for (int k = -3; k <= 3; ++k)
+            {
+                double const theta = 0.1 * static_cast<double>(i + j + k);
+                stfd::mtx3 rotation = math::rotate(math::normalized(stfd::vec3(i, j, k + 0.5)), theta).prefix();
+                stfd::vec3 center(15.0 * i, 12.0 * j, 15.0 * k);
+                boxes.push_back(stfd::obb3(center, rotation, stfd::vec3(1.0 + (i & 3), 2.0, 1.0 + (k & 1))));
+            }
+        }
+    }
+
+    std::vector<scaffolding::cam::prepared_frustum::cull<double>> tests = {
+        {frustum, {}},
+        {frustum, boxes},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(prepared_frustum, cull_spheres)
+{
+    // camera with the eye at (10, -20, 5) that looks along the +y axis with the +z axis is the up vector
+    stfd::scamera camera(stfd::vec3(10, -20, 5), stfd::constants::pi_halves, stfd::constants::pi_halves, 1.0, 100.0,
+                         1.5, stfd::constants::pi_fourths);
+    stfd::frustum frustum(camera);
+
+    // a grid of spheres, some of which intersect the frustum
+    std::vector<stfd::sphere> spheres;
+    for (int i = -5; i <= 5; ++i)
+    {
+        for (int j = -2; j <= 10; ++j)
+        {
+            for (int k = -3; k <= 3; ++k)
+            {
+                spheres.push_back(stfd::sphere(stfd::vec3(15.0 * i, 12.0 * j, 15.0 * k), 1.0 + ((i + j + k) & 7)));
+            }
+        }
+    }
+
+    std::vector<scaffolding::cam::prepared_frustum::cull_spheres<double>> tests = {
+        {frustum, {}},
+        {frustum, spheres},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::cam
\ No newline at end of file
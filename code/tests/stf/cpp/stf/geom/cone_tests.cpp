@@ -0,0 +1,46 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/cone.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+TEST(cone, contains)
+{
+    // cone with the apex at the origin that opens along the +z axis with a base of radius 1 at z = 1
+    stfd::cone cone(stfd::vec3(0), stfd::vec3(0, 0, 1), 1, stfd::constants::pi_fourths);
+
+    std::vector<scaffolding::geom::cone::contains<double>> tests = {
+        {cone, stfd::vec3(0), true},
+        {cone, stfd::vec3(0, 0, 0.5), true},
+        {cone, stfd::vec3(0.4, 0, 0.5), true},
+        {cone, stfd::vec3(0.6, 0, 0.5), false},
+        {cone, stfd::vec3(0, 0, 1), true},
+        {cone, stfd::vec3(0, 0, 1.1), false},
+        {cone, stfd::vec3(0, 0, -0.1), false},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(cone, extremity)
+{
+    // cone with the apex at the origin that opens along the +z axis with a base of radius 1 at z = 1
+    stfd::cone cone(stfd::vec3(0), stfd::vec3(0, 0, 1), 1, stfd::constants::pi_fourths);
+
+    std::vector<scaffolding::geom::cone::extremity<double>> tests = {
+        {cone, stfd::vec3(0, 0, -1), stfd::vec3(0)},
+        {cone, stfd::vec3(0, 0, 1), stfd::vec3(0, 0, 1)},
+        {cone, stfd::vec3(1, 0, 0), stfd::vec3(1, 0, 1)},
+        {cone, stfd::vec3(0, -1, 0), stfd::vec3(0, -1, 1)},
+        {cone, stfd::vec3(1, 0, -2), stfd::vec3(0)},
+        {cone, stfd::vec3(0, 1, -0.5), stfd::vec3(0, 1, 1)},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/convex_polygon.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+TEST(convex_polygon, construct)
+{
+    stfd::convex_polygon const clockwise({stfd::vec2(0), stfd::vec2(0, 1), stfd::vec2(1), stfd::vec2(1, 0)});
+    ASSERT_EQ(4, clockwise.size());
+    ASSERT_EQ(1.0, clockwise.area());
+    ASSERT_EQ(stfd::vec2(1), clockwise[1]);
+
+    stfd::convex_polygon const repeated(
+        {stfd::vec2(0), stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(1), stfd::vec2(0)});
+    ASSERT_EQ(3, repeated.size());
+    ASSERT_EQ(0.5, repeated.area());
+
+    stfd::convex_polygon const box(stfd::obb2(stfd::vec2(0), stfd::mtx2::identity(), stfd::vec2(1, 2)));
+    ASSERT_EQ(4, box.size());
+    ASSERT_NEAR(8.0, box.area(), math::constants<double>::tol);
+
+    ASSERT_TRUE(stfd::convex_polygon().is_empty());
+    ASSERT_EQ(0, stfd::convex_polygon().size());
+}
+
+TEST(convex_polygon, contains)
+{
+    stfd::convex_polygon square({stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(0, 1)});
+    stfd::convex_polygon hexagon({stfd::vec2(1, 0), stfd::vec2(2, 0), stfd::vec2(3, 1), stfd::vec2(2, 2),
+                                  stfd::vec2(1, 2), stfd::vec2(0, 1)});
+    std::vector<scaffolding::geom::convex_polygon::contains<double>> tests = {
+        {square, stfd::vec2(0.5), boundary_types::closed, true},
+        {square, stfd::vec2(0.5), boundary_types::open, true},
+        {square, stfd::vec2(0), boundary_types::closed, true},
+        {square, stfd::vec2(0), boundary_types::open, false},
+        {square, stfd::vec2(0.5, 0), boundary_types::closed, true},
+        {square, stfd::vec2(0.5, 0), boundary_types::open, false},
+        {square, stfd::vec2(1, 0.5), boundary_types::closed, true},
+        {square, stfd::vec2(1, 0.5), boundary_types::open, false},
+        {square, stfd::vec2(0, 0.5), boundary_types::closed, true},
+        {square, stfd::vec2(0, 0.5), boundary_types::open, false},
+        {square, stfd::vec2(1.5, 0.5), boundary_types::closed, false},
+        {square, stfd::vec2(-1, 0), boundary_types::closed, false},
+        {hexagon, stfd::vec2(1.5, 1), boundary_types::open, true},
+        {hexagon, stfd::vec2(2.5, 0.5), boundary_types::closed, true},
+        {hexagon, stfd::vec2(2.5, 0.5), boundary_types::open, false},
+        {hexagon, stfd::vec2(2.9, 0.5), boundary_types::closed, false},
+        {hexagon, stfd::vec2(0.1, 0.1), boundary_types::closed, false},
+        {hexagon, stfd::vec2(0.5, 1.5), boundary_types::closed, true},
+        {hexagon, stfd::vec2(0.4, 1.5), boundary_types::closed, false},
+        {stfd::convex_polygon(), stfd::vec2(0), boundary_types::closed, false},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(convex_polygon, intersects)
+{
+    {
+        stfd::convex_polygon square({stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(0, 1)});
+        stfd::convex_polygon triangle({stfd::vec2(0), stfd::vec2(2, 0), stfd::vec2(0, 2)});
+        std::vector<scaffolding::geom::convex_polygon::intersects<double, stfd::convex_polygon>> tests = {
+            {square, square, true, 0},
+            {square, triangle, true, 0},
+            {square, stfd::convex_polygon({stfd::vec2(1, 0), stfd::vec2(2, 0), stfd::vec2(2, 1)}), true, 0},
+            {square, stfd::convex_polygon({stfd::vec2(2, 0), stfd::vec2(3, 0), stfd::vec2(3, 1)}), false, 1},
+            {square, stfd::convex_polygon({stfd::vec2(2), stfd::vec2(3, 2), stfd::vec2(2, 3)}), false, std::sqrt(2.0)},
+            {square, stfd::convex_polygon({stfd::vec2(0.25), stfd::vec2(0.75, 0.25), stfd::vec2(0.5)}), true, 0},
+            {triangle, stfd::convex_polygon({stfd::vec2(2), stfd::vec2(3, 2), stfd::vec2(2, 3)}), false,
+             std::sqrt(2.0)},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::convex_polygon square({stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(0, 1)});
+        stfd::mtx2 const rotation = math::rotate(math::constants<double>::quarter_pi);
+        std::vector<scaffolding::geom::convex_polygon::intersects<double, stfd::obb2>> tests = {
+            {square, stfd::obb2(stfd::vec2(0.5), stfd::mtx2::identity(), stfd::vec2(0.25)), true, 0},
+            {square, stfd::obb2(stfd::vec2(3, 0.5), stfd::mtx2::identity(), stfd::vec2(1)), false, 1},
+            {square, stfd::obb2(stfd::vec2(2), rotation, stfd::vec2(0.5)), false, std::sqrt(2.0) - 0.5},
+            {square, stfd::obb2(stfd::vec2(1.3), rotation, stfd::vec2(0.5)), true, 0},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(convex_polygon, random)
+{
+    std::vector<scaffolding::geom::convex_polygon::random<double>> tests = {
+        {0, 8, 500},
+        {1, 50, 500},
+        {2, 1000, 300},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
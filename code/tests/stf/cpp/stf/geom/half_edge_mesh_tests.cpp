@@ -0,0 +1,218 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/half_edge_mesh.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+namespace
+{
+
+// a triangulated n x n grid of unit squares where vertex (x, y) has index y * (n + 1) + x
+stff::half_edge_mesh grid(uint32_t const n)
+{
+    std::vector<stff::vec3> vertices;
+    for (uint32_t y = 0; y <= n; ++y)
+    {
+        for (uint32_t x = 0; x <= n; ++x)
+        {
+            vertices.push_back(stff::vec3(static_cast<float>(x), static_cast<float>(y), 0));
+        }
+    }
+
+    std::vector<uint32_t> indices;
+    for (uint32_t y = 0; y < n; ++y)
+    {
+        for (uint32_t x = 0; x < n; ++x)
+        {
+            uint32_t const v = y * (n + 1) + x;
+            std::vector<uint32_t> const square = {v, v + 1, v + n + 2, v, v + n + 2, v + n + 1};
+            indices.insert(indices.end(), square.begin(), square.end());
+        }
+    }
+    return stff::half_edge_mesh(vertices, indices);
+}
+
+// a unit square split along the diagonal from 0 to 2 along with an isolated vertex 4
+stff::half_edge_mesh quad()
+{
+    std::vector<stff::vec3> vertices = {stff::vec3(0, 0, 0), stff::vec3(1, 0, 0), stff::vec3(1, 1, 0),
+                                        stff::vec3(0, 1, 0), stff::vec3(2, 0.5f, 0)};
+    return stff::half_edge_mesh(vertices, {0, 1, 2, 0, 2, 3});
+}
+
+} // namespace
+
+TEST(half_edge_mesh, construct)
+{
+    std::vector<stff::vec3> tetrahedron = {stff::vec3(0, 0, 0), stff::vec3(1, 0, 0), stff::vec3(0, 1, 0),
+                                           stff::vec3(0, 0, 1)};
+    std::vector<scaffolding::geom::half_edge_mesh::topology<float>> tests = {
+        {stff::half_edge_mesh(), 0, 0, 0, {}},
+        {stff::half_edge_mesh(tetrahedron, {0, 1, 2}), 4, 6, 1, {3}},
+        {quad(), 5, 10, 2, {4}},
+        {stff::half_edge_mesh(tetrahedron, {0, 2, 1, 0, 1, 3, 1, 2, 3, 0, 3, 2}), 4, 12, 4, {}},
+        {grid(1), 4, 10, 2, {4}},
+        {grid(3), 16, 66, 18, {12}},
+        // degenerate, out of range, non-manifold, and inconsistently oriented triangles are skipped
+        {stff::half_edge_mesh(tetrahedron, {0, 1, 1, 0, 1, 7, 0, 1, 2, 0, 1, 3, 1, 0, 3, 3, 1, 0}), 4, 10, 2, {4}},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(half_edge_mesh, queries)
+{
+    stff::half_edge_mesh const mesh = grid(3);
+
+    // interior vertex 5 is adjacent to 0, 1, 4, 6, 9, 10 and vertex 0 is adjacent to 1, 4, 5
+    ASSERT_EQ(6, mesh.valence(5));
+    ASSERT_EQ(3, mesh.valence(0));
+    ASSERT_FALSE(mesh.is_boundary(mesh.half_edge(5)));
+    ASSERT_TRUE(mesh.is_boundary(mesh.half_edge(0)));
+
+    size_t count = 0;
+    mesh.visit_outgoing(5, [&](uint32_t const h)
+    {
+        ASSERT_EQ(5, mesh.origin(h));
+        ++count;
+    });
+    ASSERT_EQ(6, count);
+
+    uint32_t const h = mesh.find_half_edge(0, 5);
+    ASSERT_NE(stff::half_edge_mesh::c_invalid, h);
+    ASSERT_EQ(5, mesh.target(h));
+    ASSERT_EQ(1, mesh.face(h));
+    ASSERT_EQ(0, mesh.face(mesh.twin(h)));
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, mesh.find_half_edge(0, 6));
+    ASSERT_TRUE(mesh.is_boundary(mesh.find_half_edge(1, 0)));
+
+    std::array<uint32_t, 3> const vertices = mesh.vertices(1);
+    ASSERT_EQ(std::vector<uint32_t>({0, 5, 4}), std::vector<uint32_t>(vertices.begin(), vertices.end()));
+    ASSERT_EQ(stff::vec3(1, 1, 0), mesh.position(5));
+}
+
+TEST(half_edge_mesh, remove_face)
+{
+    // removing the interior face (5, 10, 9) leaves a triangular hole
+    stff::half_edge_mesh hole = grid(3);
+    hole.remove_face(9);
+
+    // removing a corner triangle removes the boundary edge between 0 and 1
+    stff::half_edge_mesh corner = grid(3);
+    corner.remove_face(0);
+
+    // removing both corner triangles removes vertex 0
+    stff::half_edge_mesh square = grid(3);
+    square.remove_face(0);
+    square.remove_face(1);
+
+    // removing the face between the boundary triangles at vertex 1 makes vertex 1 non-manifold
+    stff::half_edge_mesh bowtie = grid(3);
+    bowtie.remove_face(3);
+    stff::half_edge_mesh split = bowtie;
+    split.remove_face(0);
+
+    // removing every other face around the interior vertex 5 leaves it with three fans and then removing one of the
+    // fans leaves two
+    stff::half_edge_mesh star = grid(3);
+    star.remove_face(3);
+    star.remove_face(9);
+    star.remove_face(1);
+    stff::half_edge_mesh pruned = star;
+    pruned.remove_face(6);
+
+    // removing every face removes everything
+    stff::half_edge_mesh empty = grid(3);
+    for (uint32_t f = 0; f < 18; ++f)
+    {
+        empty.remove_face(f);
+    }
+
+    std::vector<scaffolding::geom::half_edge_mesh::topology<float>> tests = {
+        {hole, 16, 66, 17, {3, 12}},
+        {corner, 16, 64, 17, {13}},
+        {square, 15, 60, 16, {12}},
+        {bowtie, 16, 66, 17, {15}},
+        {split, 16, 62, 16, {14}},
+        {star, 16, 64, 15, {3, 16}},
+        {pruned, 16, 60, 14, {3, 15}},
+        {empty, 0, 0, 0, {}},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(half_edge_mesh, add_face)
+{
+    // attach a triangle to the boundary edge from 2 to 1 and the isolated vertex 4
+    stff::half_edge_mesh attached = quad();
+    uint32_t const f = attached.add_face(2, 1, 4);
+    ASSERT_EQ(2, f);
+
+    // removed slots are reused when a face is added back
+    stff::half_edge_mesh filled = grid(3);
+    filled.remove_face(17);
+    filled.remove_face(0);
+    ASSERT_EQ(0, filled.add_face(0, 1, 5));
+    ASSERT_EQ(17, filled.add_face(10, 15, 14));
+
+    // a face can close the fan around a vertex
+    stff::half_edge_mesh closed = grid(3);
+    closed.remove_face(8);
+    closed.remove_face(9);
+    ASSERT_EQ(9, closed.add_face(5, 6, 10));
+    ASSERT_EQ(8, closed.add_face(5, 10, 9));
+    ASSERT_FALSE(closed.is_boundary(closed.half_edge(5)));
+
+    std::vector<scaffolding::geom::half_edge_mesh::topology<float>> tests = {
+        {attached, 5, 14, 3, {5}},
+        {filled, 16, 66, 18, {12}},
+        {closed, 16, 66, 18, {12}},
+    };
+    scaffolding::verify(tests);
+
+    // faces that reuse an interior half-edge, attach at an interior vertex, or only touch the mesh at a vertex fail
+    stff::half_edge_mesh mesh = quad();
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, mesh.add_face(1, 2, 4));
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, mesh.add_face(0, 0, 4));
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, mesh.add_face(4, 1, 3));
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, grid(3).add_face(5, 9, 10));
+
+    // faces can not be added at non-manifold vertices
+    stff::half_edge_mesh bowtie = grid(3);
+    bowtie.remove_face(9);
+    bowtie.remove_face(0);
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, bowtie.add_face(0, 1, 5));
+    ASSERT_EQ(2, mesh.face_count());
+}
+
+TEST(half_edge_mesh, flip_edge)
+{
+    stff::half_edge_mesh flipped = quad();
+    ASSERT_TRUE(flipped.flip_edge(flipped.find_half_edge(0, 2)));
+    ASSERT_EQ(stff::half_edge_mesh::c_invalid, flipped.find_half_edge(0, 2));
+    ASSERT_NE(stff::half_edge_mesh::c_invalid, flipped.find_half_edge(1, 3));
+    ASSERT_EQ(2, flipped.valence(0));
+    ASSERT_EQ(3, flipped.valence(1));
+
+    // boundary edges can not be flipped
+    ASSERT_FALSE(flipped.flip_edge(flipped.find_half_edge(0, 1)));
+
+    // flipping twice restores the original edge
+    stff::half_edge_mesh twice = grid(3);
+    ASSERT_TRUE(twice.flip_edge(twice.find_half_edge(5, 10)));
+    ASSERT_TRUE(twice.flip_edge(twice.find_half_edge(6, 9)));
+    ASSERT_NE(stff::half_edge_mesh::c_invalid, twice.find_half_edge(5, 10));
+
+    std::vector<scaffolding::geom::half_edge_mesh::topology<float>> tests = {
+        {flipped, 5, 10, 2, {4}},
+        {twice, 16, 66, 18, {12}},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
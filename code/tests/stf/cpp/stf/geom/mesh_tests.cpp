@@ -0,0 +1,152 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/mesh.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+namespace
+{
+
+// a triangle soup for an n x n grid of unit squares in the z = 0 plane (each triangle has its own vertices)
+stff::mesh grid_soup(size_t const n, float const jitter)
+{
+    std::vector<stff::vec3> vertices;
+    std::vector<uint32_t> indices;
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            float const x = static_cast<float>(i);
+            float const y = static_cast<float>(j);
+            std::vector<stff::vec3> const corners = {
+                stff::vec3(x, y, 0),     stff::vec3(x + 1, y, 0),     stff::vec3(x + 1, y + 1, 0),
+                stff::vec3(x, y, 0),     stff::vec3(x + 1, y + 1, 0), stff::vec3(x, y + 1, 0),
+            };
+            for (stff::vec3 const& corner : corners)
+            {
+                // alternate the sign of the jitter so that neighboring copies of a vertex straddle cell boundaries
+                float const sign = (vertices.size() % 2 == 0) ? 1.f : -1.f;
+                indices.push_back(static_cast<uint32_t>(vertices.size()));
+                vertices.push_back(corner + stff::vec3(sign * jitter));
+            }
+        }
+    }
+    return stff::mesh(vertices, indices);
+}
+
+// a closed unit cube with shared vertices and outward facing triangles
+stff::mesh cube()
+{
+    std::vector<stff::vec3> vertices;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        vertices.push_back(stff::vec3(static_cast<float>(i & 1), static_cast<float>((i >> 1) & 1),
+                                      static_cast<float>((i >> 2) & 1)));
+    }
+    std::vector<uint32_t> indices = {
+        0, 2, 3, 0, 3, 1,    // z = 0
+        4, 5, 7, 4, 7, 6,    // z = 1
+        0, 1, 5, 0, 5, 4,    // y = 0
+        2, 6, 7, 2, 7, 3,    // y = 1
+        0, 4, 6, 0, 6, 2,    // x = 0
+        1, 3, 7, 1, 7, 5,    // x = 1
+    };
+    return stff::mesh(vertices, indices);
+}
+
+} // namespace
+
+TEST(mesh, weld)
+{
+    stff::mesh degenerate({stff::vec3(0), stff::vec3(1, 0, 0), stff::vec3(0, 1, 0), stff::vec3(0.001f, 0, 0)},
+                          {0, 1, 2, 0, 3, 2});
+    std::vector<scaffolding::geom::mesh::weld<float>> tests = {
+        {stff::mesh(), 0.01f, 0, 0},
+        {cube(), 0.01f, 8, 12},
+        {grid_soup(1, 0.f), 0.01f, 4, 2},
+        {grid_soup(8, 0.f), 0.01f, 81, 128},
+        {grid_soup(8, 0.002f), 0.01f, 81, 128},
+        {degenerate, 0.01f, 3, 1},
+        {degenerate, 0.0001f, 4, 2},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(mesh, random_weld)
+{
+    std::vector<scaffolding::geom::mesh::random_weld<float>> tests = {
+        {0, 10, 0.1f}, {1, 200, 0.05f}, {2, 500, 0.01f},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(mesh, normals)
+{
+    float const c = 1.f / std::sqrt(3.f);
+    std::vector<stff::vec3> corners;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        corners.push_back(stff::vec3((i & 1) ? c : -c, (i & 2) ? c : -c, (i & 4) ? c : -c));
+    }
+
+    stff::mesh flat = grid_soup(4, 0.f);
+    flat.weld(0.01f);
+
+    std::vector<scaffolding::geom::mesh::normals<float>> tests = {
+        {stff::mesh(), {}, {}},
+        {stff::mesh({stff::vec3(0), stff::vec3(2, 0, 0), stff::vec3(0, 2, 0), stff::vec3(5)}, {0, 1, 2}),
+          {stff::vec3(0, 0, 1)}, {stff::vec3(0, 0, 1), stff::vec3(0, 0, 1), stff::vec3(0, 0, 1), stff::vec3(0)}},
+        {stff::mesh({stff::vec3(0), stff::vec3(1, 0, 0), stff::vec3(2, 0, 0)}, {0, 1, 2}),
+          {stff::vec3(0)}, {stff::vec3(0), stff::vec3(0), stff::vec3(0)}},
+        {flat, std::vector<stff::vec3>(32, stff::vec3(0, 0, 1)), std::vector<stff::vec3>(25, stff::vec3(0, 0, 1))},
+        {cube(),
+          {stff::vec3(0, 0, -1), stff::vec3(0, 0, -1), stff::vec3(0, 0, 1), stff::vec3(0, 0, 1),
+            stff::vec3(0, -1, 0), stff::vec3(0, -1, 0), stff::vec3(0, 1, 0), stff::vec3(0, 1, 0),
+            stff::vec3(-1, 0, 0), stff::vec3(-1, 0, 0), stff::vec3(1, 0, 0), stff::vec3(1, 0, 0)},
+          {}},
+    };
+
+    // each cube vertex touches two triangles from one of its faces and one triangle from each of the others (or the
+    // reverse), so the area-weighted normals do not point directly along the diagonals -- compute them directly
+    {
+        stff::mesh const& mesh = tests.back().mesh;
+        std::vector<stff::vec3> sums(mesh.vertex_count(), stff::vec3(0));
+        for (size_t t = 0; t < mesh.triangle_count(); ++t)
+        {
+            stff::vec3 const normal = mesh.triangle(t).normal();
+            for (size_t k = 0; k < 3; ++k)
+            {
+                sums[mesh.indices()[3 * t + k]] += normal;
+            }
+        }
+        for (size_t v = 0; v < sums.size(); ++v)
+        {
+            stff::vec3 const normal = sums[v].normalized();
+            ASSERT_GT(normal.dot(corners[v]), 0.f) << "Failed to point the cube normal outward";
+            tests.back().vertex_normals.push_back(normal);
+        }
+    }
+
+    scaffolding::verify(tests);
+}
+
+TEST(mesh, bounds)
+{
+    std::vector<scaffolding::geom::mesh::bounds<float>> tests = {
+        {stff::mesh(), stff::aabb3::nothing(), stff::vec3(0), 0.f},
+        {stff::mesh({stff::vec3(1, 2, 3)}, {}), stff::aabb3(stff::vec3(1, 2, 3), stff::vec3(1, 2, 3)),
+          stff::vec3(1, 2, 3), 0.f},
+        {cube(), stff::aabb3(stff::vec3(0), stff::vec3(1)), stff::vec3(0.5f), std::sqrt(3.f) / 2.f},
+        {grid_soup(8, 0.f), stff::aabb3(stff::vec3(0), stff::vec3(8, 8, 0)), stff::vec3(4, 4, 0),
+          4.f * std::sqrt(2.f)},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/prepared_holygon.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+TEST(prepared_holygon, queries)
+{
+    stfd::polygon hull({stfd::vec2(0), stfd::vec2(8, 0), stfd::vec2(8, 4), stfd::vec2(0, 4)});
+    stfd::polygon left({stfd::vec2(1), stfd::vec2(1, 3), stfd::vec2(3), stfd::vec2(3, 1)});
+    stfd::polygon right({stfd::vec2(5, 1), stfd::vec2(5, 3), stfd::vec2(7, 3), stfd::vec2(7, 1)});
+    stfd::holygon holygon(hull, {left, right});
+    std::vector<scaffolding::geom::prepared_holygon::queries<double>> tests = {
+        {holygon, stfd::vec2(0.5), true, true, 0},
+        {holygon, stfd::vec2(4, 2), true, true, 0},
+        {holygon, stfd::vec2(2), false, false, 1},
+        {holygon, stfd::vec2(6.5, 2), false, false, 0.25},
+        {holygon, stfd::vec2(1, 2), true, false, 0},
+        {holygon, stfd::vec2(7, 3), true, false, 0},
+        {holygon, stfd::vec2(8, 2), true, false, 0},
+        {holygon, stfd::vec2(10, 2), false, false, 4},
+        {holygon, stfd::vec2(-3, -4), false, false, 25},
+        {stfd::holygon(hull), stfd::vec2(2), true, true, 0},
+        {stfd::holygon(), stfd::vec2(0), false, false, stfd::constants::pos_inf},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(prepared_holygon, random)
+{
+    std::vector<scaffolding::geom::prepared_holygon::random<double>> tests = {
+        {0, 16, 1, 1000},
+        {1, 32, 6, 500},
+        {2, 8, 12, 500},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
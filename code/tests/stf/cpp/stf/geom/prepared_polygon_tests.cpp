@@ -0,0 +1,68 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/prepared_polygon.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+TEST(prepared_polygon, contains)
+{
+    {
+        stfd::polygon square({stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(0, 1)});
+        stfd::polygon notched(
+            {stfd::vec2(0), stfd::vec2(1, 0), stfd::vec2(1), stfd::vec2(2, 1), stfd::vec2(2), stfd::vec2(0, 1)});
+        stfd::polygon triangle({stfd::vec2(0), stfd::vec2(1), stfd::vec2(2, 0)});
+        std::vector<scaffolding::geom::prepared_polygon::contains<double, stfd::polygon>> tests = {
+            {square, stfd::vec2(0.5), boundary_types::closed, true},
+            {square, stfd::vec2(0), boundary_types::closed, true},
+            {square, stfd::vec2(0), boundary_types::open, false},
+            {square, stfd::vec2(0.5, 1), boundary_types::closed, true},
+            {square, stfd::vec2(0.5, 1), boundary_types::open, false},
+            {square, stfd::vec2(-1, 0), boundary_types::closed, false},
+            {notched, stfd::vec2(0.5, 1), boundary_types::closed, true},
+            {notched, stfd::vec2(0.5, 1), boundary_types::open, true},
+            {notched, stfd::vec2(1.5, 0.5), boundary_types::closed, false},
+            {notched, stfd::vec2(-0.5, 1), boundary_types::closed, false},
+            {triangle, stfd::vec2(1), boundary_types::closed, true},
+            {triangle, stfd::vec2(1), boundary_types::open, false},
+            {triangle, stfd::vec2(1, 0.5), boundary_types::open, true},
+            {triangle, stfd::vec2(0, 1), boundary_types::closed, false},
+            {stfd::polygon(), stfd::vec2(0), boundary_types::closed, false},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::polygon hull({stfd::vec2(0), stfd::vec2(4, 0), stfd::vec2(4), stfd::vec2(0, 4)});
+        stfd::polygon hole({stfd::vec2(1), stfd::vec2(1, 3), stfd::vec2(3), stfd::vec2(3, 1)});
+        stfd::holygon holygon(hull, {hole});
+        std::vector<scaffolding::geom::prepared_polygon::contains<double, stfd::holygon>> tests = {
+            {holygon, stfd::vec2(0.5), boundary_types::closed, true},
+            {holygon, stfd::vec2(2), boundary_types::closed, false},
+            {holygon, stfd::vec2(2), boundary_types::open, false},
+            {holygon, stfd::vec2(1, 2), boundary_types::closed, true},
+            {holygon, stfd::vec2(1, 2), boundary_types::open, false},
+            {holygon, stfd::vec2(4, 2), boundary_types::closed, true},
+            {holygon, stfd::vec2(4, 2), boundary_types::open, false},
+            {holygon, stfd::vec2(5, 2), boundary_types::closed, false},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(prepared_polygon, random)
+{
+    std::vector<scaffolding::geom::prepared_polygon::random<double>> tests = {
+        {0, 16, 1000},
+        {1, 200, 500},
+        {2, 500, 300},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/triangle.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+TEST(triangle2, area)
+{
+    std::vector<scaffolding::geom::triangle::area<float, 2>> tests = {
+        {stff::triangle2(stff::vec2(0), stff::vec2(1, 0), stff::vec2(0, 1)), 0.5f},
+        {stff::triangle2(stff::vec2(0), stff::vec2(0, 1), stff::vec2(1, 0)), 0.5f},
+        {stff::triangle2(stff::vec2(1), stff::vec2(5, 1), stff::vec2(3, 4)), 6.f},
+        {stff::triangle2(stff::vec2(0), stff::vec2(1), stff::vec2(2)), 0.f},
+        {stff::triangle2(), 0.f},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle2, barycentric)
+{
+    stff::triangle2 tri(stff::vec2(0), stff::vec2(4, 0), stff::vec2(0, 4));
+    std::vector<scaffolding::geom::triangle::barycentric<float, 2>> tests = {
+        {tri, stff::vec2(0), stff::vec3(1, 0, 0)},
+        {tri, stff::vec2(4, 0), stff::vec3(0, 1, 0)},
+        {tri, stff::vec2(0, 4), stff::vec3(0, 0, 1)},
+        {tri, stff::vec2(1, 1), stff::vec3(0.5, 0.25, 0.25)},
+        {tri, stff::vec2(2, 2), stff::vec3(0, 0.5, 0.5)},
+        {tri, stff::vec2(-4, 0), stff::vec3(2, -1, 0)},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle2, closest_point)
+{
+    stff::triangle2 tri(stff::vec2(0), stff::vec2(4, 0), stff::vec2(0, 4));
+    std::vector<scaffolding::geom::triangle::closest_point<float, 2>> tests = {
+        {tri, stff::vec2(1, 1), stff::vec2(1, 1)},    // interior
+        {tri, stff::vec2(-1, -1), stff::vec2(0, 0)},  // vertex a
+        {tri, stff::vec2(5, -1), stff::vec2(4, 0)},   // vertex b
+        {tri, stff::vec2(-1, 5), stff::vec2(0, 4)},   // vertex c
+        {tri, stff::vec2(2, -3), stff::vec2(2, 0)},   // edge ab
+        {tri, stff::vec2(-3, 2), stff::vec2(0, 2)},   // edge ac
+        {tri, stff::vec2(3, 3), stff::vec2(2, 2)},    // edge bc
+        {tri, stff::vec2(4, 0), stff::vec2(4, 0)},    // on a vertex
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
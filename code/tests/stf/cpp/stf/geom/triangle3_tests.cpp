@@ -0,0 +1,115 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include "stf/scaffolding/geom/triangle.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::geom
+{
+
+TEST(triangle3, area)
+{
+    std::vector<scaffolding::geom::triangle::area<float, 3>> tests = {
+        {stff::triangle3(stff::vec3(0), stff::vec3(1, 0, 0), stff::vec3(0, 1, 0)), 0.5f},
+        {stff::triangle3(stff::vec3(0), stff::vec3(0, 2, 0), stff::vec3(0, 0, 2)), 2.f},
+        {stff::triangle3(stff::vec3(1, 0, 0), stff::vec3(0, 1, 0), stff::vec3(0, 0, 1)), std::sqrt(3.f) / 2.f},
+        {stff::triangle3(stff::vec3(0), stff::vec3(1), stff::vec3(2)), 0.f},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle3, normal)
+{
+    std::vector<scaffolding::geom::triangle::normal<float>> tests = {
+        {stff::triangle3(stff::vec3(0), stff::vec3(1, 0, 0), stff::vec3(0, 1, 0)), stff::vec3(0, 0, 1)},
+        {stff::triangle3(stff::vec3(0), stff::vec3(0, 1, 0), stff::vec3(1, 0, 0)), stff::vec3(0, 0, -1)},
+        {stff::triangle3(stff::vec3(0), stff::vec3(0, 3, 0), stff::vec3(0, 0, 3)), stff::vec3(1, 0, 0)},
+        {stff::triangle3(stff::vec3(1, 0, 0), stff::vec3(0, 1, 0), stff::vec3(0, 0, 1)),
+         stff::vec3(1.f / std::sqrt(3.f))},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle3, barycentric)
+{
+    stff::triangle3 tri(stff::vec3(0), stff::vec3(4, 0, 0), stff::vec3(0, 4, 0));
+    std::vector<scaffolding::geom::triangle::barycentric<float, 3>> tests = {
+        {tri, stff::vec3(0), stff::vec3(1, 0, 0)},
+        {tri, stff::vec3(1, 1, 0), stff::vec3(0.5, 0.25, 0.25)},
+        {tri, stff::vec3(1, 1, 5), stff::vec3(0.5, 0.25, 0.25)}, // projected onto the plane
+        {tri, stff::vec3(2, 2, -1), stff::vec3(0, 0.5, 0.5)},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle3, closest_point)
+{
+    stff::triangle3 tri(stff::vec3(0), stff::vec3(4, 0, 0), stff::vec3(0, 4, 0));
+    std::vector<scaffolding::geom::triangle::closest_point<float, 3>> tests = {
+        {tri, stff::vec3(1, 1, 0), stff::vec3(1, 1, 0)},
+        {tri, stff::vec3(1, 1, 3), stff::vec3(1, 1, 0)},
+        {tri, stff::vec3(1, 1, -3), stff::vec3(1, 1, 0)},
+        {tri, stff::vec3(-1, -1, 2), stff::vec3(0, 0, 0)},
+        {tri, stff::vec3(6, -1, 1), stff::vec3(4, 0, 0)},
+        {tri, stff::vec3(2, -3, 1), stff::vec3(2, 0, 0)},
+        {tri, stff::vec3(3, 3, -2), stff::vec3(2, 2, 0)},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle3, intersects)
+{
+    stff::aabb3 box(stff::vec3(0), 1.f);
+    std::vector<scaffolding::geom::triangle::intersects<float>> tests = {
+        {stff::triangle3(stff::vec3(0.2f), stff::vec3(0.8f, 0.2f, 0.2f), stff::vec3(0.2f, 0.8f, 0.2f)), box, true},
+        {stff::triangle3(stff::vec3(-5, -5, 0.5), stff::vec3(5, -5, 0.5), stff::vec3(0, 5, 0.5)), box, true},
+        {stff::triangle3(stff::vec3(-5, -5, 1.5), stff::vec3(5, -5, 1.5), stff::vec3(0, 5, 1.5)), box, false},
+        {stff::triangle3(stff::vec3(2, 2, 2), stff::vec3(3, 2, 2), stff::vec3(2, 3, 2)), box, false},
+        {stff::triangle3(stff::vec3(1, 1, 1), stff::vec3(3, 2, 2), stff::vec3(2, 3, 2)), box, true}, // touching
+        {stff::triangle3(stff::vec3(1.5, 0, 0), stff::vec3(0, 1.5, 0), stff::vec3(0.75, 0.75, 5)), box, true},
+        // the bounds overlap but the triangle passes beside the box
+        {stff::triangle3(stff::vec3(2.1, 0, -5), stff::vec3(0, 2.1, -5), stff::vec3(1.5, 1.5, 5)), box, false},
+        {stff::triangle3(stff::vec3(2.5, 0, -1), stff::vec3(0, 2.5, -1), stff::vec3(0, 2.5, 2)), box, false},
+        {stff::triangle3(stff::vec3(-1, 0.5, -1), stff::vec3(2, 0.5, -1), stff::vec3(0.5, 0.5, 2)), box, true},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(triangle3, batch)
+{
+    // a 3x3 grid of quads (split into triangles) on a saddle surface
+    std::vector<stff::vec3> vertices;
+    std::vector<uint32_t> indices;
+    for (int j = 0; j <= 3; ++j)
+    {
+        for (int i = 0; i <= 3; ++i)
+        {
+            float const z = 0.1f * static_cast<float>(i * j);
+            vertices.push_back(stff::vec3(static_cast<float>(i), static_cast<float>(j), z));
+        }
+    }
+    for (size_t j = 0; j < 3; ++j)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            size_t const v = j * 4 + i;
+            for (size_t index : {v, v + 1, v + 5, v, v + 5, v + 4})
+            {
+                indices.push_back(static_cast<uint32_t>(index));
+            }
+        }
+    }
+
+    std::vector<scaffolding::geom::triangle::batch<float>> tests = {
+        {{}, {}, stff::vec3(0), stff::aabb3(stff::vec3(0), 1.f)},
+        {vertices, indices, stff::vec3(1.3, 2.1, 1), stff::aabb3(stff::vec3(0.5, 0.5, -1), 1.f)},
+        {vertices, indices, stff::vec3(-1, 5, 0), stff::aabb3(stff::vec3(1.2, 1.2, -1), stff::vec3(1.8, 1.8, 2))},
+        {vertices, indices, stff::vec3(1.5, 1.5, 0), stff::aabb3(stff::vec3(5), 1.f)},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::geom
\ No newline at end of file
@@ -46,4 +46,13 @@ TEST(mtx4, inverted)
     scaffolding::verify(tests);
 }
 
+TEST(mtx4, perspective)
+{
+    std::vector<scaffolding::math::mtx::perspective<float>> tests = {
+        {stff::constants::quarter_pi, 1.f, 0.1f, 100.f},
+        {stff::constants::half_pi, 16.f / 9.f, 1.f, 10.f},
+    };
+    scaffolding::verify(tests);
+}
+
 } // namespace stf::math
\ No newline at end of file
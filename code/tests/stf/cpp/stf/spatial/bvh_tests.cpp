@@ -0,0 +1,46 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/bvh.hpp>
+
+#include "stf/scaffolding/spatial/bvh.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::spatial
+{
+
+TEST(bvh, find)
+{
+    // a grid of unit boxes with some overlapping duplicates
+    std::vector<stff::aabb3> grid;
+    for (int i = 0; i < 10; ++i)
+    {
+        for (int j = 0; j < 10; ++j)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                grid.push_back(stff::aabb3(stff::vec3(2.f * i, 2.f * j, 2.f * k), 1.f));
+            }
+        }
+    }
+    std::vector<stff::aabb3> duplicates(20, stff::aabb3(stff::vec3(5), 1.f));
+
+    std::vector<scaffolding::spatial::bvh::find<float>> tests = {
+        {{}, 4, stff::aabb3(stff::vec3(0), 1.f)},
+        {{stff::aabb3(stff::vec3(0), 1.f)}, 4, stff::aabb3(stff::vec3(0.5f), 1.f)},
+        {{stff::aabb3(stff::vec3(0), 1.f)}, 4, stff::aabb3(stff::vec3(2), 1.f)},
+        {grid, 4, stff::aabb3(stff::vec3(-10), 1.f)},
+        {grid, 4, stff::aabb3(stff::vec3(3.5f), 1.f)},
+        {grid, 4, stff::aabb3(stff::vec3(1.5f), 5.f)},
+        {grid, 1, stff::aabb3(stff::vec3(1.5f), 5.f)},
+        {grid, 0, stff::aabb3(stff::vec3(4.f, 4.f, 0.f), stff::vec3(12.f, 6.f, 2.f))},
+        {grid, 16, stff::aabb3(stff::vec3(-100), 200.f)},
+        {duplicates, 4, stff::aabb3(stff::vec3(5), 1.f)},
+        {duplicates, 4, stff::aabb3(stff::vec3(0), 1.f)},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::spatial
\ No newline at end of file
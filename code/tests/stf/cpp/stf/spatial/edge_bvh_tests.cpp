@@ -0,0 +1,59 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/edge_bvh.hpp>
+
+#include "stf/scaffolding/spatial/edge_bvh.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::spatial
+{
+
+TEST(edge_bvh, nearest)
+{
+    {
+        stfd::polyline2 zigzag({stfd::vec2(0), stfd::vec2(2, 0), stfd::vec2(2), stfd::vec2(4, 2)});
+        std::vector<scaffolding::spatial::edge_bvh::nearest<double, stfd::polyline2>> tests = {
+            {zigzag, stfd::vec2(1, -1), true, 1, stfd::vec2(1, 0), 0},
+            {zigzag, stfd::vec2(2.5, 1), true, 0.25, stfd::vec2(2, 1), 1},
+            {zigzag, stfd::vec2(5, 2), true, 1, stfd::vec2(4, 2), 2},
+            {zigzag, stfd::vec2(-3, 4), true, 25, stfd::vec2(0), 0},
+            {zigzag, stfd::vec2(3, 2), true, 0, stfd::vec2(3, 2), 2},
+            {stfd::polyline2(), stfd::vec2(0), false, 0, stfd::vec2(0), 0},
+        };
+        scaffolding::verify(tests);
+    }
+
+    {
+        stfd::polygon hull({stfd::vec2(0), stfd::vec2(4, 0), stfd::vec2(4), stfd::vec2(0, 4)});
+        stfd::polygon hole({stfd::vec2(1), stfd::vec2(1, 3), stfd::vec2(3), stfd::vec2(3, 1)});
+        stfd::holygon holygon(hull, {hole});
+        std::vector<scaffolding::spatial::edge_bvh::nearest<double, stfd::holygon>> tests = {
+            {holygon, stfd::vec2(2, 0.25), true, 0.0625, stfd::vec2(2, 0), 0},
+            {holygon, stfd::vec2(2, 2.5), true, 0.25, stfd::vec2(2, 3), 5},
+            {holygon, stfd::vec2(5, 2), true, 1, stfd::vec2(4, 2), 1},
+        };
+        scaffolding::verify(tests);
+    }
+}
+
+TEST(edge_bvh, random)
+{
+    std::vector<scaffolding::spatial::edge_bvh::random<double, 2>> tests2 = {
+        {0, 2, 4, 100},
+        {1, 100, 1, 200},
+        {2, 2000, 4, 200},
+        {3, 2000, 16, 200},
+    };
+    scaffolding::verify(tests2);
+
+    std::vector<scaffolding::spatial::edge_bvh::random<double, 3>> tests3 = {
+        {4, 100, 4, 200},
+        {5, 2000, 4, 200},
+    };
+    scaffolding::verify(tests3);
+}
+
+} // namespace stf::spatial
\ No newline at end of file
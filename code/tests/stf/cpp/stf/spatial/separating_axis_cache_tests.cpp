@@ -0,0 +1,42 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/separating_axis_cache.hpp>
+
+#include "stf/scaffolding/spatial/separating_axis_cache.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::spatial
+{
+
+TEST(separating_axis_cache, queries)
+{
+    stfd::mtx3 rotation = math::rotate(math::normalized(stfd::vec3(1, 1, 1)), stfd::constants::pi_fourths).prefix();
+    stfd::obb3 box(stfd::vec3(0), rotation, stfd::vec3(1, 2, 3));
+    std::vector<scaffolding::spatial::separating_axis_cache::queries<double>> tests = {
+        // separated pairs miss the first query and hit every query after that
+        {box, stfd::obb3(stfd::vec3(10, 0, 0), rotation, stfd::vec3(1)), 1, 0},
+        {box, stfd::obb3(stfd::vec3(10, 0, 0), rotation, stfd::vec3(1)), 5, 4},
+        {box, stfd::obb3(stfd::aabb3(stfd::vec3(-1, -1, 6), stfd::vec3(1, 1, 7))), 3, 2},
+        // intersecting pairs always miss
+        {box, stfd::obb3(stfd::vec3(0.5, 0, 0), rotation, stfd::vec3(1)), 3, 0},
+        {box, box, 2, 0},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(separating_axis_cache, intersecting_pairs)
+{
+    std::vector<scaffolding::spatial::separating_axis_cache::intersecting_pairs<double>> tests = {
+        {1, 0, 0.1, 3},
+        {2, 1, 0.1, 3},
+        {3, 40, 0.1, 20},
+        {4, 60, 0.5, 10},
+        {5, 30, 0.0, 5},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::spatial
\ No newline at end of file
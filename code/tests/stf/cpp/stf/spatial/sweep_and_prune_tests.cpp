@@ -0,0 +1,67 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/sweep_and_prune.hpp>
+
+#include "stf/scaffolding/spatial/sweep_and_prune.hpp"
+#include "stf/scaffolding/verify.hpp"
+
+namespace stf::spatial
+{
+
+TEST(sweep_and_prune, overlapping_pairs)
+{
+    std::vector<scaffolding::spatial::sweep_and_prune::overlapping_pairs<float>> tests = {
+        {1, 0, 5.f, 1},
+        {2, 1, 5.f, 1},
+        {3, 100, 5.f, 1},
+        {4, 500, 10.f, 1},
+        {5, 500, 10.f, 4},
+        {6, 1000, 2.f, 7},
+        {7, 200, 100.f, 3},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep_and_prune, incremental)
+{
+    // a row of unit boxes that slide into and out of contact (touching boxes overlap)
+    std::vector<stff::aabb3> spread;
+    std::vector<stff::aabb3> touching;
+    std::vector<stff::aabb3> stacked;
+    for (int i = 0; i < 6; ++i)
+    {
+        spread.push_back(stff::aabb3(stff::vec3(3.f * i, 0, 0), 1.f));
+        touching.push_back(stff::aabb3(stff::vec3(1.f * i, 0, 0), 1.f));
+        stacked.push_back(stff::aabb3(stff::vec3(0.f, 0.f, 0.5f * i), 1.f));
+    }
+    std::vector<stff::aabb3> reversed(spread.rbegin(), spread.rend());
+    std::vector<stff::aabb3> fewer(touching.begin(), touching.begin() + 4);
+
+    std::vector<scaffolding::spatial::sweep_and_prune::incremental<float>> tests = {
+        {{}},
+        {{{}, {}}},
+        {{spread, touching, stacked, spread}},
+        {{touching, reversed, touching}},
+        {{stacked, spread, fewer, touching, fewer}},
+    };
+    scaffolding::verify(tests);
+}
+
+TEST(sweep_and_prune, incremental_random)
+{
+    std::vector<scaffolding::spatial::sweep_and_prune::incremental_random<float>> tests = {
+        {1, 2, 5.f, 1.f, 20, 1},
+        {2, 100, 5.f, 0.5f, 20, 1},
+        {3, 500, 10.f, 0.25f, 10, 1},
+        {4, 300, 10.f, 5.f, 10, 1},
+        {5, 300, 1.f, 0.f, 5, 1},
+        {6, 300, 5.f, 0.5f, 10, 3},
+        {7, 300, 10.f, 5.f, 10, 4},
+    };
+    scaffolding::verify(tests);
+}
+
+} // namespace stf::spatial
\ No newline at end of file
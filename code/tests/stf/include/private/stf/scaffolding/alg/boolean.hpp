@@ -0,0 +1,143 @@
+#ifndef STF_SCAFFOLDING_ALG_BOOLEAN_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_BOOLEAN_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/alg/boolean.hpp>
+#include <stf/geom/holygon.hpp>
+#include <stf/geom/polygon.hpp>
+
+#include "stf/scaffolding/random.hpp"
+
+namespace stf::scaffolding::alg::boolean
+{
+
+template <typename T>
+T total_area(std::vector<stf::geom::holygon<T>> const& holygons)
+{
+    T area = stf::math::constants<T>::zero;
+    for (stf::geom::holygon<T> const& holygon : holygons)
+    {
+        area += holygon.area();
+    }
+    return area;
+}
+
+template <typename T>
+struct areas
+{
+    std::vector<stf::geom::holygon<T>> lhs;
+    std::vector<stf::geom::holygon<T>> rhs;
+    stf::boolean_types type;
+    size_t count;
+    size_t holes;
+    T area;
+
+    void verify(size_t const i) const
+    {
+        std::vector<stf::geom::holygon<T>> const result = stf::alg::boolean(
+            std::span<stf::geom::holygon<T> const>(lhs), std::span<stf::geom::holygon<T> const>(rhs), type);
+
+        ASSERT_EQ(count, result.size()) << info(i) << "failed to compute the correct number of holygons";
+        size_t hole_count = 0;
+        for (stf::geom::holygon<T> const& holygon : result)
+        {
+            ASSERT_LT(stf::math::constants<T>::zero, holygon.hull().signed_area()) << info(i) << "hull is not ccw";
+            for (stf::geom::polygon<T> const& hole : holygon.holes())
+            {
+                ASSERT_GT(stf::math::constants<T>::zero, hole.signed_area()) << info(i) << "hole is not cw";
+            }
+            hole_count += holygon.holes().size();
+        }
+        ASSERT_EQ(holes, hole_count) << info(i) << "failed to compute the correct number of holes";
+        ASSERT_NEAR(area, total_area(result), stf::math::constants<T>::tol) << info(i) << "failed area test";
+    }
+};
+
+// computes boolean operations on sets of random star-shaped polygons (with holes) and checks containment of random
+// points against the definition of each operation along with the inclusion-exclusion identity for areas
+template <typename T>
+struct random
+{
+    uint32_t seed;
+    size_t features;
+    size_t vertices;
+    size_t queries;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-3), T(3));
+        auto star = [&](stf::math::vec2<T> const& center, T const min, T const max)
+        { return stf::scaffolding::star(gen, center, vertices, min, max); };
+        auto build = [&]()
+        {
+            std::vector<stf::geom::holygon<T>> holygons;
+            for (size_t k = 0; k < features; ++k)
+            {
+                stf::math::vec2<T> const center(position(gen), position(gen));
+                holygons.push_back(stf::geom::holygon<T>(star(center, T(1), T(2)), {star(center, T(0.2), T(0.5))}));
+            }
+            return holygons;
+        };
+
+        std::vector<stf::geom::holygon<T>> const lhs = build();
+        std::vector<stf::geom::holygon<T>> const rhs = build();
+        std::vector<stf::geom::holygon<T>> const none;
+        auto apply = [](std::vector<stf::geom::holygon<T>> const& a, std::vector<stf::geom::holygon<T>> const& b,
+                        stf::boolean_types const type)
+        {
+            return stf::alg::boolean(std::span<stf::geom::holygon<T> const>(a),
+                                     std::span<stf::geom::holygon<T> const>(b), type);
+        };
+        auto contains = [](std::vector<stf::geom::holygon<T>> const& holygons, stf::math::vec2<T> const& point)
+        {
+            for (stf::geom::holygon<T> const& holygon : holygons)
+            {
+                if (holygon.contains(point, stf::boundary_types::closed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        std::vector<stf::boolean_types> const types = {stf::boolean_types::unite, stf::boolean_types::intersect,
+                                                      stf::boolean_types::subtract, stf::boolean_types::exclusive_or};
+        std::vector<std::vector<stf::geom::holygon<T>>> results;
+        for (stf::boolean_types const type : types)
+        {
+            results.push_back(apply(lhs, rhs, type));
+        }
+
+        for (size_t k = 0; k < queries; ++k)
+        {
+            stf::math::vec2<T> const point(T(1.5) * position(gen), T(1.5) * position(gen));
+            bool const a = contains(lhs, point);
+            bool const b = contains(rhs, point);
+            ASSERT_EQ(a || b, contains(results[0], point)) << info(i) << "failed union containment " << k;
+            ASSERT_EQ(a && b, contains(results[1], point)) << info(i) << "failed intersection containment " << k;
+            ASSERT_EQ(a && !b, contains(results[2], point)) << info(i) << "failed difference containment " << k;
+            ASSERT_EQ(a != b, contains(results[3], point)) << info(i) << "failed xor containment " << k;
+        }
+
+        T const tol = T(1000) * stf::math::constants<T>::tol;
+        T const a = total_area(apply(lhs, none, stf::boolean_types::unite));
+        T const b = total_area(apply(rhs, none, stf::boolean_types::unite));
+        T const unite = total_area(results[0]);
+        T const intersect = total_area(results[1]);
+        ASSERT_NEAR(a + b, unite + intersect, tol) << info(i) << "failed inclusion-exclusion";
+        ASSERT_NEAR(a - intersect, total_area(results[2]), tol) << info(i) << "failed difference area";
+        ASSERT_NEAR(unite - intersect, total_area(results[3]), tol) << info(i) << "failed xor area";
+    }
+};
+
+} // namespace stf::scaffolding::alg::boolean
+
+#endif
\ No newline at end of file
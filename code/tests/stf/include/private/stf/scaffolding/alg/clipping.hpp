@@ -1,11 +1,20 @@
 #ifndef STF_SCAFFOLDING_ALG_CLIPPING_HPP_HEADER_GUARD
 #define STF_SCAFFOLDING_ALG_CLIPPING_HPP_HEADER_GUARD
 
+#include <cmath>
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <stf/stf.hpp>
 #include <stf/alg/clipping.hpp>
 
+#include "stf/scaffolding/random.hpp"
+
 namespace stf::scaffolding::alg::clipping
 {
 
@@ -56,6 +65,242 @@ struct polyline
             ASSERT_EQ(expected[i], clipped[i])
                 << info(index) << "Failed equality test for " << i << "th clipped sub-polyline";
         }
+
+        stf::alg::clip_buffer<T> buffer;
+        buffer.vertices.push_back(stf::math::vec2<T>(42)); // clipping must append to the buffer
+        buffer.offsets.push_back(1);
+        buffer.features.push_back(1);
+        stf::alg::clip(box, input, buffer);
+
+        ASSERT_EQ(2, buffer.feature_count()) << info(index) << "Failed to append a single feature";
+        ASSERT_EQ(expected.size(), buffer.features[2] - buffer.features[1])
+            << info(index) << "Failed to clip polyline to correct number of parts";
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            std::span<stf::math::vec2<T> const> const part = buffer.part(buffer.features[1] + i);
+            ASSERT_EQ(expected[i].vertices(), std::vector<stf::math::vec2<T>>(part.begin(), part.end()))
+                << info(index) << "Failed equality test for " << i << "th clipped part";
+        }
+    }
+};
+
+template <typename T, typename shape_t>
+struct fill
+{
+    stf::geom::aabb2<T> box;
+    shape_t input;
+    std::vector<std::vector<stf::math::vec2<T>>> expected;
+
+    void verify(size_t const index) const
+    {
+        stf::alg::clip_buffer<T> buffer;
+        buffer.vertices.push_back(stf::math::vec2<T>(42)); // clipping must append to the buffer
+        buffer.offsets.push_back(1);
+        buffer.features.push_back(1);
+        stf::alg::clip(box, input, buffer);
+
+        ASSERT_EQ(2, buffer.feature_count()) << info(index) << "Failed to append a single feature";
+        ASSERT_EQ(expected.size(), buffer.features[2] - buffer.features[1])
+            << info(index) << "Failed to clip to the correct number of parts";
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            // parts are compared up to the choice of starting vertex
+            std::span<stf::math::vec2<T> const> const part = buffer.part(buffer.features[1] + i);
+            std::vector<stf::math::vec2<T>> clipped(part.begin(), part.end());
+            auto start = std::find(clipped.begin(), clipped.end(), expected[i].front());
+            std::rotate(clipped.begin(), (start == clipped.end()) ? clipped.begin() : start, clipped.end());
+            ASSERT_EQ(expected[i], clipped) << info(index) << "Failed equality test for " << i << "th clipped part";
+        }
+    }
+};
+
+// clips a star-shaped holygon (and batches of star-shaped polygons and their boundaries) to a grid of tiles that covers
+// them and checks that the clipped areas and lengths sum to the original areas and lengths
+template <typename T>
+struct tiled
+{
+    uint32_t seed;
+    size_t vertices;
+    size_t tiles;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        auto star = [&](T const min, T const max)
+        { return stf::scaffolding::star(gen, stf::math::vec2<T>(0), vertices, min, max); };
+
+        std::vector<stf::geom::polygon<T>> const polygons = {star(T(1), T(2)), star(T(0.2), T(0.5))};
+        std::vector<stf::geom::holygon<T>> const holygons = {stf::geom::holygon<T>(polygons[0], {polygons[1]})};
+        std::vector<stf::geom::polyline2<T>> polylines;
+        for (stf::geom::polygon<T> const& polygon : polygons)
+        {
+            std::vector<stf::math::vec2<T>> boundary = polygon.vertices();
+            boundary.push_back(boundary.front());
+            polylines.push_back(stf::geom::polyline2<T>(boundary));
+        }
+        auto area = [](std::span<stf::math::vec2<T> const> const part)
+        {
+            return stf::geom::polygon<T>(std::vector<stf::math::vec2<T>>(part.begin(), part.end())).area();
+        };
+
+        T const size = T(4) / static_cast<T>(tiles);
+        std::vector<T> polygon_areas(polygons.size(), stf::math::constants<T>::zero);
+        T holygon_area = stf::math::constants<T>::zero;
+        std::vector<T> lengths(polylines.size(), stf::math::constants<T>::zero);
+        stf::alg::clip_buffer<T> buffer;
+        for (size_t x = 0; x < tiles; ++x)
+        {
+            for (size_t y = 0; y < tiles; ++y)
+            {
+                stf::math::vec2<T> const min = stf::math::vec2<T>(T(-2)) + size * stf::math::vec2<T>(T(x), T(y));
+                stf::geom::aabb2<T> const box(min, min + stf::math::vec2<T>(size));
+
+                stf::alg::clip(box, std::span<stf::geom::polygon<T> const>(polygons), buffer);
+                ASSERT_EQ(polygons.size(), buffer.feature_count()) << info(i) << "Failed polygon feature count";
+                for (size_t f = 0; f < buffer.feature_count(); ++f)
+                {
+                    for (size_t p = buffer.features[f]; p < buffer.features[f + 1]; ++p)
+                    {
+                        for (stf::math::vec2<T> const& vertex : buffer.part(p))
+                        {
+                            ASSERT_TRUE(box.contains(vertex)) << info(i) << "Failed to clip vertex to box";
+                        }
+                        polygon_areas[f] += area(buffer.part(p));
+                    }
+                }
+
+                stf::alg::clip(box, std::span<stf::geom::polyline2<T> const>(polylines), buffer);
+                ASSERT_EQ(polylines.size(), buffer.feature_count()) << info(i) << "Failed polyline feature count";
+                for (size_t f = 0; f < buffer.feature_count(); ++f)
+                {
+                    for (size_t p = buffer.features[f]; p < buffer.features[f + 1]; ++p)
+                    {
+                        std::span<stf::math::vec2<T> const> const part = buffer.part(p);
+                        for (size_t v = 0; v + 1 < part.size(); ++v)
+                        {
+                            lengths[f] += (part[v + 1] - part[v]).length();
+                        }
+                    }
+                }
+
+                stf::alg::clip(box, std::span<stf::geom::holygon<T> const>(holygons), buffer);
+                ASSERT_EQ(1, buffer.feature_count()) << info(i) << "Failed holygon feature count";
+                for (size_t p = buffer.features[0]; p < buffer.features[1]; ++p)
+                {
+                    holygon_area += (p == buffer.features[0]) ? area(buffer.part(p)) : -area(buffer.part(p));
+                }
+            }
+        }
+
+        T const tol = stf::math::constants<T>::tol;
+        ASSERT_NEAR(polygons[0].area(), polygon_areas[0], tol) << info(i) << "Failed tiled polygon area";
+        ASSERT_NEAR(polygons[1].area(), polygon_areas[1], tol) << info(i) << "Failed tiled polygon area";
+        ASSERT_NEAR(holygons[0].area(), holygon_area, tol) << info(i) << "Failed tiled holygon area";
+        ASSERT_NEAR(polylines[0].length(), lengths[0], tol) << info(i) << "Failed tiled polyline length";
+        ASSERT_NEAR(polylines[1].length(), lengths[1], tol) << info(i) << "Failed tiled polyline length";
+    }
+};
+
+template <typename T>
+struct homogeneous
+{
+    stf::math::mtx4<T> view_proj;
+    stf::depth_range_types depth;
+    stf::geom::segment3<T> input;
+    bool accept;
+    stf::geom::segment3<T> expected;
+
+    void verify(size_t const i) const
+    {
+        stf::geom::segment3<T> clipped = input;
+        ASSERT_EQ(accept, stf::alg::clip(view_proj, clipped, depth)) << info(i) << "Failed to accept/reject segment";
+        if (accept)
+        {
+            ASSERT_EQ(expected, clipped) << info(i) << "Failed to clip segment";
+        }
+
+        stf::cam::frustum<T> const frustum(view_proj, depth);
+        clipped = input;
+        ASSERT_EQ(accept, stf::alg::clip(frustum, clipped)) << info(i) << "Failed to accept/reject segment (frustum)";
+        if (accept)
+        {
+            ASSERT_EQ(expected, clipped) << info(i) << "Failed to clip segment (frustum)";
+        }
+
+        stf::math::vec4<T> a = view_proj * stf::math::vec4<T>(input.a, stf::math::constants<T>::one);
+        stf::math::vec4<T> b = view_proj * stf::math::vec4<T>(input.b, stf::math::constants<T>::one);
+        ASSERT_EQ(accept, stf::alg::clip(a, b, depth)) << info(i) << "Failed to accept/reject segment (clip space)";
+        if (accept)
+        {
+            ASSERT_EQ(view_proj * stf::math::vec4<T>(expected.a, stf::math::constants<T>::one), a)
+                << info(i) << "Failed to clip segment (clip space)";
+            ASSERT_EQ(view_proj * stf::math::vec4<T>(expected.b, stf::math::constants<T>::one), b)
+                << info(i) << "Failed to clip segment (clip space)";
+        }
+    }
+};
+
+// clips random polylines to a view volume in clip space, with a view-projection matrix, and with a frustum and checks
+// that the three agree and that the clipped vertices are inside the frustum
+template <typename T>
+struct view_volume
+{
+    uint32_t seed;
+    size_t count;
+    size_t vertices;
+    stf::math::mtx4<T> view_proj;
+    stf::depth_range_types depth;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-60), T(60));
+        std::uniform_real_distribution<T> step(T(-20), T(20));
+        std::vector<stf::geom::polyline3<T>> polylines;
+        for (size_t k = 0; k < count; ++k)
+        {
+            std::vector<stf::math::vec3<T>> line = {stf::math::vec3<T>(position(gen), position(gen), position(gen))};
+            for (size_t v = 1; v < vertices; ++v)
+            {
+                line.push_back(line.back() + stf::math::vec3<T>(step(gen), step(gen), step(gen)));
+            }
+            polylines.push_back(stf::geom::polyline3<T>(line));
+        }
+
+        stf::cam::frustum<T> const frustum(view_proj, depth);
+        stf::alg::clip_buffer<T, 3> matrix;
+        stf::alg::clip_buffer<T, 3> planes;
+        stf::alg::clip_buffer<T, 4> homogeneous;
+        stf::alg::clip(view_proj, std::span<stf::geom::polyline3<T> const>(polylines), matrix, depth);
+        stf::alg::clip(frustum, std::span<stf::geom::polyline3<T> const>(polylines), planes);
+        std::vector<stf::math::vec4<T>> strip;
+        for (stf::geom::polyline3<T> const& polyline : polylines)
+        {
+            strip.clear();
+            for (stf::math::vec3<T> const& vertex : polyline.vertices())
+            {
+                strip.push_back(view_proj * stf::math::vec4<T>(vertex, stf::math::constants<T>::one));
+            }
+            stf::alg::clip(std::span<stf::math::vec4<T> const>(strip), homogeneous, depth);
+        }
+
+        ASSERT_EQ(polylines.size(), matrix.feature_count()) << info(i) << "Failed feature count";
+        ASSERT_EQ(matrix.features, planes.features) << info(i) << "Failed to match features (frustum)";
+        ASSERT_EQ(matrix.offsets, planes.offsets) << info(i) << "Failed to match offsets (frustum)";
+        ASSERT_EQ(matrix.features, homogeneous.features) << info(i) << "Failed to match features (clip space)";
+        ASSERT_EQ(matrix.offsets, homogeneous.offsets) << info(i) << "Failed to match offsets (clip space)";
+        ASSERT_LT(0, matrix.part_count()) << info(i) << "Invalid test: no polylines intersect the view volume";
+        for (size_t v = 0; v < matrix.vertices.size(); ++v)
+        {
+            stf::math::vec3<T> const& vertex = matrix.vertices[v];
+            ASSERT_EQ(vertex, planes.vertices[v]) << info(i) << "Failed to match vertex (frustum)";
+            stf::math::vec4<T> const c = view_proj * stf::math::vec4<T>(vertex, stf::math::constants<T>::one);
+            ASSERT_EQ(c, homogeneous.vertices[v]) << info(i) << "Failed to match vertex (clip space)";
+            for (stf::geom::plane<T> const& plane : frustum.planes())
+            {
+                ASSERT_LE(-stf::math::constants<T>::tol, plane.side(vertex)) << info(i) << "Failed to clip vertex";
+            }
+        }
     }
 };
 
@@ -0,0 +1,107 @@
+#ifndef STF_SCAFFOLDING_ALG_CONTAINMENT_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_CONTAINMENT_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/alg/containment.hpp>
+#include <stf/geom/holygon.hpp>
+#include <stf/geom/polygon.hpp>
+
+#include "stf/scaffolding/random.hpp"
+
+namespace stf::scaffolding::alg::containment
+{
+
+// the classification that the per-point containment queries of a shape imply
+template <typename shape_t, typename T>
+stf::containment_types expected(shape_t const& shape, stf::math::vec2<T> const& point)
+{
+    if (shape.contains(point, stf::boundary_types::open))
+    {
+        return stf::containment_types::inside;
+    }
+    bool const closed = shape.contains(point, stf::boundary_types::closed);
+    return closed ? stf::containment_types::boundary : stf::containment_types::outside;
+}
+
+template <typename T, typename shape_t>
+struct classify
+{
+    shape_t shape;
+    std::vector<stf::math::vec2<T>> points;
+    std::vector<stf::containment_types> classes;
+
+    void verify(size_t const i) const
+    {
+        for (size_t threads : {1, 3})
+        {
+            std::vector<stf::containment_types> computed(points.size(), stf::containment_types::inside);
+            stf::alg::classify<T>(shape, points, computed, threads);
+            ASSERT_EQ(classes, computed) << info(i) << "failed to classify with " << threads << " threads";
+        }
+    }
+};
+
+// builds a star-shaped holygon with star-shaped holes and compares the batch classification against the containment
+// queries of the holygon (and its hull)
+template <typename T>
+struct random
+{
+    uint32_t seed;
+    size_t vertices;
+    size_t holes;
+    size_t queries;
+    size_t threads;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        auto star = [&](stf::math::vec2<T> const& center, T const min, T const max)
+        { return stf::scaffolding::star(gen, center, vertices, min, max); };
+
+        // the holes are placed on a ring around the origin so that they are disjoint
+        stf::geom::polygon<T> const hull = star(stf::math::vec2<T>(0), T(3), T(4));
+        std::vector<stf::geom::polygon<T>> cutouts;
+        for (size_t k = 0; k < holes; ++k)
+        {
+            T const theta = stf::math::constants<T>::two_pi * static_cast<T>(k) / static_cast<T>(holes);
+            stf::math::vec2<T> const center = T(2) * stf::math::vec2<T>(std::cos(theta), std::sin(theta));
+            cutouts.push_back(star(center, T(0.1), T(0.2)));
+        }
+        stf::geom::holygon<T> const holygon(hull, cutouts);
+
+        std::uniform_real_distribution<T> position(T(-4.5), T(4.5));
+        std::vector<stf::math::vec2<T>> points = hull.vertices();
+        for (stf::geom::polygon<T> const& hole : cutouts)
+        {
+            points.insert(points.end(), hole.vertices().begin(), hole.vertices().end());
+        }
+        for (size_t k = 0; k < queries; ++k)
+        {
+            points.push_back(stf::math::vec2<T>(position(gen), position(gen)));
+        }
+
+        std::vector<stf::containment_types> classes(points.size());
+        stf::alg::classify<T>(hull, points, classes, threads);
+        for (size_t k = 0; k < points.size(); ++k)
+        {
+            ASSERT_EQ(expected(hull, points[k]), classes[k]) << info(i) << "failed to classify polygon query " << k;
+        }
+
+        stf::alg::classify<T>(holygon, points, classes, threads);
+        for (size_t k = 0; k < points.size(); ++k)
+        {
+            ASSERT_EQ(expected(holygon, points[k]), classes[k]) << info(i) << "failed to classify holygon query " << k;
+        }
+    }
+};
+
+} // namespace stf::scaffolding::alg::containment
+
+#endif
\ No newline at end of file
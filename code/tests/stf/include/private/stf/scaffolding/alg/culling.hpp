@@ -0,0 +1,55 @@
+#ifndef STF_SCAFFOLDING_ALG_CULLING_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_CULLING_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/culling.hpp>
+
+namespace stf::scaffolding::alg::culling
+{
+
+template <typename T>
+struct tree
+{
+    std::vector<stf::geom::aabb3<T>> boxes;
+    std::vector<std::vector<size_t>> kids;
+
+    stf::geom::aabb3<T> const& bounds(size_t const node) const { return boxes[node]; }
+    std::vector<size_t> const& children(size_t const node) const { return kids[node]; }
+};
+
+template <typename T>
+struct hierarchy
+{
+    stf::cam::frustum<T> frustum;
+    tree<T> hierarchy;
+    std::vector<std::pair<size_t, stf::intersection_types>> expected;
+    std::vector<std::pair<size_t, size_t>> expected_hints;
+
+    void verify(size_t const i) const
+    {
+        std::vector<size_t> hints;
+        for (size_t frame = 0; frame < 2; ++frame) // the second frame starts from the cached hints
+        {
+            std::vector<std::pair<size_t, stf::intersection_types>> visited;
+            stf::alg::cull(frustum, hierarchy, 0, hints,
+                           [&visited](size_t node, stf::intersection_types type) { visited.push_back({node, type}); });
+            std::sort(visited.begin(), visited.end());
+
+            ASSERT_EQ(expected, visited) << info(i) << "Failed to cull hierarchy in frame " << frame;
+            for (std::pair<size_t, size_t> const& hint : expected_hints)
+            {
+                ASSERT_EQ(hint.second, hints[hint.first]) << info(i) << "Failed to cache hint for node " << hint.first;
+            }
+        }
+    }
+};
+
+} // namespace stf::scaffolding::alg::culling
+
+#endif
\ No newline at end of file
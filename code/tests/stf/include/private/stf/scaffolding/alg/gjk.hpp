@@ -0,0 +1,184 @@
+#ifndef STF_SCAFFOLDING_ALG_GJK_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_GJK_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/gjk.hpp>
+#include <stf/alg/intersects.hpp>
+
+namespace stf::scaffolding::alg::gjk
+{
+
+template <typename T, typename lhs_t, typename rhs_t>
+struct distance
+{
+    lhs_t lhs;
+    rhs_t rhs;
+    bool intersecting;
+    T expected;
+
+    void verify(size_t const i) const
+    {
+        T const tol = T(0.0001);
+
+        stf::alg::gjk_simplex<T> simplex;
+        stf::alg::gjk_result<T> const result = stf::alg::gjk(lhs, rhs, simplex);
+        ASSERT_EQ(intersecting, result.intersecting) << info(i) << "Failed to compute intersection";
+        ASSERT_NEAR(expected, result.distance, tol) << info(i) << "Failed to compute distance";
+        ASSERT_NEAR(result.distance, math::dist(result.lhs_point, result.rhs_point), tol)
+            << info(i) << "Failed to compute closest points that realize the distance";
+        ASSERT_EQ(intersecting, (stf::alg::gjk_intersects<T>(lhs, rhs))) << info(i) << "Failed boolean query";
+
+        // a warm-started query of the same pair must agree and converge at least as quickly
+        stf::alg::gjk_result<T> const warm = stf::alg::gjk(lhs, rhs, simplex);
+        ASSERT_EQ(result.intersecting, warm.intersecting) << info(i) << "Failed warm-started intersection";
+        ASSERT_NEAR(result.distance, warm.distance, tol) << info(i) << "Failed warm-started distance";
+        ASSERT_LE(warm.iterations, result.iterations) << info(i) << "Failed to benefit from warm-starting";
+    }
+};
+
+template <typename T, typename lhs_t, typename rhs_t>
+struct penetration
+{
+    lhs_t lhs;
+    rhs_t rhs;
+    T depth;
+    math::vec3<T> normal;
+
+    void verify(size_t const i) const
+    {
+        T const tol = T(0.001);
+
+        stf::alg::epa_result<T> const result = stf::alg::epa<T>(lhs, rhs);
+        ASSERT_TRUE(result.intersecting) << info(i) << "Failed to compute intersection";
+        ASSERT_NEAR(depth, result.depth, tol) << info(i) << "Failed to compute depth";
+        ASSERT_NEAR(T(0), math::dist(normal, result.normal), T(0.01)) << info(i) << "Failed to compute normal";
+        ASSERT_NEAR(T(0), math::dist(result.lhs_point - result.rhs_point, result.depth * result.normal), tol)
+            << info(i) << "Failed to compute contact points that realize the depth";
+    }
+};
+
+template <typename T>
+struct random_obbs
+{
+    uint32_t seed;
+    size_t count;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-4), T(4));
+        std::uniform_real_distribution<T> extent(T(0.5), T(3));
+        std::uniform_real_distribution<T> angle(T(0), math::constants<T>::two_pi);
+        auto random_obb = [&]()
+        {
+            math::vec3<T> const axis = math::normalized(math::vec3<T>(position(gen), position(gen), position(gen)));
+            math::mtx<T, 3> const rotation = math::rotate(axis, angle(gen)).prefix();
+            math::vec3<T> const center(position(gen), position(gen), position(gen));
+            return geom::obb3<T>(center, rotation, math::vec3<T>(extent(gen), extent(gen), extent(gen)));
+        };
+
+        for (size_t k = 0; k < count; ++k)
+        {
+            geom::obb3<T> lhs = random_obb();
+            geom::obb3<T> const rhs = random_obb();
+            bool const expected = stf::alg::intersects(lhs, rhs);
+            ASSERT_EQ(expected, (stf::alg::gjk_intersects<T>(lhs, rhs))) << info(i) << "Failed pair " << k;
+
+            stf::alg::epa_result<T> const result = stf::alg::epa<T>(lhs, rhs);
+            ASSERT_EQ(expected, result.intersecting) << info(i) << "Failed to compute intersection of pair " << k;
+            if (result.intersecting)
+            {
+                // translating by slightly more than the depth along the normal separates the boxes
+                ASSERT_LE(T(0), result.depth) << info(i) << "Failed to compute a non-negative depth of pair " << k;
+                lhs = geom::obb3<T>(lhs.center() - (result.depth + T(0.01)) * result.normal, lhs.basis(),
+                                    lhs.half_extents());
+                ASSERT_FALSE(stf::alg::intersects(lhs, rhs)) << info(i) << "Failed to separate pair " << k;
+            }
+        }
+    }
+};
+
+template <typename T>
+struct random_aabbs
+{
+    uint32_t seed;
+    size_t count;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-4), T(4));
+        std::uniform_real_distribution<T> extent(T(0.5), T(3));
+        auto random_aabb = [&]()
+        {
+            math::vec3<T> const min(position(gen), position(gen), position(gen));
+            return geom::aabb3<T>(min, min + math::vec3<T>(extent(gen), extent(gen), extent(gen)));
+        };
+
+        T const tol = T(0.001);
+        for (size_t k = 0; k < count; ++k)
+        {
+            geom::aabb3<T> const lhs = random_aabb();
+            geom::aabb3<T> const rhs = random_aabb();
+
+            // the distance accumulates the gaps along each axis and the depth is the smallest overlap
+            T distance_squared = T(0);
+            T depth = math::constants<T>::pos_inf;
+            for (size_t d = 0; d < 3; ++d)
+            {
+                T const gap = std::max(lhs.min[d] - rhs.max[d], rhs.min[d] - lhs.max[d]);
+                distance_squared += (gap > T(0)) ? gap * gap : T(0);
+                depth = std::min(depth, -gap);
+            }
+
+            stf::alg::gjk_result<T> const result = stf::alg::gjk<T>(lhs, rhs);
+            ASSERT_EQ(lhs.intersects(rhs), result.intersecting) << info(i) << "Failed to intersect pair " << k;
+            ASSERT_NEAR(std::sqrt(distance_squared), result.distance, tol) << info(i) << "Failed distance " << k;
+            if (result.intersecting)
+            {
+                stf::alg::epa_result<T> const penetration = stf::alg::epa<T>(lhs, rhs);
+                ASSERT_NEAR(depth, penetration.depth, tol) << info(i) << "Failed to compute depth of pair " << k;
+            }
+        }
+    }
+};
+
+template <typename T>
+struct warm_start
+{
+    geom::obb3<T> obb;
+    geom::sphere<T> sphere;
+    math::vec3<T> velocity;
+    size_t frames;
+
+    void verify(size_t const i) const
+    {
+        T const tol = T(0.0001);
+
+        size_t cold_iterations = 0;
+        size_t warm_iterations = 0;
+        stf::alg::gjk_simplex<T> simplex;
+        geom::sphere<T> moving = sphere;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            stf::alg::gjk_result<T> const cold = stf::alg::gjk<T>(obb, moving);
+            stf::alg::gjk_result<T> const warm = stf::alg::gjk(obb, moving, simplex);
+            ASSERT_EQ(cold.intersecting, warm.intersecting) << info(i) << "Failed intersection at frame " << f;
+            ASSERT_NEAR(cold.distance, warm.distance, tol) << info(i) << "Failed distance at frame " << f;
+            cold_iterations += cold.iterations;
+            warm_iterations += warm.iterations;
+            moving.center += velocity;
+        }
+        ASSERT_LT(warm_iterations, cold_iterations) << info(i) << "Failed to reduce iterations by warm-starting";
+    }
+};
+
+} // namespace stf::scaffolding::alg::gjk
+
+#endif
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef STF_SCAFFOLDING_ALG_PARALLEL_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_PARALLEL_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/alg/parallel.hpp>
+
+namespace stf::scaffolding::alg::parallel
+{
+
+struct parallel_for
+{
+    size_t count;
+    size_t threads;
+
+    void verify(size_t const i) const
+    {
+        std::vector<size_t> visits(count, 0);
+        std::vector<size_t> owners(count, 0);
+        stf::alg::parallel_for(count, threads,
+                               [&](size_t const begin, size_t const end, size_t const thread)
+                               {
+                                   for (size_t j = begin; j < end; ++j)
+                                   {
+                                       ++visits[j];
+                                       owners[j] = thread;
+                                   }
+                               });
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            ASSERT_EQ(1, visits[j]) << info(i) << "Failed to visit index " << j << " exactly once";
+        }
+
+        // chunks are contiguous and assigned to threads in order
+        ASSERT_TRUE(std::is_sorted(owners.begin(), owners.end())) << info(i) << "Failed to assign contiguous chunks";
+        size_t const expected = std::min(std::max(threads, static_cast<size_t>(1)), count);
+        size_t const used = (count == 0) ? 0 : owners.back() + 1;
+        ASSERT_EQ(expected, used) << info(i) << "Failed to use the expected number of threads";
+    }
+};
+
+struct parallel_sort
+{
+    size_t count;
+    size_t threads;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(static_cast<uint32_t>(count));
+        std::uniform_int_distribution<int> dist(-50, 50);
+        std::vector<int> values(count);
+        std::generate(values.begin(), values.end(), [&]() { return dist(gen); });
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+        stf::alg::parallel_sort(values, threads, std::less<int>());
+        ASSERT_EQ(expected, values) << info(i) << "Failed to sort";
+    }
+};
+
+struct parallel_exclusive_scan
+{
+    size_t count;
+    size_t threads;
+
+    void verify(size_t const i) const
+    {
+        std::vector<size_t> values(count);
+        std::iota(values.begin(), values.end(), static_cast<size_t>(1));
+        size_t const total = stf::alg::parallel_exclusive_scan(values, threads);
+        ASSERT_EQ(count * (count + 1) / 2, total) << info(i) << "Failed to compute the total";
+        for (size_t j = 0; j < count; ++j)
+        {
+            ASSERT_EQ(j * (j + 1) / 2, values[j]) << info(i) << "Failed to scan index " << j;
+        }
+    }
+};
+
+} // namespace stf::scaffolding::alg::parallel
+
+#endif
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef STF_SCAFFOLDING_ALG_RAY_PACKET_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_RAY_PACKET_HPP_HEADER_GUARD
+
+#include <array>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include <stf/alg/ray_packet.hpp>
+
+namespace stf::scaffolding::alg::ray_packet
+{
+
+template <typename T, size_t W>
+struct aabb
+{
+    std::vector<stf::geom::ray3<T>> rays;
+    stf::geom::aabb3<T> box;
+
+    void verify(size_t const i) const
+    {
+        stf::alg::ray_packet<T, W> packet(rays);
+        std::array<T, W> t_max;
+        t_max.fill(math::constants<T>::pos_inf);
+        std::array<T, W> t_near;
+        uint32_t const hits = stf::alg::raycast(packet, box, t_max, packet.mask, t_near);
+        for (size_t l = 0; l < W; ++l)
+        {
+            std::optional<T> const expected =
+                (l < rays.size()) ? stf::alg::raycast(rays[l], box) : std::optional<T>(std::nullopt);
+            ASSERT_EQ(expected.has_value(), ((hits >> l) & 1) == 1) << info(i) << "Failed to cast lane " << l;
+            if (expected)
+            {
+                ASSERT_NEAR(*expected, t_near[l], math::constants<T>::tol) << info(i) << "Failed to cast lane " << l;
+            }
+        }
+    }
+};
+
+// casts packets of random rays through the vertices and edges of a triangle fan and compares each lane against the
+// single ray test (the fan covers the origin so every lane should hit at least one triangle)
+template <typename T, size_t W>
+struct watertight
+{
+    uint32_t seed;
+    size_t count;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> dist(T(-1), T(1));
+        std::vector<math::vec3<T>> fan;
+        size_t const sides = 7;
+        for (size_t k = 0; k < sides; ++k)
+        {
+            T const theta = math::constants<T>::two_pi * static_cast<T>(k) / static_cast<T>(sides);
+            fan.push_back(math::vec3<T>(std::cos(theta), std::sin(theta), dist(gen) * T(0.1)));
+        }
+        math::vec3<T> const center(T(0.01), T(-0.02), T(0.03));
+
+        for (size_t n = 0; n < count; ++n)
+        {
+            // aim each lane at either the center vertex or a point on a spoke of the fan
+            std::vector<stf::geom::ray3<T>> rays;
+            for (size_t l = 0; l < W; ++l)
+            {
+                math::vec3<T> const spoke = fan[(n + l) % sides];
+                T const s = (l % 2 == 0) ? T(0) : (dist(gen) + T(1)) * T(0.4);
+                math::vec3<T> const target = center + s * (spoke - center);
+                math::vec3<T> const origin(dist(gen), dist(gen), T(5) + dist(gen));
+                rays.push_back(stf::geom::ray3<T>(origin, target - origin));
+            }
+
+            stf::alg::ray_packet<T, W> const packet(rays);
+            std::array<T, W> t;
+            t.fill(math::constants<T>::pos_inf);
+            uint32_t hits = 0;
+            for (size_t k = 0; k < sides; ++k)
+            {
+                math::vec3<T> const& a = fan[k];
+                math::vec3<T> const& b = fan[(k + 1) % sides];
+                std::array<T, W> before = t;
+                uint32_t const lanes = stf::alg::raycast(packet, center, a, b, packet.mask, t);
+                hits |= lanes;
+                for (size_t l = 0; l < W; ++l)
+                {
+                    std::optional<T> const expected = stf::alg::raycast(rays[l], center, a, b, before[l]);
+                    ASSERT_EQ(expected.has_value(), ((lanes >> l) & 1) == 1)
+                        << info(i) << "Failed to match the single ray test in packet " << n << " lane " << l;
+                    if (expected)
+                    {
+                        ASSERT_EQ(*expected, t[l]) << info(i) << "Failed to match the distance in lane " << l;
+                    }
+                }
+            }
+            ASSERT_EQ(packet.mask, hits) << info(i) << "Failed to hit the fan with packet " << n;
+        }
+    }
+};
+
+template <typename T, size_t W>
+struct mesh
+{
+    std::vector<stf::geom::ray3<T>> rays;
+    std::vector<math::vec3<T>> vertices;
+    std::vector<uint32_t> indices;
+
+    void verify(size_t const i) const
+    {
+        std::vector<stf::geom::aabb3<T>> boxes;
+        for (size_t t = 0; t + 2 < indices.size(); t += 3)
+        {
+            stf::geom::aabb3<T> box = stf::geom::aabb3<T>::nothing();
+            box.fit(vertices[indices[t]]).fit(vertices[indices[t + 1]]).fit(vertices[indices[t + 2]]);
+            boxes.push_back(box);
+        }
+        stf::spatial::bvh<T, 3> tree(boxes, 2);
+
+        stf::alg::ray_packet<T, W> packet(rays);
+        stf::alg::packet_hit<T, W> const nearest = stf::alg::nearest_hit<T, W>(tree, vertices, indices, packet);
+        stf::alg::packet_hit<T, W> const any = stf::alg::any_hit<T, W>(tree, vertices, indices, packet);
+        for (size_t l = 0; l < W; ++l)
+        {
+            std::optional<stf::alg::hit<T>> expected = std::nullopt;
+            if (l < rays.size())
+            {
+                expected = stf::alg::nearest_hit<T>(tree, vertices, indices, stf::alg::prepared_ray<T>(rays[l]));
+            }
+
+            ASSERT_EQ(expected.has_value(), ((nearest.mask >> l) & 1) == 1)
+                << info(i) << "Failed to compute nearest_hit in lane " << l;
+            ASSERT_EQ(expected.has_value(), ((any.mask >> l) & 1) == 1)
+                << info(i) << "Failed to compute any_hit in lane " << l;
+            if (expected)
+            {
+                ASSERT_NEAR(expected->t, nearest.t[l], math::constants<T>::tol)
+                    << info(i) << "Failed to compute nearest_hit in lane " << l;
+            }
+        }
+    }
+};
+
+} // namespace stf::scaffolding::alg::ray_packet
+
+#endif
\ No newline at end of file
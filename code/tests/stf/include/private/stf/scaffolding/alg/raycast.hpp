@@ -0,0 +1,154 @@
+#ifndef STF_SCAFFOLDING_ALG_RAYCAST_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_RAYCAST_HPP_HEADER_GUARD
+
+#include <array>
+#include <optional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include <stf/alg/raycast.hpp>
+
+namespace stf::scaffolding::alg::raycast
+{
+
+template <typename T>
+inline void verify_optional(size_t const i, std::optional<T> const& expected, std::optional<T> const& actual)
+{
+    ASSERT_EQ(expected.has_value(), actual.has_value()) << info(i) << "Failed to compute whether the ray hits";
+    if (expected)
+    {
+        ASSERT_NEAR(*expected, *actual, math::constants<T>::tol) << info(i) << "Failed to compute the ray parameter";
+    }
+}
+
+template <typename T, typename geometry_t>
+struct cast
+{
+    stf::geom::ray3<T> ray;
+    geometry_t geometry;
+    std::optional<T> expected;
+
+    void verify(size_t const i) const
+    {
+        verify_optional(i, expected, stf::alg::raycast(ray, geometry));
+
+        // the batch version (where one exists) must agree with the single ray version
+        std::span<stf::geom::ray3<T> const> const rays(&ray, 1);
+        if constexpr (requires(std::span<T> t) { stf::alg::raycast<T>(rays, geometry, t); })
+        {
+            std::array<T, 1> t;
+            stf::alg::raycast<T>(rays, geometry, t);
+            std::optional<T> const batch = (t[0] == stf::alg::c_ray_miss<T>) ? std::nullopt : std::optional<T>(t[0]);
+            verify_optional(i, expected, batch);
+        }
+    }
+};
+
+template <typename T, typename geometry_t>
+struct batch
+{
+    uint32_t seed;
+    size_t count;
+    geometry_t geometry;
+    T t_max;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-3), T(3));
+        std::uniform_int_distribution<int> axis(0, 5);
+        std::vector<stf::geom::ray3<T>> rays;
+        for (size_t r = 0; r < count; ++r)
+        {
+            math::vec3<T> const origin(position(gen), position(gen), position(gen));
+            math::vec3<T> direction(position(gen), position(gen), position(gen));
+
+            // include rays that are parallel to some of the coordinate planes
+            int const zeroed = axis(gen);
+            if (zeroed < 3)
+            {
+                direction[static_cast<size_t>(zeroed)] = T(0);
+            }
+            rays.push_back(stf::geom::ray3<T>(origin, direction));
+        }
+
+        std::vector<T> t(rays.size());
+        stf::alg::raycast<T>(rays, geometry, t, t_max);
+        for (size_t r = 0; r < rays.size(); ++r)
+        {
+            std::optional<T> const expected = stf::alg::raycast(rays[r], geometry, t_max);
+            std::optional<T> const actual = (t[r] == stf::alg::c_ray_miss<T>) ? std::nullopt : std::optional<T>(t[r]);
+            ASSERT_EQ(expected.has_value(), actual.has_value()) << info(i) << "Failed to compute whether ray " << r
+                                                                << " hits";
+            if (expected)
+            {
+                ASSERT_NEAR(*expected, *actual, math::constants<T>::tol) << info(i) << "Failed parameter of ray " << r;
+            }
+        }
+    }
+};
+
+template <typename T>
+struct triangle
+{
+    stf::geom::ray3<T> ray;
+    math::vec3<T> a;
+    math::vec3<T> b;
+    math::vec3<T> c;
+    std::optional<T> expected;
+
+    void verify(size_t const i) const
+    {
+        verify_optional(i, expected, stf::alg::raycast(ray, a, b, c));
+        verify_optional(i, expected, stf::alg::raycast(ray, c, b, a)); // winding doesn't matter
+    }
+};
+
+template <typename T>
+struct mesh
+{
+    std::vector<math::vec3<T>> vertices;
+    std::vector<uint32_t> indices;
+    stf::geom::ray3<T> ray;
+    std::optional<T> expected;
+
+    void verify(size_t const i) const
+    {
+        std::vector<stf::geom::aabb3<T>> boxes;
+        for (size_t t = 0; t + 2 < indices.size(); t += 3)
+        {
+            boxes.push_back(stf::geom::aabb3<T>::nothing()
+                                .fit(vertices[indices[t]])
+                                .fit(vertices[indices[t + 1]])
+                                .fit(vertices[indices[t + 2]]));
+        }
+        stf::spatial::bvh<T, 3> tree(boxes, 2);
+        stf::alg::prepared_ray<T> prepared(ray);
+
+        std::optional<stf::alg::hit<T>> nearest = stf::alg::nearest_hit<T>(tree, vertices, indices, prepared);
+        ASSERT_EQ(expected.has_value(), nearest.has_value()) << info(i) << "Failed to compute nearest_hit";
+        if (expected)
+        {
+            ASSERT_NEAR(*expected, nearest->t, math::constants<T>::tol) << info(i) << "Failed to compute nearest_hit";
+
+            // the reported primitive should be hit at the reported parameter
+            size_t const t = 3 * nearest->primitive;
+            std::optional<T> const check =
+                stf::alg::raycast(prepared, vertices[indices[t]], vertices[indices[t + 1]], vertices[indices[t + 2]]);
+            ASSERT_TRUE(check.has_value()) << info(i) << "Failed to report the hit primitive";
+            ASSERT_NEAR(nearest->t, *check, math::constants<T>::tol) << info(i) << "Failed to report the hit primitive";
+        }
+
+        std::optional<stf::alg::hit<T>> any = stf::alg::any_hit<T>(tree, vertices, indices, prepared);
+        ASSERT_EQ(expected.has_value(), any.has_value()) << info(i) << "Failed to compute any_hit";
+    }
+};
+
+} // namespace stf::scaffolding::alg::raycast
+
+#endif
\ No newline at end of file
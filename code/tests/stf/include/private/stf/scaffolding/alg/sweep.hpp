@@ -0,0 +1,146 @@
+#ifndef STF_SCAFFOLDING_ALG_SWEEP_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_SWEEP_HPP_HEADER_GUARD
+
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/gjk.hpp>
+#include <stf/alg/sweep.hpp>
+
+namespace stf::scaffolding::alg::sweep
+{
+
+template <typename T, typename moving_t, typename stationary_t>
+struct impact
+{
+    moving_t moving;
+    math::vec3<T> displacement;
+    stationary_t stationary;
+    std::optional<T> expected;
+
+    void verify(size_t const i) const
+    {
+        std::optional<T> const t = stf::alg::time_of_impact(moving, displacement, stationary);
+        ASSERT_EQ(expected.has_value(), t.has_value()) << info(i) << "Failed to compute whether the objects touch";
+        if (expected)
+        {
+            ASSERT_NEAR(*expected, *t, T(0.0001)) << info(i) << "Failed to compute time of impact";
+        }
+    }
+};
+
+// compares the time of impact against the penetration depth of the objects sampled over the frame
+template <typename T, typename moving_t, typename stationary_t>
+struct random
+{
+    uint32_t seed;
+    size_t count;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-4), T(4));
+        std::uniform_real_distribution<T> extent(T(0.2), T(2));
+        auto random_point = [&]() { return math::vec3<T>(position(gen), position(gen), position(gen)); };
+        auto random_object = [&](auto const* tag)
+        {
+            using object_t = std::remove_cv_t<std::remove_pointer_t<decltype(tag)>>;
+            if constexpr (std::is_same_v<object_t, geom::sphere<T>>)
+            {
+                return geom::sphere<T>(random_point(), extent(gen));
+            }
+            else if constexpr (std::is_same_v<object_t, geom::aabb3<T>>)
+            {
+                math::vec3<T> const min = random_point();
+                return geom::aabb3<T>(min, min + math::vec3<T>(extent(gen), extent(gen), extent(gen)));
+            }
+            else
+            {
+                return geom::triangle3<T>(random_point(), random_point(), random_point());
+            }
+        };
+        auto translated = [](moving_t const& object, math::vec3<T> const& delta)
+        {
+            if constexpr (std::is_same_v<moving_t, geom::sphere<T>>)
+            {
+                return geom::sphere<T>(object.center + delta, object.radius);
+            }
+            else
+            {
+                return object.translated(delta);
+            }
+        };
+
+        T const tol = T(0.001);
+        size_t const samples = 64;
+        for (size_t k = 0; k < count; ++k)
+        {
+            moving_t const moving = random_object(static_cast<moving_t const*>(nullptr));
+            stationary_t const stationary = random_object(static_cast<stationary_t const*>(nullptr));
+            math::vec3<T> const displacement = T(2) * random_point();
+            std::optional<T> const t = stf::alg::time_of_impact(moving, displacement, stationary);
+
+            // the objects do not overlap before the time of impact
+            T const end = t.value_or(math::constants<T>::one);
+            for (size_t s = 0; s < samples && end > T(0); ++s)
+            {
+                T const time = end * static_cast<T>(s) / static_cast<T>(samples);
+                stf::alg::epa_result<T> const result = stf::alg::epa<T>(translated(moving, time * displacement),
+                                                                        stationary);
+                ASSERT_LE(result.depth, tol) << info(i) << "Failed to detect overlap of pair " << k << " at " << time;
+            }
+
+            // the objects touch at the time of impact
+            if (t)
+            {
+                ASSERT_LE(T(0), *t) << info(i) << "Failed to compute a time in [0, 1] for pair " << k;
+                ASSERT_LE(*t, T(1)) << info(i) << "Failed to compute a time in [0, 1] for pair " << k;
+                stf::alg::gjk_result<T> const result = stf::alg::gjk<T>(translated(moving, *t * displacement),
+                                                                        stationary);
+                ASSERT_NEAR(T(0), result.distance, tol) << info(i) << "Failed to touch at the time of pair " << k;
+            }
+        }
+    }
+};
+
+template <typename T, typename object_t>
+struct batch
+{
+    std::vector<object_t> objects;
+    std::vector<math::vec3<T>> displacements;
+
+    void verify(size_t const i) const
+    {
+        std::vector<spatial::index_pair> pairs;
+        for (uint32_t lhs = 0; lhs < objects.size(); ++lhs)
+        {
+            for (uint32_t rhs = lhs + 1; rhs < objects.size(); ++rhs)
+            {
+                pairs.push_back({lhs, rhs});
+            }
+        }
+
+        for (size_t threads : {1, 4})
+        {
+            std::vector<T> times(pairs.size());
+            stf::alg::time_of_impact<T>(objects, displacements, pairs, times, threads);
+            for (size_t k = 0; k < pairs.size(); ++k)
+            {
+                auto const [lhs, rhs] = pairs[k];
+                math::vec3<T> const relative = displacements[lhs] - displacements[rhs];
+                std::optional<T> const expected = stf::alg::time_of_impact(objects[lhs], relative, objects[rhs]);
+                ASSERT_EQ(expected.value_or(stf::alg::c_no_impact<T>), times[k])
+                    << info(i) << "Failed pair " << k << " with " << threads << " threads";
+            }
+        }
+    }
+};
+
+} // namespace stf::scaffolding::alg::sweep
+
+#endif
\ No newline at end of file
@@ -0,0 +1,218 @@
+#ifndef STF_SCAFFOLDING_ALG_TILING_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_ALG_TILING_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/alg/clipping.hpp>
+#include <stf/alg/tiling.hpp>
+
+namespace stf::scaffolding::alg::tiling
+{
+
+template <typename T>
+T area(std::span<stf::math::vec2<T> const> const part)
+{
+    return stf::geom::polygon<T>(std::vector<stf::math::vec2<T>>(part.begin(), part.end())).area();
+}
+
+// the area of each feature in a tile (holes are subtracted)
+template <typename T>
+std::vector<T> areas(stf::alg::clip_buffer<T> const& buffer)
+{
+    std::vector<T> result;
+    for (size_t f = 0; f < buffer.feature_count(); ++f)
+    {
+        T total = stf::math::constants<T>::zero;
+        for (size_t p = buffer.features[f]; p < buffer.features[f + 1]; ++p)
+        {
+            total += (p == buffer.features[f]) ? area(buffer.part(p)) : -area(buffer.part(p));
+        }
+        result.push_back(total);
+    }
+    return result;
+}
+
+template <typename T>
+struct polygons
+{
+    stf::alg::tile_grid<T> grid;
+    std::vector<stf::geom::polygon<T>> input;
+    std::vector<std::vector<T>> expected; // the area of each feature in each tile (in row-major order)
+
+    void verify(size_t const i) const
+    {
+        stf::alg::tiler<T> tiler(grid);
+        tiler.tile(std::span<stf::geom::polygon<T> const>(input));
+
+        ASSERT_EQ(expected.size(), grid.count()) << info(i) << "Invalid test: incorrect number of tiles";
+        for (size_t r = 0; r < grid.rows; ++r)
+        {
+            for (size_t c = 0; c < grid.columns; ++c)
+            {
+                std::vector<T> const actual = areas(tiler.at(c, r).clipped);
+                std::vector<T> const& ref = expected[grid.index(c, r)];
+                ASSERT_EQ(ref.size(), actual.size()) << info(i) << "Failed feature count in tile " << c << ", " << r;
+                for (size_t f = 0; f < ref.size(); ++f)
+                {
+                    ASSERT_NEAR(ref[f], actual[f], stf::math::constants<T>::tol)
+                        << info(i) << "Failed area of feature " << f << " in tile " << c << ", " << r;
+                }
+            }
+        }
+    }
+};
+
+// tiles random polylines, polygons, and holygons and compares each tile against clipping each feature to the bounds
+// of the tile. also checks that the output does not depend on the number of threads
+template <typename T>
+struct random
+{
+    uint32_t seed;
+    size_t count;
+    size_t vertices;
+    size_t columns;
+    size_t rows;
+    T buffer;
+    size_t threads;
+
+    static void compare(size_t const i, stf::alg::tile_buffer<T> const& lhs, stf::alg::tile_buffer<T> const& rhs)
+    {
+        ASSERT_EQ(lhs.sources, rhs.sources) << info(i) << "Failed threaded sources";
+        ASSERT_EQ(lhs.clipped.offsets, rhs.clipped.offsets) << info(i) << "Failed threaded offsets";
+        ASSERT_EQ(lhs.clipped.features, rhs.clipped.features) << info(i) << "Failed threaded features";
+        ASSERT_EQ(lhs.clipped.vertices, rhs.clipped.vertices) << info(i) << "Failed threaded vertices";
+    }
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-1), T(11));
+        std::uniform_real_distribution<T> radius(T(0.5), T(3));
+        std::uniform_real_distribution<T> step(T(-1), T(1));
+
+        stf::math::vec2<T> const size(T(10) / static_cast<T>(columns), T(10) / static_cast<T>(rows));
+        stf::alg::tile_grid<T> const grid{stf::math::vec2<T>(T(0)), size, buffer, columns, rows};
+
+        std::vector<stf::geom::polyline2<T>> polylines;
+        std::vector<stf::geom::polygon<T>> polygons;
+        std::vector<stf::geom::holygon<T>> holygons;
+        for (size_t k = 0; k < count; ++k)
+        {
+            stf::math::vec2<T> const center(position(gen), position(gen));
+            T const outer = radius(gen);
+            stf::geom::polygon<T> hull;
+            stf::geom::polygon<T> hole;
+            std::vector<stf::math::vec2<T>> line = {center};
+            for (size_t v = 0; v < vertices; ++v)
+            {
+                T const theta = stf::math::constants<T>::two_pi * static_cast<T>(v) / static_cast<T>(vertices);
+                stf::math::vec2<T> const dir(std::cos(theta), std::sin(theta));
+                T const r = outer * (T(0.6) + T(0.4) * std::abs(step(gen)));
+                hull.push_back(center + r * dir);
+                hole.push_back(center + T(0.3) * r * dir);
+                line.push_back(line.back() + stf::math::vec2<T>(step(gen), step(gen)));
+            }
+            polylines.push_back(stf::geom::polyline2<T>(line));
+            polygons.push_back(hull);
+            holygons.push_back(stf::geom::holygon<T>(hull, {hole}));
+        }
+
+        stf::alg::tiler<T> serial(grid);
+        stf::alg::tiler<T> parallel(grid);
+        T const tol = stf::math::constants<T>::tol;
+
+        // polylines
+        serial.tile(std::span<stf::geom::polyline2<T> const>(polylines));
+        parallel.tile(std::span<stf::geom::polyline2<T> const>(polylines), threads);
+        for (size_t r = 0; r < rows; ++r)
+        {
+            for (size_t c = 0; c < columns; ++c)
+            {
+                stf::alg::tile_buffer<T> const& tile = serial.at(c, r);
+                ASSERT_NO_FATAL_FAILURE(compare(i, tile, parallel.at(c, r)));
+
+                size_t f = 0;
+                for (size_t k = 0; k < polylines.size(); ++k)
+                {
+                    std::vector<stf::geom::polyline2<T>> const expected =
+                        stf::alg::clip(grid.bounds(c, r), polylines[k]);
+                    if (expected.empty())
+                    {
+                        continue;
+                    }
+                    ASSERT_LT(f, tile.sources.size()) << info(i) << "Failed to emit polyline " << k;
+                    ASSERT_EQ(k, tile.sources[f]) << info(i) << "Failed polyline source";
+                    size_t const first = tile.clipped.features[f];
+                    ASSERT_EQ(expected.size(), tile.clipped.features[f + 1] - first) << info(i) << "Failed part count";
+                    for (size_t p = 0; p < expected.size(); ++p)
+                    {
+                        std::span<stf::math::vec2<T> const> const part = tile.clipped.part(first + p);
+                        ASSERT_EQ(expected[p].vertices().size(), part.size()) << info(i) << "Failed part size";
+                        for (size_t v = 0; v < part.size(); ++v)
+                        {
+                            ASSERT_EQ(expected[p][v], part[v]) << info(i) << "Failed polyline vertex";
+                        }
+                    }
+                    ++f;
+                }
+                ASSERT_EQ(f, tile.sources.size()) << info(i) << "Failed polyline feature count";
+            }
+        }
+
+        // polygons and holygons
+        auto check = [&](auto const& shapes)
+        {
+            using shape_t = typename std::decay_t<decltype(shapes)>::value_type;
+            serial.tile(std::span<shape_t const>(shapes));
+            parallel.tile(std::span<shape_t const>(shapes), threads);
+            stf::alg::clip_buffer<T> reference;
+            for (size_t r = 0; r < rows; ++r)
+            {
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    stf::alg::tile_buffer<T> const& tile = serial.at(c, r);
+                    ASSERT_NO_FATAL_FAILURE(compare(i, tile, parallel.at(c, r)));
+
+                    std::vector<T> const actual = areas(tile.clipped);
+                    size_t f = 0;
+                    for (size_t k = 0; k < shapes.size(); ++k)
+                    {
+                        reference.clear();
+                        stf::alg::clip(grid.bounds(c, r), shapes[k], reference);
+                        if (reference.part_count() == 0)
+                        {
+                            continue;
+                        }
+                        ASSERT_LT(f, tile.sources.size()) << info(i) << "Failed to emit shape " << k;
+                        ASSERT_EQ(k, tile.sources[f]) << info(i) << "Failed shape source";
+                        ASSERT_EQ(reference.part_count(), tile.clipped.features[f + 1] - tile.clipped.features[f])
+                            << info(i) << "Failed ring count";
+                        ASSERT_NEAR(areas(reference)[0], actual[f], tol) << info(i) << "Failed shape area";
+                        for (size_t p = tile.clipped.features[f]; p < tile.clipped.features[f + 1]; ++p)
+                        {
+                            for (stf::math::vec2<T> const& vertex : tile.clipped.part(p))
+                            {
+                                ASSERT_TRUE(grid.bounds(c, r).contains(vertex)) << info(i) << "Failed vertex bounds";
+                            }
+                        }
+                        ++f;
+                    }
+                    ASSERT_EQ(f, tile.sources.size()) << info(i) << "Failed shape feature count";
+                }
+            }
+        };
+        ASSERT_NO_FATAL_FAILURE(check(polygons));
+        ASSERT_NO_FATAL_FAILURE(check(holygons));
+    }
+};
+
+} // namespace stf::scaffolding::alg::tiling
+
+#endif
\ No newline at end of file
@@ -68,6 +68,104 @@ struct intersects
     }
 };
 
+template <typename T>
+struct sphere
+{
+    stf::cam::frustum<T> frustum;
+    stf::geom::sphere<T> sphere;
+    bool contains;
+    bool intersects_fast;
+    bool intersects;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(contains, frustum.contains(sphere)) << info(i) << "Failed to compute frustum::contains(sphere)";
+        ASSERT_EQ(intersects_fast, frustum.intersects_fast(sphere))
+            << info(i) << "Failed to compute frustum::intersects_fast(sphere)";
+        ASSERT_EQ(intersects_fast, stf::alg::intersects_fast(sphere, frustum))
+            << info(i) << "Failed to compute intersects_fast for sphere -> frustum";
+        ASSERT_EQ(intersects, frustum.intersects(sphere)) << info(i) << "Failed to compute frustum::intersects(sphere)";
+        ASSERT_EQ(intersects, stf::alg::intersects(sphere, frustum))
+            << info(i) << "Failed to compute intersects for sphere -> frustum";
+    }
+};
+
+template <typename T>
+struct cone
+{
+    stf::cam::frustum<T> frustum;
+    stf::geom::cone<T> cone;
+    bool intersects_fast;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(intersects_fast, frustum.intersects_fast(cone))
+            << info(i) << "Failed to compute frustum::intersects_fast(cone)";
+        ASSERT_EQ(intersects_fast, stf::alg::intersects_fast(frustum, cone))
+            << info(i) << "Failed to compute intersects_fast for frustum -> cone";
+    }
+};
+
+template <typename T>
+struct classify
+{
+    stf::cam::frustum<T> frustum;
+    stf::geom::aabb3<T> box;
+    uint32_t mask;
+    stf::intersection_types expected;
+    uint32_t expected_mask;
+    size_t expected_hint;
+
+    void verify(size_t const i) const
+    {
+        uint32_t computed_mask = mask;
+        size_t hint = 0;
+        ASSERT_EQ(expected, frustum.classify(box, computed_mask, hint)) << info(i) << "Failed to classify aabb";
+        if (expected != stf::intersection_types::outside)
+        {
+            ASSERT_EQ(expected_mask, computed_mask) << info(i) << "Failed to compute the plane mask";
+        }
+        ASSERT_EQ(expected_hint, hint) << info(i) << "Failed to compute the plane hint";
+
+        // the classification should not change when starting from the computed hint
+        computed_mask = mask;
+        ASSERT_EQ(expected, frustum.classify(box, computed_mask, hint)) << info(i) << "Failed to classify with hint";
+        ASSERT_EQ(expected_hint, hint) << info(i) << "Failed to preserve the plane hint";
+
+        if (mask == stf::cam::frustum<T>::c_all_planes)
+        {
+            ASSERT_EQ(expected, frustum.classify(box)) << info(i) << "Failed to classify aabb with all planes";
+        }
+    }
+};
+
+template <typename T>
+struct from_matrix
+{
+    stf::cam::scamera<T> camera;
+    stf::math::mtx4<T> view_proj;
+    stf::depth_range_types depth;
+
+    void verify(size_t const i) const
+    {
+        T const eps = T(1.0E-6) * camera.farp;
+        stf::cam::frustum<T> expected(camera);
+        stf::cam::frustum<T> computed(view_proj, depth);
+        for (size_t p = 0; p < stf::cam::frustum<T>::c_num_planes; ++p)
+        {
+            stf::geom::plane<T> const& lhs = expected.planes()[p];
+            stf::geom::plane<T> const& rhs = computed.planes()[p];
+            ASSERT_TRUE(stf::math::equ(lhs.normal(), rhs.normal(), eps)) << info(i) << "Failed to extract plane " << p;
+            ASSERT_NEAR(lhs.side(rhs.point()), T(0), eps) << info(i) << "Failed to extract plane " << p;
+        }
+        for (size_t v = 0; v < stf::cam::frustum<T>::c_num_vertices; ++v)
+        {
+            ASSERT_TRUE(stf::math::equ(expected.vertex(v), computed.vertex(v), eps))
+                << info(i) << "Failed to compute vertex " << v;
+        }
+    }
+};
+
 } // namespace stf::scaffolding::cam::frustum
 
 #endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef STF_SCAFFOLDING_CAM_OCCLUSION_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_CAM_OCCLUSION_HPP_HEADER_GUARD
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include <stf/cam/occlusion.hpp>
+
+namespace stf::scaffolding::cam::occlusion
+{
+
+template <typename T>
+struct occluded
+{
+    stf::cam::scamera<T> camera;
+    std::vector<stf::math::vec3<T>> vertices;
+    std::vector<uint32_t> indices;
+    stf::geom::aabb3<T> box;
+    bool occluded;
+
+    void verify(size_t const i) const
+    {
+        stf::cam::occlusion_buffer<T> serial(64, 48);
+        serial.rasterize(vertices, indices, camera);
+        ASSERT_EQ(occluded, serial.occluded(box, camera)) << info(i) << "Failed to compute occlusion_buffer::occluded";
+
+        // rasterizing with multiple threads should produce the same buffer
+        stf::cam::occlusion_buffer<T> threaded(64, 48);
+        threaded.rasterize(vertices, indices, camera, 3);
+        ASSERT_EQ(serial.level_count(), threaded.level_count()) << info(i) << "Failed to build the same pyramid";
+        for (size_t l = 0; l < serial.level_count(); ++l)
+        {
+            size_t const width = (serial.width() + (static_cast<size_t>(1) << l) - 1) >> l;
+            size_t const height = (serial.height() + (static_cast<size_t>(1) << l) - 1) >> l;
+            for (size_t y = 0; y < height; ++y)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    ASSERT_EQ(serial.depth(l, x, y), threaded.depth(l, x, y))
+                        << info(i) << "Failed to match depth at (" << l << ", " << x << ", " << y << ")";
+                }
+            }
+        }
+
+        // the batch api should agree with the individual query
+        std::vector<stf::geom::aabb3<T>> boxes = {box, box};
+        std::vector<size_t> visible(boxes.size());
+        visible.resize(threaded.cull(boxes, camera.perspective() * camera.view(), visible));
+        ASSERT_EQ(occluded ? 0 : 2, visible.size()) << info(i) << "Failed to compute occlusion_buffer::cull";
+    }
+};
+
+} // namespace stf::scaffolding::cam::occlusion
+
+#endif
\ No newline at end of file
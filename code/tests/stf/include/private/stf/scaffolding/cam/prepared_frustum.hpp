@@ -0,0 +1,87 @@
+#ifndef STF_SCAFFOLDING_CAM_PREPARED_FRUSTUM_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_CAM_PREPARED_FRUSTUM_HPP_HEADER_GUARD
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+
+#include <stf/cam/prepared_frustum.hpp>
+
+namespace stf::scaffolding::cam::prepared_frustum
+{
+
+template <typename T>
+struct intersects
+{
+    stf::cam::frustum<T> frustum;
+    stf::geom::obb3<T> box;
+    bool intersects;
+
+    void verify(size_t const i) const
+    {
+        stf::cam::prepared_frustum<T> prepared(frustum);
+        ASSERT_EQ(intersects, prepared.intersects(box)) << info(i) << "Failed to compute prepared_frustum::intersects";
+        ASSERT_EQ(intersects, frustum.intersects(box)) << info(i) << "Failed to compute frustum::intersects";
+    }
+};
+
+template <typename T>
+struct cull
+{
+    stf::cam::frustum<T> frustum;
+    std::vector<stf::geom::obb3<T>> boxes;
+
+    void verify(size_t const i) const
+    {
+        // the batch api should agree with intersection tests on the unprepared frustum
+        std::vector<size_t> expected;
+        for (size_t b = 0; b < boxes.size(); ++b)
+        {
+            if (frustum.intersects(boxes[b]))
+            {
+                expected.push_back(b);
+            }
+        }
+
+        stf::cam::prepared_frustum<T> prepared(frustum);
+        std::vector<size_t> visible(boxes.size());
+        visible.resize(prepared.cull(boxes, visible));
+        ASSERT_EQ(expected, visible) << info(i) << "Failed to compute prepared_frustum::cull";
+    }
+};
+
+template <typename T>
+struct cull_spheres
+{
+    stf::cam::frustum<T> frustum;
+    std::vector<stf::geom::sphere<T>> spheres;
+
+    void verify(size_t const i) const
+    {
+        // the batch api should agree with the plane test on the unprepared frustum
+        std::vector<size_t> expected;
+        std::vector<T> x, y, z, radius;
+        for (size_t s = 0; s < spheres.size(); ++s)
+        {
+            if (frustum.intersects_fast(spheres[s]))
+            {
+                expected.push_back(s);
+            }
+            x.push_back(spheres[s].center.x);
+            y.push_back(spheres[s].center.y);
+            z.push_back(spheres[s].center.z);
+            radius.push_back(spheres[s].radius);
+        }
+
+        stf::cam::prepared_frustum<T> prepared(frustum);
+        std::vector<size_t> visible(spheres.size());
+        visible.resize(prepared.cull(x, y, z, radius, visible));
+        ASSERT_EQ(expected, visible) << info(i) << "Failed to compute prepared_frustum::cull for spheres";
+    }
+};
+
+} // namespace stf::scaffolding::cam::prepared_frustum
+
+#endif
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef STF_SCAFFOLDING_GEOM_CONE_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_CONE_HPP_HEADER_GUARD
+
+#include <gtest/gtest.h>
+
+#include <stf/geom/cone.hpp>
+
+namespace stf::scaffolding::geom::cone
+{
+
+template <typename T>
+struct contains
+{
+    stf::geom::cone<T> const cone;
+    stf::math::vec3<T> const point;
+    bool const contained;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(contained, cone.contains(point)) << info(i) << "failed contains test";
+    }
+};
+
+template <typename T>
+struct extremity
+{
+    stf::geom::cone<T> const cone;
+    stf::math::vec3<T> const direction;
+    stf::math::vec3<T> const expected;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_TRUE(stf::math::equ(expected, cone.extremity(direction), stf::math::constants<T>::tol))
+            << info(i) << "failed extremity test";
+    }
+};
+
+} // namespace stf::scaffolding::geom::cone
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+#ifndef STF_SCAFFOLDING_GEOM_CONVEX_POLYGON_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_CONVEX_POLYGON_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/alg/hull.hpp>
+#include <stf/alg/intersects.hpp>
+#include <stf/geom/convex_polygon.hpp>
+#include <stf/geom/polygon.hpp>
+
+namespace stf::scaffolding::geom::convex_polygon
+{
+
+template <typename T>
+struct contains
+{
+    stf::geom::convex_polygon<T> shape;
+    stf::math::vec2<T> query;
+    stf::boundary_types boundary_type;
+    bool contained;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(contained, shape.contains(query, boundary_type)) << info(i) << "failed convex_polygon::contains";
+    }
+};
+
+template <typename T, typename rhs_t>
+struct intersects
+{
+    stf::geom::convex_polygon<T> lhs;
+    rhs_t rhs;
+    bool intersect;
+    T dist;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(intersect, stf::alg::intersects(lhs, rhs)) << info(i) << "failed lhs/rhs intersection";
+        ASSERT_EQ(intersect, stf::alg::intersects(rhs, lhs)) << info(i) << "failed rhs/lhs intersection";
+        ASSERT_NEAR(dist, std::sqrt(stf::geom::dist_squared(lhs, rhs)), stf::math::constants<T>::tol)
+            << info(i) << "failed lhs/rhs distance";
+        ASSERT_NEAR(dist, std::sqrt(stf::geom::dist_squared(rhs, lhs)), stf::math::constants<T>::tol)
+            << info(i) << "failed rhs/lhs distance";
+    }
+};
+
+// builds convex polygons from the hulls of random points and compares the convex polygon queries against brute force
+// queries on the equivalent polygons
+template <typename T>
+struct random
+{
+    uint32_t seed;
+    size_t points;
+    size_t queries;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> offset(T(-3), T(3));
+        auto build = [&]()
+        {
+            std::uniform_real_distribution<T> position(T(-1), T(1));
+            stf::math::vec2<T> const center(offset(gen), offset(gen));
+            std::vector<stf::math::vec2<T>> vertices;
+            for (size_t k = 0; k < points; ++k)
+            {
+                vertices.push_back(center + stf::math::vec2<T>(position(gen), position(gen)));
+            }
+            return stf::geom::polygon<T>(stf::alg::convex_hull(vertices));
+        };
+
+        stf::geom::polygon<T> const polygon = build();
+        stf::geom::convex_polygon<T> const convex(polygon);
+        ASSERT_EQ(polygon.size(), convex.size()) << info(i) << "failed convex_polygon size";
+
+        std::uniform_real_distribution<T> position(T(-4), T(4));
+        std::vector<stf::math::vec2<T>> samples = polygon.vertices();
+        for (size_t k = 0; k < queries; ++k)
+        {
+            samples.push_back(stf::math::vec2<T>(position(gen), position(gen)));
+        }
+
+        for (size_t k = 0; k < samples.size(); ++k)
+        {
+            for (stf::boundary_types const type : {stf::boundary_types::closed, stf::boundary_types::open})
+            {
+                ASSERT_EQ(polygon.contains(samples[k], type), convex.contains(samples[k], type))
+                    << info(i) << "failed convex_polygon::contains for query " << k;
+            }
+            ASSERT_NEAR(std::sqrt(polygon.dist_squared(samples[k])), convex.dist(samples[k]),
+                        stf::math::constants<T>::tol)
+                << info(i) << "failed convex_polygon::dist for query " << k;
+        }
+
+        for (size_t k = 0; k < queries / 10; ++k)
+        {
+            stf::geom::polygon<T> const other = build();
+            stf::geom::convex_polygon<T> const rhs(other);
+
+            // brute force: the polygons intersect iff an edge pair crosses or one contains a vertex of the other
+            bool intersect = polygon.contains(other[0], stf::boundary_types::closed) ||
+                             other.contains(polygon[0], stf::boundary_types::closed);
+            T d = stf::math::constants<T>::pos_inf;
+            for (size_t a = 0; a < polygon.size(); ++a)
+            {
+                for (size_t b = 0; b < other.size(); ++b)
+                {
+                    stf::geom::segment2<T> const lhs_edge = polygon.edge(a);
+                    stf::geom::segment2<T> const rhs_edge = other.edge(b);
+                    intersect = intersect || stf::alg::intersects(lhs_edge, rhs_edge);
+                    d = std::min({d, lhs_edge.dist_squared(rhs_edge.a), rhs_edge.dist_squared(lhs_edge.a)});
+                }
+            }
+            d = intersect ? stf::math::constants<T>::zero : std::sqrt(d);
+
+            ASSERT_EQ(intersect, convex.intersects(rhs)) << info(i) << "failed convex_polygon::intersects " << k;
+            ASSERT_NEAR(d, convex.dist(rhs), stf::math::constants<T>::tol)
+                << info(i) << "failed convex_polygon::dist " << k;
+        }
+    }
+};
+
+} // namespace stf::scaffolding::geom::convex_polygon
+
+#endif
\ No newline at end of file
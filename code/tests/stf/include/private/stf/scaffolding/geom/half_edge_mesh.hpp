@@ -0,0 +1,120 @@
+#ifndef STF_SCAFFOLDING_GEOM_HALF_EDGE_MESH_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_HALF_EDGE_MESH_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/geom/half_edge_mesh.hpp>
+
+namespace stf::scaffolding::geom::half_edge_mesh
+{
+
+template <typename T>
+struct topology
+{
+    stf::geom::half_edge_mesh<T> mesh;
+    size_t vertex_count;
+    size_t half_edge_count;
+    size_t face_count;
+    std::vector<size_t> loop_sizes;
+
+    void verify(size_t const i) const
+    {
+        using mesh_t = stf::geom::half_edge_mesh<T>;
+        using handle_t = typename mesh_t::handle_t;
+
+        std::vector<handle_t> vertices;
+        std::vector<handle_t> half_edges;
+        std::vector<handle_t> faces;
+        mesh.visit_vertices([&](handle_t const v) { vertices.push_back(v); });
+        mesh.visit_half_edges([&](handle_t const h) { half_edges.push_back(h); });
+        mesh.visit_faces([&](handle_t const f) { faces.push_back(f); });
+
+        ASSERT_EQ(vertex_count, mesh.vertex_count()) << info(i) << "Failed to count vertices";
+        ASSERT_EQ(half_edge_count, mesh.half_edge_count()) << info(i) << "Failed to count half-edges";
+        ASSERT_EQ(face_count, mesh.face_count()) << info(i) << "Failed to count faces";
+        ASSERT_EQ(vertex_count, vertices.size()) << info(i) << "Failed to visit vertices";
+        ASSERT_EQ(half_edge_count, half_edges.size()) << info(i) << "Failed to visit half-edges";
+        ASSERT_EQ(face_count, faces.size()) << info(i) << "Failed to visit faces";
+
+        std::vector<size_t> degrees(vertices.empty() ? 0 : vertices.back() + 1, 0);
+        for (handle_t const h : half_edges)
+        {
+            ASSERT_TRUE(mesh.has_vertex(mesh.origin(h))) << info(i) << "Failed to reference a vertex from " << h;
+            ASSERT_TRUE(mesh.has_half_edge(mesh.twin(h))) << info(i) << "Failed to reference a twin from " << h;
+            ASSERT_EQ(h, mesh.twin(mesh.twin(h))) << info(i) << "Failed to pair twins at " << h;
+            ASSERT_EQ(h, mesh.next(mesh.prev(h))) << info(i) << "Failed to link prev at " << h;
+            ASSERT_EQ(h, mesh.prev(mesh.next(h))) << info(i) << "Failed to link next at " << h;
+            ASSERT_EQ(mesh.target(h), mesh.origin(mesh.next(h))) << info(i) << "Failed to connect next at " << h;
+            ASSERT_NE(mesh.origin(h), mesh.target(h)) << info(i) << "Failed to avoid a degenerate edge at " << h;
+            ASSERT_EQ(mesh.face(h), mesh.face(mesh.next(h))) << info(i) << "Failed to share a face at " << h;
+            ASSERT_FALSE(mesh.is_boundary(h) && mesh.is_boundary(mesh.twin(h)))
+                << info(i) << "Failed to remove an edge with no faces at " << h;
+            if (!mesh.is_boundary(h))
+            {
+                ASSERT_TRUE(mesh.has_face(mesh.face(h))) << info(i) << "Failed to reference a face from " << h;
+                ASSERT_EQ(h, mesh.next(mesh.next(mesh.next(h)))) << info(i) << "Failed to close a triangle at " << h;
+            }
+            ++degrees[mesh.origin(h)];
+        }
+
+        for (handle_t const f : faces)
+        {
+            ASSERT_EQ(f, mesh.face(mesh.face_half_edge(f))) << info(i) << "Failed to reference face " << f;
+        }
+
+        for (handle_t const v : vertices)
+        {
+            ASSERT_EQ(degrees[v], mesh.valence(v)) << info(i) << "Failed to compute the valence of " << v;
+            if (mesh.valence(v) == 0)
+            {
+                ASSERT_EQ(mesh_t::c_invalid, mesh.half_edge(v)) << info(i) << "Failed to mark isolated vertex " << v;
+                continue;
+            }
+            ASSERT_EQ(v, mesh.origin(mesh.half_edge(v))) << info(i) << "Failed to reference an outgoing half-edge";
+
+            bool boundary = false;
+            mesh.visit_outgoing(v, [&](handle_t const h) { boundary = boundary || mesh.is_boundary(h); });
+            ASSERT_EQ(boundary, mesh.is_boundary(mesh.half_edge(v)))
+                << info(i) << "Failed to reference a boundary half-edge from " << v;
+
+            // walk each fan from its representative (rotating towards the end of an open fan)
+            size_t count = 0;
+            bool any = false;
+            mesh.visit_fans(v, [&](handle_t const rep)
+            {
+                bool open = false;
+                handle_t h = rep;
+                do
+                {
+                    ++count;
+                    open = open || mesh.is_boundary(h);
+                    h = mesh.is_boundary(mesh.twin(h)) ? rep : mesh.next(mesh.twin(h));
+                } while (h != rep && count <= degrees[v]);
+                any = any || open;
+                ASSERT_EQ(v, mesh.origin(rep)) << info(i) << "Failed to reference a fan of " << v;
+                ASSERT_EQ(open, mesh.is_boundary(rep)) << info(i) << "Failed to represent an open fan at " << v;
+            });
+            ASSERT_EQ(degrees[v], count) << info(i) << "Failed to partition the edges of " << v << " into fans";
+            ASSERT_EQ(any, mesh.is_boundary(mesh.half_edge(v))) << info(i) << "Failed to prefer a boundary fan";
+        }
+
+        std::vector<size_t> sizes;
+        for (std::vector<handle_t> const& loop : mesh.boundary_loops())
+        {
+            for (handle_t const h : loop)
+            {
+                ASSERT_TRUE(mesh.is_boundary(h)) << info(i) << "Failed to only include boundary half-edges in a loop";
+            }
+            sizes.push_back(loop.size());
+        }
+        std::sort(sizes.begin(), sizes.end());
+        ASSERT_EQ(loop_sizes, sizes) << info(i) << "Failed to compute boundary loops";
+    }
+};
+
+} // namespace stf::scaffolding::geom::half_edge_mesh
+
+#endif
\ No newline at end of file
@@ -0,0 +1,162 @@
+#ifndef STF_SCAFFOLDING_GEOM_MESH_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_MESH_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/geom/mesh.hpp>
+
+namespace stf::scaffolding::geom::mesh
+{
+
+template <typename T>
+struct weld
+{
+    stf::geom::mesh<T> mesh;
+    T tolerance;
+    size_t vertex_count;
+    size_t triangle_count;
+
+    void verify(size_t const i) const
+    {
+        for (size_t threads : {1, 4})
+        {
+            stf::geom::mesh<T> welded = mesh;
+            size_t const removed = welded.weld(tolerance, threads);
+            ASSERT_EQ(vertex_count, welded.vertex_count()) << info(i) << "Failed to weld vertices";
+            ASSERT_EQ(triangle_count, welded.triangle_count()) << info(i) << "Failed to remove degenerate triangles";
+            ASSERT_EQ(mesh.vertex_count() - vertex_count, removed) << info(i) << "Failed to count removed vertices";
+            for (uint32_t index : welded.indices())
+            {
+                ASSERT_LT(index, welded.vertex_count()) << info(i) << "Failed to remap indices";
+            }
+            for (size_t t = 0; t < welded.triangle_count(); ++t)
+            {
+                // each triangle should be within tolerance of a triangle in the original mesh
+                bool found = false;
+                for (size_t s = 0; s < mesh.triangle_count() && !found; ++s)
+                {
+                    stf::geom::triangle3<T> const lhs = welded.triangle(t);
+                    stf::geom::triangle3<T> const rhs = mesh.triangle(s);
+                    found = math::dist(lhs.a, rhs.a) <= tolerance && math::dist(lhs.b, rhs.b) <= tolerance &&
+                            math::dist(lhs.c, rhs.c) <= tolerance;
+                }
+                ASSERT_TRUE(found) << info(i) << "Failed to preserve triangle " << t;
+            }
+        }
+    }
+};
+
+// welds clusters of nearby vertices and checks that the kept vertices are separated, that every vertex is merged into
+// a nearby kept vertex, and that the result does not depend on the thread count
+template <typename T>
+struct random_weld
+{
+    uint32_t seed;
+    size_t clusters;
+    T tolerance;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(-1), T(1));
+        std::uniform_real_distribution<T> offset(-tolerance, tolerance);
+        std::vector<math::vec3<T>> vertices;
+        for (size_t c = 0; c < clusters; ++c)
+        {
+            math::vec3<T> const center(position(gen), position(gen), position(gen));
+            for (size_t k = 0; k < 4; ++k)
+            {
+                vertices.push_back(center + math::vec3<T>(offset(gen), offset(gen), offset(gen)));
+            }
+        }
+        std::vector<uint32_t> indices;
+        for (uint32_t v = 0; v + 2 < vertices.size(); ++v)
+        {
+            indices.insert(indices.end(), {v, v + 1, v + 2});
+        }
+        stf::geom::mesh<T> const mesh(vertices, indices);
+
+        stf::geom::mesh<T> reference = mesh;
+        reference.weld(tolerance, 1);
+        std::vector<math::vec3<T>> const& kept = reference.vertices();
+        for (size_t a = 0; a < kept.size(); ++a)
+        {
+            for (size_t b = a + 1; b < kept.size(); ++b)
+            {
+                ASSERT_GT(math::dist(kept[a], kept[b]), tolerance) << info(i) << "Failed to merge " << a << ", " << b;
+            }
+        }
+        for (size_t v = 0; v < vertices.size(); ++v)
+        {
+            auto near = [&](math::vec3<T> const& p) { return math::dist(p, vertices[v]) <= tolerance; };
+            ASSERT_TRUE(std::any_of(kept.begin(), kept.end(), near)) << info(i) << "Failed to keep vertex " << v;
+        }
+        for (size_t threads : {3, 8})
+        {
+            stf::geom::mesh<T> welded = mesh;
+            welded.weld(tolerance, threads);
+            ASSERT_EQ(reference.vertices(), welded.vertices()) << info(i) << "Failed to weld with " << threads;
+            ASSERT_EQ(reference.indices(), welded.indices()) << info(i) << "Failed to weld with " << threads;
+        }
+    }
+};
+
+template <typename T>
+struct normals
+{
+    stf::geom::mesh<T> mesh;
+    std::vector<math::vec3<T>> face_normals;
+    std::vector<math::vec3<T>> vertex_normals;
+
+    void verify(size_t const i) const
+    {
+        for (size_t threads : {1, 3, 8})
+        {
+            std::vector<math::vec3<T>> faces;
+            std::vector<math::vec3<T>> vertices;
+            mesh.normals(faces, vertices, threads);
+            ASSERT_EQ(face_normals.size(), faces.size()) << info(i) << "Failed to size face normals";
+            ASSERT_EQ(vertex_normals.size(), vertices.size()) << info(i) << "Failed to size vertex normals";
+            for (size_t f = 0; f < faces.size(); ++f)
+            {
+                ASSERT_NEAR(0, math::dist(face_normals[f], faces[f]), math::constants<T>::tol)
+                    << info(i) << "Failed to compute face normal " << f << " with " << threads << " threads";
+            }
+            for (size_t v = 0; v < vertices.size(); ++v)
+            {
+                ASSERT_NEAR(0, math::dist(vertex_normals[v], vertices[v]), math::constants<T>::tol)
+                    << info(i) << "Failed to compute vertex normal " << v << " with " << threads << " threads";
+            }
+        }
+    }
+};
+
+template <typename T>
+struct bounds
+{
+    stf::geom::mesh<T> mesh;
+    stf::geom::aabb3<T> box;
+    math::vec3<T> center;
+    T radius;
+
+    void verify(size_t const i) const
+    {
+        for (size_t threads : {1, 4})
+        {
+            stf::geom::aabb3<T> const computed = mesh.aabb(threads);
+            ASSERT_EQ(box.min, computed.min) << info(i) << "Failed to compute aabb::min";
+            ASSERT_EQ(box.max, computed.max) << info(i) << "Failed to compute aabb::max";
+            stf::geom::sphere<T> const sphere = mesh.bounding_sphere(threads);
+            ASSERT_EQ(center, sphere.center) << info(i) << "Failed to compute sphere center";
+            ASSERT_NEAR(radius, sphere.radius, math::constants<T>::tol) << info(i) << "Failed to compute sphere radius";
+        }
+    }
+};
+
+} // namespace stf::scaffolding::geom::mesh
+
+#endif
\ No newline at end of file
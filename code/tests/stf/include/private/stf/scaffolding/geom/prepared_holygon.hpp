@@ -0,0 +1,96 @@
+#ifndef STF_SCAFFOLDING_GEOM_PREPARED_HOLYGON_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_PREPARED_HOLYGON_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/geom/holygon.hpp>
+#include <stf/geom/polygon.hpp>
+#include <stf/geom/prepared_holygon.hpp>
+
+#include "stf/scaffolding/random.hpp"
+
+namespace stf::scaffolding::geom::prepared_holygon
+{
+
+template <typename T>
+struct queries
+{
+    stf::geom::holygon<T> shape;
+    stf::math::vec2<T> query;
+    bool closed;
+    bool open;
+    T dist_squared;
+
+    void verify(size_t const i) const
+    {
+        stf::geom::prepared_holygon<T> const prepared(shape);
+        ASSERT_EQ(closed, prepared.contains(query, stf::boundary_types::closed)) << info(i) << "failed closed contains";
+        ASSERT_EQ(open, prepared.contains(query, stf::boundary_types::open)) << info(i) << "failed open contains";
+        ASSERT_EQ(dist_squared, prepared.dist_squared(query)) << info(i) << "failed dist_squared";
+    }
+};
+
+// builds a star-shaped holygon with a grid of small star-shaped holes and compares the prepared holygon against the
+// queries of the original holygon
+template <typename T>
+struct random
+{
+    uint32_t seed;
+    size_t vertices;
+    size_t grid;
+    size_t queries;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        auto star = [&](stf::math::vec2<T> const& center, T const min, T const max)
+        { return stf::scaffolding::star(gen, center, vertices, min, max); };
+
+        // the holes are centered in the cells of a grid over [-1, 1]^2 so that they are disjoint and inside the hull
+        std::vector<stf::geom::polygon<T>> holes;
+        T const cell = T(2) / static_cast<T>(grid);
+        for (size_t x = 0; x < grid; ++x)
+        {
+            for (size_t y = 0; y < grid; ++y)
+            {
+                stf::math::vec2<T> const center(-T(1) + cell * (T(x) + T(0.5)), -T(1) + cell * (T(y) + T(0.5)));
+                holes.push_back(star(center, T(0.1) * cell, T(0.45) * cell));
+            }
+        }
+        stf::geom::holygon<T> const holygon(star(stf::math::vec2<T>(0), T(1.5), T(2)), holes);
+        stf::geom::prepared_holygon<T> const prepared(holygon);
+
+        std::uniform_real_distribution<T> position(T(-2.5), T(2.5));
+        std::vector<stf::math::vec2<T>> points = holygon.hull().vertices();
+        for (stf::geom::polygon<T> const& hole : holes)
+        {
+            points.insert(points.end(), hole.vertices().begin(), hole.vertices().end());
+        }
+        for (size_t k = 0; k < queries; ++k)
+        {
+            points.push_back(stf::math::vec2<T>(position(gen), position(gen)));
+        }
+
+        for (size_t k = 0; k < points.size(); ++k)
+        {
+            for (stf::boundary_types const type : {stf::boundary_types::closed, stf::boundary_types::open})
+            {
+                ASSERT_EQ(holygon.contains(points[k], type), prepared.contains(points[k], type))
+                    << info(i) << "failed prepared_holygon::contains for query " << k;
+            }
+            T const expected = holygon.dist_squared(points[k]);
+            T const tolerance = T(1e-12) * std::max(T(1), expected);
+            ASSERT_NEAR(expected, prepared.dist_squared(points[k]), tolerance)
+                << info(i) << "failed prepared_holygon::dist_squared for query " << k;
+        }
+    }
+};
+
+} // namespace stf::scaffolding::geom::prepared_holygon
+
+#endif
\ No newline at end of file
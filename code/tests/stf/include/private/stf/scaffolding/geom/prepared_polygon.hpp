@@ -0,0 +1,80 @@
+#ifndef STF_SCAFFOLDING_GEOM_PREPARED_POLYGON_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_PREPARED_POLYGON_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/geom/holygon.hpp>
+#include <stf/geom/polygon.hpp>
+#include <stf/geom/prepared_polygon.hpp>
+
+#include "stf/scaffolding/random.hpp"
+
+namespace stf::scaffolding::geom::prepared_polygon
+{
+
+template <typename T, typename shape_t>
+struct contains
+{
+    shape_t shape;
+    stf::math::vec2<T> query;
+    stf::boundary_types boundary_type;
+    bool contained;
+
+    void verify(size_t const i) const
+    {
+        stf::geom::prepared_polygon<T> const prepared(shape);
+        ASSERT_EQ(contained, shape.contains(query, boundary_type)) << info(i) << "failed shape::contains";
+        ASSERT_EQ(contained, prepared.contains(query, boundary_type)) << info(i) << "failed prepared_polygon::contains";
+    }
+};
+
+// builds a star-shaped polygon (and a holygon with a star-shaped hole) and compares the prepared polygon against the
+// containment queries of the original shapes
+template <typename T>
+struct random
+{
+    uint32_t seed;
+    size_t vertices;
+    size_t queries;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        auto star = [&](T const min, T const max)
+        { return stf::scaffolding::star(gen, stf::math::vec2<T>(0), vertices, min, max); };
+
+        stf::geom::polygon<T> const hull = star(T(1), T(2));
+        stf::geom::holygon<T> const holygon(hull, {star(T(0.2), T(0.5))});
+        stf::geom::prepared_polygon<T> const prepared_hull(hull);
+        stf::geom::prepared_polygon<T> const prepared_holygon(holygon);
+
+        std::uniform_real_distribution<T> position(T(-2.5), T(2.5));
+        std::vector<stf::math::vec2<T>> points = holygon.hull().vertices();
+        std::vector<stf::math::vec2<T>> const& hole = holygon.holes().front().vertices();
+        points.insert(points.end(), hole.begin(), hole.end());
+        for (size_t k = 0; k < queries; ++k)
+        {
+            points.push_back(stf::math::vec2<T>(position(gen), position(gen)));
+        }
+
+        for (stf::boundary_types const type : {stf::boundary_types::closed, stf::boundary_types::open})
+        {
+            for (size_t k = 0; k < points.size(); ++k)
+            {
+                ASSERT_EQ(hull.contains(points[k], type), prepared_hull.contains(points[k], type))
+                    << info(i) << "failed prepared_polygon::contains for polygon query " << k;
+                ASSERT_EQ(holygon.contains(points[k], type), prepared_holygon.contains(points[k], type))
+                    << info(i) << "failed prepared_polygon::contains for holygon query " << k;
+            }
+        }
+    }
+};
+
+} // namespace stf::scaffolding::geom::prepared_polygon
+
+#endif
\ No newline at end of file
@@ -0,0 +1,138 @@
+#ifndef STF_SCAFFOLDING_GEOM_TRIANGLE_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_GEOM_TRIANGLE_HPP_HEADER_GUARD
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/alg/intersects.hpp>
+#include <stf/geom/triangle.hpp>
+
+namespace stf::scaffolding::geom::triangle
+{
+
+template <typename T, size_t N>
+struct area
+{
+    stf::geom::triangle<T, N> tri;
+    T area;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_NEAR(area, tri.area(), math::constants<T>::tol) << info(i) << "Failed to compute triangle::area";
+    }
+};
+
+template <typename T>
+struct normal
+{
+    stf::geom::triangle3<T> tri;
+    math::vec3<T> normal;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(normal, tri.normal()) << info(i) << "Failed to compute triangle::normal";
+    }
+};
+
+template <typename T, size_t N>
+struct barycentric
+{
+    stf::geom::triangle<T, N> tri;
+    math::vec<T, N> point;
+    math::vec3<T> weights;
+
+    void verify(size_t const i) const
+    {
+        math::vec3<T> const computed = tri.barycentric(point);
+        ASSERT_EQ(weights, computed) << info(i) << "Failed to compute triangle::barycentric";
+        ASSERT_NEAR(math::constants<T>::one, computed.x + computed.y + computed.z, math::constants<T>::tol)
+            << info(i) << "Failed to compute weights that sum to 1";
+    }
+};
+
+template <typename T, size_t N>
+struct closest_point
+{
+    stf::geom::triangle<T, N> tri;
+    math::vec<T, N> point;
+    math::vec<T, N> closest;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(closest, tri.closest_point(point)) << info(i) << "Failed to compute triangle::closest_point";
+
+        T const dist_squared = (point - closest).length_squared();
+        ASSERT_NEAR(dist_squared, tri.dist_squared(point), math::constants<T>::tol)
+            << info(i) << "Failed to compute triangle::dist_squared";
+        ASSERT_NEAR(dist_squared, stf::geom::dist_squared(point, tri), math::constants<T>::tol)
+            << info(i) << "Failed to compute dist_squared between point and triangle";
+        ASSERT_NEAR(std::sqrt(dist_squared), stf::geom::dist(tri, point), math::constants<T>::tol)
+            << info(i) << "Failed to compute dist between triangle and point";
+    }
+};
+
+template <typename T>
+struct intersects
+{
+    stf::geom::triangle3<T> tri;
+    stf::geom::aabb3<T> box;
+    bool intersects;
+
+    void verify(size_t const i) const
+    {
+        ASSERT_EQ(intersects, tri.intersects(box)) << info(i) << "Failed to compute triangle::intersects";
+        ASSERT_EQ(intersects, stf::alg::intersects(tri, box)) << info(i) << "Failed to compute intersects(tri, box)";
+        ASSERT_EQ(intersects, stf::alg::intersects(box, tri)) << info(i) << "Failed to compute intersects(box, tri)";
+    }
+};
+
+template <typename T>
+struct batch
+{
+    std::vector<math::vec3<T>> vertices;
+    std::vector<uint32_t> indices;
+    math::vec3<T> point;
+    stf::geom::aabb3<T> box;
+
+    void verify(size_t const i) const
+    {
+        size_t const count = indices.size() / 3;
+        std::vector<T> areas(count);
+        std::vector<math::vec3<T>> normals(count);
+        std::vector<math::vec3<T>> points(count, point);
+        std::vector<math::vec3<T>> weights(count);
+        std::vector<math::vec3<T>> closest(count);
+        std::vector<T> dists(count);
+        std::vector<size_t> intersecting(count);
+
+        stf::geom::areas<T, 3>(vertices, indices, areas);
+        stf::geom::normals<T>(vertices, indices, normals);
+        stf::geom::barycentrics<T, 3>(vertices, indices, points, weights);
+        stf::geom::closest_points<T, 3>(vertices, indices, point, closest);
+        size_t const nearest = stf::geom::dists_squared<T, 3>(vertices, indices, point, dists);
+        intersecting.resize(stf::geom::intersecting<T>(vertices, indices, box, intersecting));
+
+        std::vector<size_t> expected;
+        for (size_t t = 0; t < count; ++t)
+        {
+            stf::geom::triangle3<T> const tri(vertices[indices[3 * t]], vertices[indices[3 * t + 1]],
+                                              vertices[indices[3 * t + 2]]);
+            ASSERT_EQ(tri.area(), areas[t]) << info(i) << "Failed to compute areas";
+            ASSERT_EQ(tri.normal(), normals[t]) << info(i) << "Failed to compute normals";
+            ASSERT_EQ(tri.barycentric(point), weights[t]) << info(i) << "Failed to compute barycentrics";
+            ASSERT_EQ(tri.closest_point(point), closest[t]) << info(i) << "Failed to compute closest_points";
+            ASSERT_EQ(tri.dist_squared(point), dists[t]) << info(i) << "Failed to compute dists_squared";
+            ASSERT_LE(dists[nearest], dists[t]) << info(i) << "Failed to compute the nearest triangle";
+            if (tri.intersects(box))
+            {
+                expected.push_back(t);
+            }
+        }
+        ASSERT_EQ(expected, intersecting) << info(i) << "Failed to compute intersecting";
+    }
+};
+
+} // namespace stf::scaffolding::geom::triangle
+
+#endif
\ No newline at end of file
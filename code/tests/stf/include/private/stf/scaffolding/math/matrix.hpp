@@ -54,6 +54,35 @@ struct inverted
     }
 };
 
+// projects points on the near and far planes with math::perspective and checks the clip space coordinates
+template <typename T>
+struct perspective
+{
+    T fov_y;
+    T aspect;
+    T near_plane;
+    T far_plane;
+
+    void verify(size_t const i) const
+    {
+        stf::math::mtx<T, 4> const proj = stf::math::perspective(fov_y, aspect, near_plane, far_plane);
+        T const tol = T(0.0001);
+        for (T const depth : {near_plane, T(0.5) * (near_plane + far_plane), far_plane})
+        {
+            stf::math::vec<T, 4> const clip = proj * stf::math::vec<T, 4>(T(0.25), T(-0.5), -depth, T(1));
+            ASSERT_EQ(depth, clip.w) << info(i) << "failed to compute w = -z at depth " << depth;
+            if (depth == near_plane)
+            {
+                ASSERT_NEAR(T(0), clip.z / clip.w, tol) << info(i) << "failed to map the near plane to 0";
+            }
+            if (depth == far_plane)
+            {
+                ASSERT_NEAR(T(1), clip.z / clip.w, tol) << info(i) << "failed to map the far plane to 1";
+            }
+        }
+    }
+};
+
 } // namespace stf::scaffolding::math::mtx
 
 #endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef STF_SCAFFOLDING_RANDOM_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_RANDOM_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <random>
+
+#include <stf/geom/polygon.hpp>
+#include <stf/math/constants.hpp>
+#include <stf/math/vector.hpp>
+
+namespace stf::scaffolding
+{
+
+// generates a random star-shaped polygon (counterclockwise around center) whose vertices are evenly spaced in angle
+// with a random radius in [min, max)
+template <typename T, typename generator_t>
+stf::geom::polygon<T> star(generator_t& gen, stf::math::vec2<T> const& center, size_t const vertices, T const min,
+                           T const max)
+{
+    std::uniform_real_distribution<T> radius(min, max);
+    stf::geom::polygon<T> polygon;
+    for (size_t k = 0; k < vertices; ++k)
+    {
+        T const theta = stf::math::constants<T>::two_pi * static_cast<T>(k) / static_cast<T>(vertices);
+        polygon.push_back(center + radius(gen) * stf::math::vec2<T>(std::cos(theta), std::sin(theta)));
+    }
+    return polygon;
+}
+
+} // namespace stf::scaffolding
+
+#endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef STF_SCAFFOLDING_SPATIAL_BVH_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_SPATIAL_BVH_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/spatial/bvh.hpp>
+
+namespace stf::scaffolding::spatial::bvh
+{
+
+template <typename T>
+struct find
+{
+    std::vector<stf::geom::aabb3<T>> boxes;
+    size_t leaf_size;
+    stf::geom::aabb3<T> query;
+
+    void verify(size_t const i) const
+    {
+        stf::spatial::bvh<T, 3> tree(boxes, leaf_size);
+
+        // every node should contain its children and every primitive should be stored in exactly one leaf
+        std::vector<size_t> counts(boxes.size(), 0);
+        for (size_t n = 0; n < tree.nodes().size(); ++n)
+        {
+            auto const& node = tree.node(n);
+            if (node.is_leaf())
+            {
+                ASSERT_LE(node.count, std::max(leaf_size, static_cast<size_t>(1)))
+                    << info(i) << "Failed to respect the leaf size";
+                for (size_t p = node.first; p < node.first + node.count; ++p)
+                {
+                    ++counts[tree.primitive(p)];
+                    ASSERT_TRUE(node.bounds.contains(boxes[tree.primitive(p)])) << info(i) << "Failed to bound leaf";
+                }
+            }
+            else
+            {
+                for (size_t child : tree.children(n))
+                {
+                    ASSERT_TRUE(node.bounds.contains(tree.bounds(child))) << info(i) << "Failed to bound child";
+                }
+            }
+        }
+        for (size_t p = 0; p < boxes.size(); ++p)
+        {
+            ASSERT_EQ(1, counts[p]) << info(i) << "Failed to store primitive " << p << " exactly once";
+        }
+
+        // compare the query against brute force
+        std::vector<size_t> expected;
+        for (size_t p = 0; p < boxes.size(); ++p)
+        {
+            if (boxes[p].intersects(query))
+            {
+                expected.push_back(p);
+            }
+        }
+        std::vector<size_t> found;
+        tree.find(query, [&](size_t const p) { found.push_back(p); });
+        std::sort(found.begin(), found.end());
+        ASSERT_EQ(expected, found) << info(i) << "Failed to compute bvh::find";
+    }
+};
+
+} // namespace stf::scaffolding::spatial::bvh
+
+#endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+#ifndef STF_SCAFFOLDING_SPATIAL_EDGE_BVH_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_SPATIAL_EDGE_BVH_HPP_HEADER_GUARD
+
+#include <cmath>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/geom/polyline.hpp>
+#include <stf/spatial/edge_bvh.hpp>
+
+namespace stf::scaffolding::spatial::edge_bvh
+{
+
+template <typename T, typename shape_t>
+struct nearest
+{
+    shape_t shape;
+    stf::math::vec2<T> query;
+    bool found;
+    T dist_squared;
+    stf::math::vec2<T> point;
+    size_t edge;
+
+    void verify(size_t const i) const
+    {
+        stf::spatial::edge_bvh<T, 2> const tree(shape);
+        auto const nearest = tree.nearest(query);
+        ASSERT_EQ(found, nearest.has_value()) << info(i) << "Failed to find the nearest edge";
+        if (found)
+        {
+            ASSERT_EQ(dist_squared, nearest->dist_squared) << info(i) << "Failed to compute the distance";
+            ASSERT_EQ(point, nearest->point) << info(i) << "Failed to compute the closest point";
+            ASSERT_EQ(edge, nearest->edge) << info(i) << "Failed to compute the nearest edge";
+        }
+    }
+};
+
+// builds a random walk and compares the nearest edge against brute force
+template <typename T, size_t N>
+struct random
+{
+    uint32_t seed;
+    size_t vertices;
+    size_t leaf_size;
+    size_t queries;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> step(T(-1), T(1));
+        stf::geom::polyline<T, N> polyline;
+        stf::math::vec<T, N> position(T(0));
+        for (size_t k = 0; k < vertices; ++k)
+        {
+            polyline.push_back(position);
+            for (size_t d = 0; d < N; ++d)
+            {
+                position[d] += step(gen);
+            }
+        }
+        stf::spatial::edge_bvh<T, N> const tree(polyline, leaf_size);
+
+        stf::geom::aabb<T, N> const box = polyline.aabb();
+        for (size_t q = 0; q < queries; ++q)
+        {
+            stf::math::vec<T, N> query;
+            for (size_t d = 0; d < N; ++d)
+            {
+                std::uniform_real_distribution<T> coordinate(box.min[d] - T(2), box.max[d] + T(2));
+                query[d] = coordinate(gen);
+            }
+
+            auto const nearest = tree.nearest(query);
+            ASSERT_TRUE(nearest.has_value()) << info(i) << "Failed to find an edge for query " << q;
+
+            T const expected = polyline.dist_squared(query);
+            T const tolerance = T(1e-10) * std::max(T(1), expected);
+            ASSERT_NEAR(expected, nearest->dist_squared, tolerance) << info(i) << "Failed to compute distance " << q;
+            ASSERT_NEAR(expected, polyline.edge(nearest->edge).dist_squared(query), tolerance)
+                << info(i) << "Failed to find the nearest edge for query " << q;
+            ASSERT_NEAR(nearest->dist_squared, stf::math::dist_squared(query, nearest->point), tolerance)
+                << info(i) << "Failed to compute the closest point for query " << q;
+
+            // nothing is found within a smaller radius
+            ASSERT_FALSE(tree.nearest(query, T(0.5) * expected).has_value())
+                << info(i) << "Failed to respect the maximum distance for query " << q;
+        }
+    }
+};
+
+} // namespace stf::scaffolding::spatial::edge_bvh
+
+#endif
\ No newline at end of file
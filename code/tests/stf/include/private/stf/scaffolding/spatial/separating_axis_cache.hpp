@@ -0,0 +1,105 @@
+#ifndef STF_SCAFFOLDING_SPATIAL_SEPARATING_AXIS_CACHE_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_SPATIAL_SEPARATING_AXIS_CACHE_HPP_HEADER_GUARD
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/stf.hpp>
+#include <stf/spatial/separating_axis_cache.hpp>
+
+namespace stf::scaffolding::spatial::separating_axis_cache
+{
+
+template <typename T>
+struct queries
+{
+    geom::obb3<T> lhs;
+    geom::obb3<T> rhs;
+    size_t repetitions;
+    size_t hits;
+
+    void verify(size_t const i) const
+    {
+        bool const expected = geom::intersects(lhs, rhs);
+        stf::spatial::separating_axis_cache<T> cache;
+        for (size_t r = 0; r < repetitions; ++r)
+        {
+            ASSERT_EQ(expected, cache.intersects(0, lhs, rhs)) << info(i) << "Failed query " << r;
+        }
+        ASSERT_EQ(hits, cache.hits()) << info(i) << "Failed to count hits";
+        ASSERT_EQ(repetitions - hits, cache.misses()) << info(i) << "Failed to count misses";
+    }
+};
+
+template <typename T>
+struct intersecting_pairs
+{
+    uint32_t seed;
+    size_t count;
+    T speed;
+    size_t frames;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> position(T(0), T(20));
+        std::uniform_real_distribution<T> extent(T(0.5), T(3));
+        std::uniform_real_distribution<T> angle(T(0), math::constants<T>::two_pi);
+        std::uniform_real_distribution<T> velocity(-speed, speed);
+
+        std::vector<geom::obb3<T>> boxes;
+        std::vector<math::vec3<T>> velocities;
+        for (size_t b = 0; b < count; ++b)
+        {
+            math::vec3<T> const axis = math::normalized(math::vec3<T>(angle(gen), angle(gen), angle(gen)));
+            math::mtx<T, 3> const rotation = math::rotate(axis, angle(gen)).prefix();
+            math::vec3<T> const center(position(gen), position(gen), position(gen));
+            boxes.push_back(geom::obb3<T>(center, rotation, math::vec3<T>(extent(gen), extent(gen), extent(gen))));
+            velocities.push_back(math::vec3<T>(velocity(gen), velocity(gen), velocity(gen)));
+        }
+
+        std::vector<stf::spatial::index_pair> candidates;
+        for (uint32_t a = 0; a < count; ++a)
+        {
+            for (uint32_t b = a + 1; b < count; ++b)
+            {
+                candidates.emplace_back(a, b);
+            }
+        }
+
+        stf::spatial::separating_axis_cache<T> cache;
+        std::vector<stf::spatial::index_pair> actual;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            std::vector<stf::spatial::index_pair> expected;
+            for (stf::spatial::index_pair const& pair : candidates)
+            {
+                if (geom::intersects(boxes[pair.first], boxes[pair.second]))
+                {
+                    expected.push_back(pair);
+                }
+            }
+
+            cache.intersecting_pairs(boxes, candidates, actual);
+            ASSERT_EQ(expected, actual) << info(i) << "Failed to compute intersecting pairs at frame " << f;
+
+            for (size_t b = 0; b < boxes.size(); ++b)
+            {
+                boxes[b] = geom::obb3<T>(boxes[b].center() + velocities[b], boxes[b].basis(), boxes[b].half_extents());
+            }
+        }
+
+        ASSERT_EQ(candidates.size(), cache.size()) << info(i) << "Failed to track every pair";
+        ASSERT_EQ(candidates.size() * frames, cache.hits() + cache.misses()) << info(i) << "Failed to count queries";
+        if (frames > 1 && candidates.size() > 0)
+        {
+            ASSERT_LT(cache.misses(), cache.hits()) << info(i) << "Failed to reuse separating axes between frames";
+        }
+    }
+};
+
+} // namespace stf::scaffolding::spatial::separating_axis_cache
+
+#endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef STF_SCAFFOLDING_SPATIAL_SWEEP_AND_PRUNE_HPP_HEADER_GUARD
+#define STF_SCAFFOLDING_SPATIAL_SWEEP_AND_PRUNE_HPP_HEADER_GUARD
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <stf/spatial/sweep_and_prune.hpp>
+
+namespace stf::scaffolding::spatial::sweep_and_prune
+{
+
+template <typename T>
+std::vector<stf::spatial::index_pair> brute_force(std::vector<stf::geom::aabb3<T>> const& boxes)
+{
+    std::vector<stf::spatial::index_pair> pairs;
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        for (uint32_t j = i + 1; j < boxes.size(); ++j)
+        {
+            if (boxes[i].intersects(boxes[j]))
+            {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+    return pairs;
+}
+
+template <typename T>
+std::vector<stf::geom::aabb3<T>> random_boxes(std::mt19937& gen, size_t const count, T const extent)
+{
+    std::uniform_real_distribution<T> position(T(0), T(100));
+    std::uniform_real_distribution<T> size(T(0), extent);
+    std::vector<stf::geom::aabb3<T>> boxes;
+    for (size_t i = 0; i < count; ++i)
+    {
+        math::vec3<T> const min(position(gen), position(gen), position(gen));
+        boxes.push_back(stf::geom::aabb3<T>(min, min + math::vec3<T>(size(gen), size(gen), size(gen))));
+    }
+    return boxes;
+}
+
+template <typename T>
+void verify_pairs(size_t const i, size_t const frame, std::vector<stf::geom::aabb3<T>> const& boxes,
+                  std::vector<stf::spatial::index_pair> pairs)
+{
+    std::sort(pairs.begin(), pairs.end());
+    ASSERT_EQ(brute_force(boxes), pairs) << info(i) << "Failed to compute overlapping pairs at frame " << frame;
+}
+
+template <typename T>
+struct overlapping_pairs
+{
+    uint32_t seed;
+    size_t count;
+    T extent;
+    size_t threads;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::vector<stf::geom::aabb3<T>> const boxes = random_boxes(gen, count, extent);
+        std::vector<stf::spatial::index_pair> pairs;
+        stf::spatial::overlapping_pairs<T, 3>(boxes, pairs, threads);
+        verify_pairs(i, 0, boxes, pairs);
+
+        std::vector<stf::spatial::index_pair> sequential;
+        stf::spatial::overlapping_pairs<T, 3>(boxes, sequential);
+        ASSERT_EQ(sequential, pairs) << info(i) << "Failed to produce the same pairs for any number of threads";
+    }
+};
+
+template <typename T>
+struct incremental
+{
+    std::vector<std::vector<stf::geom::aabb3<T>>> frames;
+
+    void verify(size_t const i) const
+    {
+        stf::spatial::sweep_and_prune<T, 3> sap;
+        for (size_t f = 0; f < frames.size(); ++f)
+        {
+            sap.update(frames[f]);
+            ASSERT_EQ(frames[f].size(), sap.size()) << info(i) << "Failed to track the number of boxes";
+            verify_pairs(i, f, frames[f], sap.pairs());
+        }
+    }
+};
+
+template <typename T>
+struct incremental_random
+{
+    uint32_t seed;
+    size_t count;
+    T extent;
+    T speed;
+    size_t frames;
+    size_t threads;
+
+    void verify(size_t const i) const
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<T> velocity(-speed, speed);
+        std::vector<stf::geom::aabb3<T>> boxes = random_boxes(gen, count, extent);
+        std::vector<math::vec3<T>> velocities;
+        for (size_t b = 0; b < boxes.size(); ++b)
+        {
+            velocities.push_back(math::vec3<T>(velocity(gen), velocity(gen), velocity(gen)));
+        }
+
+        stf::spatial::sweep_and_prune<T, 3> sap(boxes, threads);
+        stf::spatial::sweep_and_prune<T, 3> serial(boxes);
+        verify_pairs(i, 0, boxes, sap.pairs());
+        for (size_t f = 1; f <= frames; ++f)
+        {
+            for (size_t b = 0; b < boxes.size(); ++b)
+            {
+                boxes[b].min += velocities[b];
+                boxes[b].max += velocities[b];
+            }
+            sap.update(boxes, threads);
+            serial.update(boxes);
+            verify_pairs(i, f, boxes, sap.pairs());
+            ASSERT_EQ(serial.pairs(), sap.pairs()) << info(i) << "Failed to match the serial update at frame " << f;
+        }
+    }
+};
+
+} // namespace stf::scaffolding::spatial::sweep_and_prune
+
+#endif
\ No newline at end of file